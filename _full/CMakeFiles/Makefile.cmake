@@ -0,0 +1,153 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/Doxygen.cmake"
+  "/root/repo/cmake/GameGraphGymConfig.cmake.in"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tools/buchi/CMakeLists.txt"
+  "/root/repo/tools/discounted/CMakeLists.txt"
+  "/root/repo/tools/ggg/CMakeLists.txt"
+  "/root/repo/tools/mean_payoff/CMakeLists.txt"
+  "/root/repo/tools/parity/CMakeLists.txt"
+  "/root/repo/tools/stochastic_discounted/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/BoostDetectToolset-1.74.0.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/boost_filesystem-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/boost_filesystem-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/libboost_filesystem-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/libboost_filesystem-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_graph-1.74.0/boost_graph-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_graph-1.74.0/boost_graph-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_graph-1.74.0/libboost_graph-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_graph-1.74.0/libboost_graph-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_program_options-1.74.0/boost_program_options-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_program_options-1.74.0/boost_program_options-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_program_options-1.74.0/libboost_program_options-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_program_options-1.74.0/libboost_program_options-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/boost_regex-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/boost_regex-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/libboost_regex-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/libboost_regex-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/boost_unit_test_framework-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/boost_unit_test_framework-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/libboost_unit_test_framework-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/libboost_unit_test_framework-variant-static.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "GameGraphGymConfigVersion.cmake"
+  "GameGraphGymConfig.cmake"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/parity/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/stochastic_discounted/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/discounted/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/mean_payoff/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/buchi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/ggg/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/docs.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_ggg.dir/DependInfo.cmake"
+  "tools/parity/CMakeFiles/ggg_parity_priority_promotion_solver.dir/DependInfo.cmake"
+  "tools/parity/CMakeFiles/ggg_parity_solver_priority_promotion.dir/DependInfo.cmake"
+  "tools/parity/CMakeFiles/ggg_parity_progressive_small_progress_measures_solver.dir/DependInfo.cmake"
+  "tools/parity/CMakeFiles/ggg_parity_solver_progressive_small_progress_measures.dir/DependInfo.cmake"
+  "tools/parity/CMakeFiles/ggg_parity_recursive_solver.dir/DependInfo.cmake"
+  "tools/parity/CMakeFiles/ggg_parity_solver_recursive.dir/DependInfo.cmake"
+  "tools/parity/CMakeFiles/ggg_parity_portfolio_solver.dir/DependInfo.cmake"
+  "tools/parity/CMakeFiles/ggg_parity_solver_portfolio.dir/DependInfo.cmake"
+  "tools/parity/CMakeFiles/ggg_parity_generate.dir/DependInfo.cmake"
+  "tools/parity/CMakeFiles/ggg_parity_verify.dir/DependInfo.cmake"
+  "tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_objective_solver.dir/DependInfo.cmake"
+  "tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_solver_objective.dir/DependInfo.cmake"
+  "tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_strategy_solver.dir/DependInfo.cmake"
+  "tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_solver_strategy.dir/DependInfo.cmake"
+  "tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_value_solver.dir/DependInfo.cmake"
+  "tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_solver_value.dir/DependInfo.cmake"
+  "tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_solver_strategy_float.dir/DependInfo.cmake"
+  "tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_solver_strategy_long_double.dir/DependInfo.cmake"
+  "tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_solver_strategy_rational.dir/DependInfo.cmake"
+  "tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_solver_value_float.dir/DependInfo.cmake"
+  "tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_solver_value_long_double.dir/DependInfo.cmake"
+  "tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_generate.dir/DependInfo.cmake"
+  "tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_lp_benchmark.dir/DependInfo.cmake"
+  "tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_numeric_benchmark.dir/DependInfo.cmake"
+  "tools/discounted/CMakeFiles/ggg_discounted_value_solver.dir/DependInfo.cmake"
+  "tools/discounted/CMakeFiles/ggg_discounted_solver_value.dir/DependInfo.cmake"
+  "tools/discounted/CMakeFiles/ggg_discounted_strategy_improvement_solver.dir/DependInfo.cmake"
+  "tools/discounted/CMakeFiles/ggg_discounted_solver_strategy_improvement.dir/DependInfo.cmake"
+  "tools/mean_payoff/CMakeFiles/ggg_mean_payoff_mse_solver.dir/DependInfo.cmake"
+  "tools/mean_payoff/CMakeFiles/ggg_mean_payoff_solver_mse.dir/DependInfo.cmake"
+  "tools/mean_payoff/CMakeFiles/ggg_mean_payoff_msca_solver.dir/DependInfo.cmake"
+  "tools/mean_payoff/CMakeFiles/ggg_mean_payoff_solver_msca.dir/DependInfo.cmake"
+  "tools/mean_payoff/CMakeFiles/ggg_mean_payoff_msca_values_solver.dir/DependInfo.cmake"
+  "tools/mean_payoff/CMakeFiles/ggg_mean_payoff_solver_msca_values.dir/DependInfo.cmake"
+  "tools/mean_payoff/CMakeFiles/ggg_mean_payoff_energy_solver.dir/DependInfo.cmake"
+  "tools/mean_payoff/CMakeFiles/ggg_mean_payoff_solver_energy.dir/DependInfo.cmake"
+  "tools/mean_payoff/CMakeFiles/ggg_mean_payoff_zwick_paterson_solver.dir/DependInfo.cmake"
+  "tools/mean_payoff/CMakeFiles/ggg_mean_payoff_solver_zwick_paterson.dir/DependInfo.cmake"
+  "tools/mean_payoff/CMakeFiles/ggg_mean_payoff_strategy_improvement_solver.dir/DependInfo.cmake"
+  "tools/mean_payoff/CMakeFiles/ggg_mean_payoff_solver_strategy_improvement.dir/DependInfo.cmake"
+  "tools/mean_payoff/CMakeFiles/ggg_mean_payoff_generate.dir/DependInfo.cmake"
+  "tools/mean_payoff/CMakeFiles/ggg_mean_payoff_verify.dir/DependInfo.cmake"
+  "tools/buchi/CMakeFiles/ggg_buechi_attractor_solver.dir/DependInfo.cmake"
+  "tools/buchi/CMakeFiles/ggg_buechi_solver_attractor.dir/DependInfo.cmake"
+  "tools/buchi/CMakeFiles/ggg_buechi_verify.dir/DependInfo.cmake"
+  "tools/ggg/CMakeFiles/ggg_tools_registry.dir/DependInfo.cmake"
+  "tools/ggg/CMakeFiles/ggg_server.dir/DependInfo.cmake"
+  "tools/ggg/CMakeFiles/ggg_client.dir/DependInfo.cmake"
+  "tools/ggg/CMakeFiles/ggg_server_benchmark.dir/DependInfo.cmake"
+  "tools/ggg/CMakeFiles/ggg_driver.dir/DependInfo.cmake"
+  )
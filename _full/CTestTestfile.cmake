@@ -0,0 +1,13 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_full
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("tests")
+subdirs("tools/parity")
+subdirs("tools/stochastic_discounted")
+subdirs("tools/discounted")
+subdirs("tools/mean_payoff")
+subdirs("tools/buchi")
+subdirs("tools/ggg")
@@ -0,0 +1,41 @@
+
+####### Expanded from @PACKAGE_INIT@ by configure_package_config_file() #######
+####### Any changes to this file will be overwritten by the next CMake run ####
+####### The input file was GameGraphGymConfig.cmake.in                            ########
+
+get_filename_component(PACKAGE_PREFIX_DIR "${CMAKE_CURRENT_LIST_DIR}/../../../" ABSOLUTE)
+
+macro(set_and_check _var _file)
+  set(${_var} "${_file}")
+  if(NOT EXISTS "${_file}")
+    message(FATAL_ERROR "File or directory ${_file} referenced by variable ${_var} does not exist !")
+  endif()
+endmacro()
+
+macro(check_required_components _NAME)
+  foreach(comp ${${_NAME}_FIND_COMPONENTS})
+    if(NOT ${_NAME}_${comp}_FOUND)
+      if(${_NAME}_FIND_REQUIRED_${comp})
+        set(${_NAME}_FOUND FALSE)
+      endif()
+    endif()
+  endforeach()
+endmacro()
+
+####################################################################################
+
+include(CMakeFindDependencyMacro)
+
+# Find required dependencies
+find_dependency(Boost REQUIRED COMPONENTS graph CONFIG)
+find_dependency(Threads REQUIRED)
+
+# Include targets
+include("${CMAKE_CURRENT_LIST_DIR}/GameGraphGymTargets.cmake")
+
+# Set variables for compatibility
+set(GameGraphGym_LIBRARIES GameGraphGym::ggg)
+set(GameGraphGym_INCLUDE_DIRS 
+    $<TARGET_PROPERTY:GameGraphGym::ggg,INTERFACE_INCLUDE_DIRECTORIES>)
+
+check_required_components(GameGraphGym)
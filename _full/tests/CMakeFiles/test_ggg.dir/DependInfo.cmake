@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libggg/discounted/solvers/strategy_improvement.cpp" "tests/CMakeFiles/test_ggg.dir/__/src/libggg/discounted/solvers/strategy_improvement.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/__/src/libggg/discounted/solvers/strategy_improvement.cpp.o.d"
+  "/root/repo/src/libggg/discounted/solvers/value.cpp" "tests/CMakeFiles/test_ggg.dir/__/src/libggg/discounted/solvers/value.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/__/src/libggg/discounted/solvers/value.cpp.o.d"
+  "/root/repo/src/libggg/mean_payoff/solvers/energy.cpp" "tests/CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/energy.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/energy.cpp.o.d"
+  "/root/repo/src/libggg/mean_payoff/solvers/msca.cpp" "tests/CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/msca.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/msca.cpp.o.d"
+  "/root/repo/src/libggg/mean_payoff/solvers/mse.cpp" "tests/CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/mse.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/mse.cpp.o.d"
+  "/root/repo/src/libggg/mean_payoff/solvers/strategy_improvement.cpp" "tests/CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/strategy_improvement.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/strategy_improvement.cpp.o.d"
+  "/root/repo/src/libggg/mean_payoff/solvers/zwick_paterson.cpp" "tests/CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/zwick_paterson.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/zwick_paterson.cpp.o.d"
+  "/root/repo/tests/libggg/discounted/test_solvers.cpp" "tests/CMakeFiles/test_ggg.dir/libggg/discounted/test_solvers.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/libggg/discounted/test_solvers.cpp.o.d"
+  "/root/repo/tests/libggg/graphs/test_csr_utilities.cpp" "tests/CMakeFiles/test_ggg.dir/libggg/graphs/test_csr_utilities.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/libggg/graphs/test_csr_utilities.cpp.o.d"
+  "/root/repo/tests/libggg/graphs/test_discounted_graph.cpp" "tests/CMakeFiles/test_ggg.dir/libggg/graphs/test_discounted_graph.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/libggg/graphs/test_discounted_graph.cpp.o.d"
+  "/root/repo/tests/libggg/graphs/test_mean_payoff_graph.cpp" "tests/CMakeFiles/test_ggg.dir/libggg/graphs/test_mean_payoff_graph.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/libggg/graphs/test_mean_payoff_graph.cpp.o.d"
+  "/root/repo/tests/libggg/graphs/test_parity_graph.cpp" "tests/CMakeFiles/test_ggg.dir/libggg/graphs/test_parity_graph.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/libggg/graphs/test_parity_graph.cpp.o.d"
+  "/root/repo/tests/libggg/graphs/test_parser.cpp" "tests/CMakeFiles/test_ggg.dir/libggg/graphs/test_parser.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/libggg/graphs/test_parser.cpp.o.d"
+  "/root/repo/tests/libggg/graphs/test_player_utilities.cpp" "tests/CMakeFiles/test_ggg.dir/libggg/graphs/test_player_utilities.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/libggg/graphs/test_player_utilities.cpp.o.d"
+  "/root/repo/tests/libggg/graphs/test_priority_utilities.cpp" "tests/CMakeFiles/test_ggg.dir/libggg/graphs/test_priority_utilities.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/libggg/graphs/test_priority_utilities.cpp.o.d"
+  "/root/repo/tests/libggg/graphs/test_stochastic_discounted_graph.cpp" "tests/CMakeFiles/test_ggg.dir/libggg/graphs/test_stochastic_discounted_graph.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/libggg/graphs/test_stochastic_discounted_graph.cpp.o.d"
+  "/root/repo/tests/libggg/mean_payoff/test_solvers.cpp" "tests/CMakeFiles/test_ggg.dir/libggg/mean_payoff/test_solvers.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/libggg/mean_payoff/test_solvers.cpp.o.d"
+  "/root/repo/tests/libggg/solutions/test_solutions.cpp" "tests/CMakeFiles/test_ggg.dir/libggg/solutions/test_solutions.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/libggg/solutions/test_solutions.cpp.o.d"
+  "/root/repo/tests/libggg/solvers/test_cancellation.cpp" "tests/CMakeFiles/test_ggg.dir/libggg/solvers/test_cancellation.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/libggg/solvers/test_cancellation.cpp.o.d"
+  "/root/repo/tests/libggg/solvers/test_portfolio.cpp" "tests/CMakeFiles/test_ggg.dir/libggg/solvers/test_portfolio.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/libggg/solvers/test_portfolio.cpp.o.d"
+  "/root/repo/tests/libggg/stochastic_discounted/test_engines.cpp" "tests/CMakeFiles/test_ggg.dir/libggg/stochastic_discounted/test_engines.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/libggg/stochastic_discounted/test_engines.cpp.o.d"
+  "/root/repo/tests/libggg/utils/test_fraction.cpp" "tests/CMakeFiles/test_ggg.dir/libggg/utils/test_fraction.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/libggg/utils/test_fraction.cpp.o.d"
+  "/root/repo/tests/libggg/utils/test_profile.cpp" "tests/CMakeFiles/test_ggg.dir/libggg/utils/test_profile.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/libggg/utils/test_profile.cpp.o.d"
+  "/root/repo/tests/libggg/utils/test_revised_simplex.cpp" "tests/CMakeFiles/test_ggg.dir/libggg/utils/test_revised_simplex.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/libggg/utils/test_revised_simplex.cpp.o.d"
+  "/root/repo/tests/main.cpp" "tests/CMakeFiles/test_ggg.dir/main.cpp.o" "gcc" "tests/CMakeFiles/test_ggg.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
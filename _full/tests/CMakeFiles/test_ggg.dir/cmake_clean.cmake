@@ -0,0 +1,59 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_ggg.dir/__/src/libggg/discounted/solvers/strategy_improvement.cpp.o"
+  "CMakeFiles/test_ggg.dir/__/src/libggg/discounted/solvers/strategy_improvement.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/__/src/libggg/discounted/solvers/value.cpp.o"
+  "CMakeFiles/test_ggg.dir/__/src/libggg/discounted/solvers/value.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/energy.cpp.o"
+  "CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/energy.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/msca.cpp.o"
+  "CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/msca.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/mse.cpp.o"
+  "CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/mse.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/strategy_improvement.cpp.o"
+  "CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/strategy_improvement.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/zwick_paterson.cpp.o"
+  "CMakeFiles/test_ggg.dir/__/src/libggg/mean_payoff/solvers/zwick_paterson.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/libggg/discounted/test_solvers.cpp.o"
+  "CMakeFiles/test_ggg.dir/libggg/discounted/test_solvers.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/libggg/graphs/test_csr_utilities.cpp.o"
+  "CMakeFiles/test_ggg.dir/libggg/graphs/test_csr_utilities.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/libggg/graphs/test_discounted_graph.cpp.o"
+  "CMakeFiles/test_ggg.dir/libggg/graphs/test_discounted_graph.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/libggg/graphs/test_mean_payoff_graph.cpp.o"
+  "CMakeFiles/test_ggg.dir/libggg/graphs/test_mean_payoff_graph.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/libggg/graphs/test_parity_graph.cpp.o"
+  "CMakeFiles/test_ggg.dir/libggg/graphs/test_parity_graph.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/libggg/graphs/test_parser.cpp.o"
+  "CMakeFiles/test_ggg.dir/libggg/graphs/test_parser.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/libggg/graphs/test_player_utilities.cpp.o"
+  "CMakeFiles/test_ggg.dir/libggg/graphs/test_player_utilities.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/libggg/graphs/test_priority_utilities.cpp.o"
+  "CMakeFiles/test_ggg.dir/libggg/graphs/test_priority_utilities.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/libggg/graphs/test_stochastic_discounted_graph.cpp.o"
+  "CMakeFiles/test_ggg.dir/libggg/graphs/test_stochastic_discounted_graph.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/libggg/mean_payoff/test_solvers.cpp.o"
+  "CMakeFiles/test_ggg.dir/libggg/mean_payoff/test_solvers.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/libggg/solutions/test_solutions.cpp.o"
+  "CMakeFiles/test_ggg.dir/libggg/solutions/test_solutions.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/libggg/solvers/test_cancellation.cpp.o"
+  "CMakeFiles/test_ggg.dir/libggg/solvers/test_cancellation.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/libggg/solvers/test_portfolio.cpp.o"
+  "CMakeFiles/test_ggg.dir/libggg/solvers/test_portfolio.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/libggg/stochastic_discounted/test_engines.cpp.o"
+  "CMakeFiles/test_ggg.dir/libggg/stochastic_discounted/test_engines.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/libggg/utils/test_fraction.cpp.o"
+  "CMakeFiles/test_ggg.dir/libggg/utils/test_fraction.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/libggg/utils/test_profile.cpp.o"
+  "CMakeFiles/test_ggg.dir/libggg/utils/test_profile.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/libggg/utils/test_revised_simplex.cpp.o"
+  "CMakeFiles/test_ggg.dir/libggg/utils/test_revised_simplex.cpp.o.d"
+  "CMakeFiles/test_ggg.dir/main.cpp.o"
+  "CMakeFiles/test_ggg.dir/main.cpp.o.d"
+  "test_ggg"
+  "test_ggg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ggg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
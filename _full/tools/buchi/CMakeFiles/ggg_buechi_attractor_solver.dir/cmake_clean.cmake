@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ggg_buechi_attractor_solver.dir/__/__/src/libggg/buechi/solvers/attractor.cpp.o"
+  "CMakeFiles/ggg_buechi_attractor_solver.dir/__/__/src/libggg/buechi/solvers/attractor.cpp.o.d"
+  "libggg_buechi_attractor_solver.pdb"
+  "libggg_buechi_attractor_solver.so"
+  "libggg_buechi_attractor_solver.so.1"
+  "libggg_buechi_attractor_solver.so.1.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_buechi_attractor_solver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
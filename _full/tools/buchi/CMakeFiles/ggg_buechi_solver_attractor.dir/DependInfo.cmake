@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/buchi/solvers/attractor.cpp" "tools/buchi/CMakeFiles/ggg_buechi_solver_attractor.dir/solvers/attractor.cpp.o" "gcc" "tools/buchi/CMakeFiles/ggg_buechi_solver_attractor.dir/solvers/attractor.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_full/tools/buchi/CMakeFiles/ggg_buechi_attractor_solver.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
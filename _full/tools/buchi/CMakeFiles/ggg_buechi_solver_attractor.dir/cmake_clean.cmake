@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_buechi_solver_attractor"
+  "../../bin/ggg_buechi_solver_attractor.pdb"
+  "CMakeFiles/ggg_buechi_solver_attractor.dir/solvers/attractor.cpp.o"
+  "CMakeFiles/ggg_buechi_solver_attractor.dir/solvers/attractor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_buechi_solver_attractor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
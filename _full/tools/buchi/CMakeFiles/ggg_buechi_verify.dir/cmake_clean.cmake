@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_buechi_verify"
+  "../../bin/ggg_buechi_verify.pdb"
+  "CMakeFiles/ggg_buechi_verify.dir/verify.cpp.o"
+  "CMakeFiles/ggg_buechi_verify.dir/verify.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_buechi_verify.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/discounted/solvers/strategy_improvement.cpp" "tools/discounted/CMakeFiles/ggg_discounted_solver_strategy_improvement.dir/solvers/strategy_improvement.cpp.o" "gcc" "tools/discounted/CMakeFiles/ggg_discounted_solver_strategy_improvement.dir/solvers/strategy_improvement.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_full/tools/discounted/CMakeFiles/ggg_discounted_strategy_improvement_solver.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
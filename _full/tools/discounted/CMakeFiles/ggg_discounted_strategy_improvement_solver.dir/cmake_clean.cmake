@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ggg_discounted_strategy_improvement_solver.dir/__/__/src/libggg/discounted/solvers/strategy_improvement.cpp.o"
+  "CMakeFiles/ggg_discounted_strategy_improvement_solver.dir/__/__/src/libggg/discounted/solvers/strategy_improvement.cpp.o.d"
+  "libggg_discounted_strategy_improvement_solver.pdb"
+  "libggg_discounted_strategy_improvement_solver.so"
+  "libggg_discounted_strategy_improvement_solver.so.1"
+  "libggg_discounted_strategy_improvement_solver.so.1.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_discounted_strategy_improvement_solver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libggg/discounted/solvers/value.cpp" "tools/discounted/CMakeFiles/ggg_discounted_value_solver.dir/__/__/src/libggg/discounted/solvers/value.cpp.o" "gcc" "tools/discounted/CMakeFiles/ggg_discounted_value_solver.dir/__/__/src/libggg/discounted/solvers/value.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_full/tools/discounted/libggg_discounted_value_solver.so" "/root/repo/_full/tools/discounted/libggg_discounted_value_solver.so.1.0.0"
+  "/root/repo/_full/tools/discounted/libggg_discounted_value_solver.so.1" "/root/repo/_full/tools/discounted/libggg_discounted_value_solver.so.1.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ggg_discounted_value_solver.dir/__/__/src/libggg/discounted/solvers/value.cpp.o"
+  "CMakeFiles/ggg_discounted_value_solver.dir/__/__/src/libggg/discounted/solvers/value.cpp.o.d"
+  "libggg_discounted_value_solver.pdb"
+  "libggg_discounted_value_solver.so"
+  "libggg_discounted_value_solver.so.1"
+  "libggg_discounted_value_solver.so.1.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_discounted_value_solver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
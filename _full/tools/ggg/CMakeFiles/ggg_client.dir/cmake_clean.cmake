@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_client"
+  "../../bin/ggg_client.pdb"
+  "CMakeFiles/ggg_client.dir/client.cpp.o"
+  "CMakeFiles/ggg_client.dir/client.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/ggg/driver.cpp" "tools/ggg/CMakeFiles/ggg_driver.dir/driver.cpp.o" "gcc" "tools/ggg/CMakeFiles/ggg_driver.dir/driver.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_full/tools/ggg/CMakeFiles/ggg_tools_registry.dir/DependInfo.cmake"
+  "/root/repo/_full/tools/parity/CMakeFiles/ggg_parity_portfolio_solver.dir/DependInfo.cmake"
+  "/root/repo/_full/tools/parity/CMakeFiles/ggg_parity_priority_promotion_solver.dir/DependInfo.cmake"
+  "/root/repo/_full/tools/parity/CMakeFiles/ggg_parity_progressive_small_progress_measures_solver.dir/DependInfo.cmake"
+  "/root/repo/_full/tools/parity/CMakeFiles/ggg_parity_recursive_solver.dir/DependInfo.cmake"
+  "/root/repo/_full/tools/buchi/CMakeFiles/ggg_buechi_attractor_solver.dir/DependInfo.cmake"
+  "/root/repo/_full/tools/mean_payoff/CMakeFiles/ggg_mean_payoff_energy_solver.dir/DependInfo.cmake"
+  "/root/repo/_full/tools/mean_payoff/CMakeFiles/ggg_mean_payoff_msca_solver.dir/DependInfo.cmake"
+  "/root/repo/_full/tools/mean_payoff/CMakeFiles/ggg_mean_payoff_mse_solver.dir/DependInfo.cmake"
+  "/root/repo/_full/tools/mean_payoff/CMakeFiles/ggg_mean_payoff_strategy_improvement_solver.dir/DependInfo.cmake"
+  "/root/repo/_full/tools/mean_payoff/CMakeFiles/ggg_mean_payoff_zwick_paterson_solver.dir/DependInfo.cmake"
+  "/root/repo/_full/tools/discounted/CMakeFiles/ggg_discounted_value_solver.dir/DependInfo.cmake"
+  "/root/repo/_full/tools/discounted/CMakeFiles/ggg_discounted_strategy_improvement_solver.dir/DependInfo.cmake"
+  "/root/repo/_full/tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_objective_solver.dir/DependInfo.cmake"
+  "/root/repo/_full/tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_strategy_solver.dir/DependInfo.cmake"
+  "/root/repo/_full/tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_value_solver.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
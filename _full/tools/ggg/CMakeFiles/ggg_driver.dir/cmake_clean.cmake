@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg"
+  "../../bin/ggg.pdb"
+  "CMakeFiles/ggg_driver.dir/driver.cpp.o"
+  "CMakeFiles/ggg_driver.dir/driver.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_driver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
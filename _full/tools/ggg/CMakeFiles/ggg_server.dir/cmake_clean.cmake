@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_server"
+  "../../bin/ggg_server.pdb"
+  "CMakeFiles/ggg_server.dir/server.cpp.o"
+  "CMakeFiles/ggg_server.dir/server.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
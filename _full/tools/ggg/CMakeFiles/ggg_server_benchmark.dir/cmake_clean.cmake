@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_server_benchmark"
+  "../../bin/ggg_server_benchmark.pdb"
+  "CMakeFiles/ggg_server_benchmark.dir/benchmark.cpp.o"
+  "CMakeFiles/ggg_server_benchmark.dir/benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_server_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
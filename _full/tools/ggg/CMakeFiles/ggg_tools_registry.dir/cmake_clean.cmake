@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ggg_tools_registry.dir/registry.cpp.o"
+  "CMakeFiles/ggg_tools_registry.dir/registry.cpp.o.d"
+  "libggg_tools_registry.a"
+  "libggg_tools_registry.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_tools_registry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
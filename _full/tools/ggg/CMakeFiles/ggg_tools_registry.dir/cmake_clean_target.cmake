@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libggg_tools_registry.a"
+)
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tools/ggg
+# Build directory: /root/repo/_full/tools/ggg
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ggg_server_malformed_request "/usr/bin/cmake" "-DSERVER=/root/repo/_full/bin/ggg_server" "-DREQUEST=not json" "-DEXPECT=^\\{\"id\": null, \"error\": \"invalid request: [^
+]+\"\\}
+\$" "-P" "/root/repo/tests/tools/server_request.cmake")
+set_tests_properties(ggg_server_malformed_request PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tools/ggg/CMakeLists.txt;75;add_test;/root/repo/tools/ggg/CMakeLists.txt;0;")
+add_test(ggg_server_list_request "/usr/bin/cmake" "-DSERVER=/root/repo/_full/bin/ggg_server" "-DREQUEST={\"id\": 1, \"list\": true}" "-DEXPECT=^\\{\"id\": 1, \"solvers\": \\{.*\"mean_payoff\"" "-P" "/root/repo/tests/tools/server_request.cmake")
+set_tests_properties(ggg_server_list_request PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tools/ggg/CMakeLists.txt;79;add_test;/root/repo/tools/ggg/CMakeLists.txt;0;")
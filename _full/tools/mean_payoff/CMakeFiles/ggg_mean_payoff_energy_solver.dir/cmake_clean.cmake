@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ggg_mean_payoff_energy_solver.dir/__/__/src/libggg/mean_payoff/solvers/energy.cpp.o"
+  "CMakeFiles/ggg_mean_payoff_energy_solver.dir/__/__/src/libggg/mean_payoff/solvers/energy.cpp.o.d"
+  "libggg_mean_payoff_energy_solver.pdb"
+  "libggg_mean_payoff_energy_solver.so"
+  "libggg_mean_payoff_energy_solver.so.1"
+  "libggg_mean_payoff_energy_solver.so.1.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_mean_payoff_energy_solver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_mean_payoff_generate"
+  "../../bin/ggg_mean_payoff_generate.pdb"
+  "CMakeFiles/ggg_mean_payoff_generate.dir/generate.cpp.o"
+  "CMakeFiles/ggg_mean_payoff_generate.dir/generate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_mean_payoff_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libggg/mean_payoff/solvers/mse.cpp" "tools/mean_payoff/CMakeFiles/ggg_mean_payoff_mse_solver.dir/__/__/src/libggg/mean_payoff/solvers/mse.cpp.o" "gcc" "tools/mean_payoff/CMakeFiles/ggg_mean_payoff_mse_solver.dir/__/__/src/libggg/mean_payoff/solvers/mse.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_full/tools/mean_payoff/libggg_mean_payoff_mse_solver.so" "/root/repo/_full/tools/mean_payoff/libggg_mean_payoff_mse_solver.so.1.0.0"
+  "/root/repo/_full/tools/mean_payoff/libggg_mean_payoff_mse_solver.so.1" "/root/repo/_full/tools/mean_payoff/libggg_mean_payoff_mse_solver.so.1.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
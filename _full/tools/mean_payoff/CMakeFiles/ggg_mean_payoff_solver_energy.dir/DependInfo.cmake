@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/mean_payoff/solvers/energy.cpp" "tools/mean_payoff/CMakeFiles/ggg_mean_payoff_solver_energy.dir/solvers/energy.cpp.o" "gcc" "tools/mean_payoff/CMakeFiles/ggg_mean_payoff_solver_energy.dir/solvers/energy.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_full/tools/mean_payoff/CMakeFiles/ggg_mean_payoff_energy_solver.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_mean_payoff_solver_energy"
+  "../../bin/ggg_mean_payoff_solver_energy.pdb"
+  "CMakeFiles/ggg_mean_payoff_solver_energy.dir/solvers/energy.cpp.o"
+  "CMakeFiles/ggg_mean_payoff_solver_energy.dir/solvers/energy.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_mean_payoff_solver_energy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
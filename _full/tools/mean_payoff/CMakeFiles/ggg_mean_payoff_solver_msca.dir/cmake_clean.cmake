@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_mean_payoff_solver_msca"
+  "../../bin/ggg_mean_payoff_solver_msca.pdb"
+  "CMakeFiles/ggg_mean_payoff_solver_msca.dir/solvers/msca.cpp.o"
+  "CMakeFiles/ggg_mean_payoff_solver_msca.dir/solvers/msca.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_mean_payoff_solver_msca.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_mean_payoff_solver_msca_values"
+  "../../bin/ggg_mean_payoff_solver_msca_values.pdb"
+  "CMakeFiles/ggg_mean_payoff_solver_msca_values.dir/solvers/msca_values.cpp.o"
+  "CMakeFiles/ggg_mean_payoff_solver_msca_values.dir/solvers/msca_values.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_mean_payoff_solver_msca_values.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
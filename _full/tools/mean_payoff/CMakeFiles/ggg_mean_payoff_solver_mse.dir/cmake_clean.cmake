@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_mean_payoff_solver_mse"
+  "../../bin/ggg_mean_payoff_solver_mse.pdb"
+  "CMakeFiles/ggg_mean_payoff_solver_mse.dir/solvers/mse.cpp.o"
+  "CMakeFiles/ggg_mean_payoff_solver_mse.dir/solvers/mse.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_mean_payoff_solver_mse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
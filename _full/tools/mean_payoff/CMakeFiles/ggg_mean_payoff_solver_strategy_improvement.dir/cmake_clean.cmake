@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_mean_payoff_solver_strategy_improvement"
+  "../../bin/ggg_mean_payoff_solver_strategy_improvement.pdb"
+  "CMakeFiles/ggg_mean_payoff_solver_strategy_improvement.dir/solvers/strategy_improvement.cpp.o"
+  "CMakeFiles/ggg_mean_payoff_solver_strategy_improvement.dir/solvers/strategy_improvement.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_mean_payoff_solver_strategy_improvement.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
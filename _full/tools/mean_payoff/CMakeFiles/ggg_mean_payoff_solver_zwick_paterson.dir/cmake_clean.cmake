@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_mean_payoff_solver_zwick_paterson"
+  "../../bin/ggg_mean_payoff_solver_zwick_paterson.pdb"
+  "CMakeFiles/ggg_mean_payoff_solver_zwick_paterson.dir/solvers/zwick_paterson.cpp.o"
+  "CMakeFiles/ggg_mean_payoff_solver_zwick_paterson.dir/solvers/zwick_paterson.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_mean_payoff_solver_zwick_paterson.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_mean_payoff_verify"
+  "../../bin/ggg_mean_payoff_verify.pdb"
+  "CMakeFiles/ggg_mean_payoff_verify.dir/verify.cpp.o"
+  "CMakeFiles/ggg_mean_payoff_verify.dir/verify.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_mean_payoff_verify.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
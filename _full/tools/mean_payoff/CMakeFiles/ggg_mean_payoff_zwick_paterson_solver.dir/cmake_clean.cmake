@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ggg_mean_payoff_zwick_paterson_solver.dir/__/__/src/libggg/mean_payoff/solvers/zwick_paterson.cpp.o"
+  "CMakeFiles/ggg_mean_payoff_zwick_paterson_solver.dir/__/__/src/libggg/mean_payoff/solvers/zwick_paterson.cpp.o.d"
+  "libggg_mean_payoff_zwick_paterson_solver.pdb"
+  "libggg_mean_payoff_zwick_paterson_solver.so"
+  "libggg_mean_payoff_zwick_paterson_solver.so.1"
+  "libggg_mean_payoff_zwick_paterson_solver.so.1.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_mean_payoff_zwick_paterson_solver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_parity_generate"
+  "../../bin/ggg_parity_generate.pdb"
+  "CMakeFiles/ggg_parity_generate.dir/generate.cpp.o"
+  "CMakeFiles/ggg_parity_generate.dir/generate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_parity_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ggg_parity_progressive_small_progress_measures_solver.dir/__/__/src/libggg/parity/solvers/progressive_small_progress_measures.cpp.o"
+  "CMakeFiles/ggg_parity_progressive_small_progress_measures_solver.dir/__/__/src/libggg/parity/solvers/progressive_small_progress_measures.cpp.o.d"
+  "libggg_parity_progressive_small_progress_measures_solver.pdb"
+  "libggg_parity_progressive_small_progress_measures_solver.so"
+  "libggg_parity_progressive_small_progress_measures_solver.so.1"
+  "libggg_parity_progressive_small_progress_measures_solver.so.1.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_parity_progressive_small_progress_measures_solver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
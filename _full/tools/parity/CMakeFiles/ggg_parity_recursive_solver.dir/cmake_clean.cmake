@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ggg_parity_recursive_solver.dir/__/__/src/libggg/parity/solvers/recursive.cpp.o"
+  "CMakeFiles/ggg_parity_recursive_solver.dir/__/__/src/libggg/parity/solvers/recursive.cpp.o.d"
+  "libggg_parity_recursive_solver.pdb"
+  "libggg_parity_recursive_solver.so"
+  "libggg_parity_recursive_solver.so.1"
+  "libggg_parity_recursive_solver.so.1.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_parity_recursive_solver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/parity/solvers/portfolio.cpp" "tools/parity/CMakeFiles/ggg_parity_solver_portfolio.dir/solvers/portfolio.cpp.o" "gcc" "tools/parity/CMakeFiles/ggg_parity_solver_portfolio.dir/solvers/portfolio.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_full/tools/parity/CMakeFiles/ggg_parity_portfolio_solver.dir/DependInfo.cmake"
+  "/root/repo/_full/tools/parity/CMakeFiles/ggg_parity_priority_promotion_solver.dir/DependInfo.cmake"
+  "/root/repo/_full/tools/parity/CMakeFiles/ggg_parity_progressive_small_progress_measures_solver.dir/DependInfo.cmake"
+  "/root/repo/_full/tools/parity/CMakeFiles/ggg_parity_recursive_solver.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_parity_solver_portfolio"
+  "../../bin/ggg_parity_solver_portfolio.pdb"
+  "CMakeFiles/ggg_parity_solver_portfolio.dir/solvers/portfolio.cpp.o"
+  "CMakeFiles/ggg_parity_solver_portfolio.dir/solvers/portfolio.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_parity_solver_portfolio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
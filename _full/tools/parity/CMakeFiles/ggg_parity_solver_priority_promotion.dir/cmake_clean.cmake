@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_parity_solver_priority_promotion"
+  "../../bin/ggg_parity_solver_priority_promotion.pdb"
+  "CMakeFiles/ggg_parity_solver_priority_promotion.dir/solvers/priority_promotion.cpp.o"
+  "CMakeFiles/ggg_parity_solver_priority_promotion.dir/solvers/priority_promotion.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_parity_solver_priority_promotion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
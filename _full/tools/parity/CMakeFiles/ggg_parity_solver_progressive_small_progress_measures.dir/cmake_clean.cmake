@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_parity_solver_progressive_small_progress_measures"
+  "../../bin/ggg_parity_solver_progressive_small_progress_measures.pdb"
+  "CMakeFiles/ggg_parity_solver_progressive_small_progress_measures.dir/solvers/progressive_small_progress_measures.cpp.o"
+  "CMakeFiles/ggg_parity_solver_progressive_small_progress_measures.dir/solvers/progressive_small_progress_measures.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_parity_solver_progressive_small_progress_measures.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
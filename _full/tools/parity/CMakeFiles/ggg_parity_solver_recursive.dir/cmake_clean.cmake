@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_parity_solver_recursive"
+  "../../bin/ggg_parity_solver_recursive.pdb"
+  "CMakeFiles/ggg_parity_solver_recursive.dir/solvers/recursive.cpp.o"
+  "CMakeFiles/ggg_parity_solver_recursive.dir/solvers/recursive.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_parity_solver_recursive.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
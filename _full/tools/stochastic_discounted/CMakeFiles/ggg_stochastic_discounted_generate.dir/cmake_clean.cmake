@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_stochastic_discounted_generate"
+  "../../bin/ggg_stochastic_discounted_generate.pdb"
+  "CMakeFiles/ggg_stochastic_discounted_generate.dir/generate.cpp.o"
+  "CMakeFiles/ggg_stochastic_discounted_generate.dir/generate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_stochastic_discounted_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_stochastic_discounted_numeric_benchmark"
+  "../../bin/ggg_stochastic_discounted_numeric_benchmark.pdb"
+  "CMakeFiles/ggg_stochastic_discounted_numeric_benchmark.dir/numeric_benchmark.cpp.o"
+  "CMakeFiles/ggg_stochastic_discounted_numeric_benchmark.dir/numeric_benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_stochastic_discounted_numeric_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
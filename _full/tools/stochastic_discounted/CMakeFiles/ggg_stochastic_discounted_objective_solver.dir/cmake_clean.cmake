@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ggg_stochastic_discounted_objective_solver.dir/__/__/src/libggg/stochastic_discounted/solvers/objective.cpp.o"
+  "CMakeFiles/ggg_stochastic_discounted_objective_solver.dir/__/__/src/libggg/stochastic_discounted/solvers/objective.cpp.o.d"
+  "libggg_stochastic_discounted_objective_solver.pdb"
+  "libggg_stochastic_discounted_objective_solver.so"
+  "libggg_stochastic_discounted_objective_solver.so.1"
+  "libggg_stochastic_discounted_objective_solver.so.1.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_stochastic_discounted_objective_solver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
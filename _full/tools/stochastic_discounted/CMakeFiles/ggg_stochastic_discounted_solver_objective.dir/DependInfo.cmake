@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/stochastic_discounted/solvers/objective.cpp" "tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_solver_objective.dir/solvers/objective.cpp.o" "gcc" "tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_solver_objective.dir/solvers/objective.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_full/tools/stochastic_discounted/CMakeFiles/ggg_stochastic_discounted_objective_solver.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
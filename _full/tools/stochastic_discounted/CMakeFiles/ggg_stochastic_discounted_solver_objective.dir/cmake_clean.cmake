@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_stochastic_discounted_solver_objective"
+  "../../bin/ggg_stochastic_discounted_solver_objective.pdb"
+  "CMakeFiles/ggg_stochastic_discounted_solver_objective.dir/solvers/objective.cpp.o"
+  "CMakeFiles/ggg_stochastic_discounted_solver_objective.dir/solvers/objective.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_stochastic_discounted_solver_objective.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
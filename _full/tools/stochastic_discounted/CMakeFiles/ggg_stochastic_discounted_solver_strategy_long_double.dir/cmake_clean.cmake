@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_stochastic_discounted_solver_strategy_long_double"
+  "../../bin/ggg_stochastic_discounted_solver_strategy_long_double.pdb"
+  "CMakeFiles/ggg_stochastic_discounted_solver_strategy_long_double.dir/solvers/strategy.cpp.o"
+  "CMakeFiles/ggg_stochastic_discounted_solver_strategy_long_double.dir/solvers/strategy.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_stochastic_discounted_solver_strategy_long_double.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_stochastic_discounted_solver_strategy_rational"
+  "../../bin/ggg_stochastic_discounted_solver_strategy_rational.pdb"
+  "CMakeFiles/ggg_stochastic_discounted_solver_strategy_rational.dir/solvers/strategy.cpp.o"
+  "CMakeFiles/ggg_stochastic_discounted_solver_strategy_rational.dir/solvers/strategy.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_stochastic_discounted_solver_strategy_rational.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_stochastic_discounted_solver_value"
+  "../../bin/ggg_stochastic_discounted_solver_value.pdb"
+  "CMakeFiles/ggg_stochastic_discounted_solver_value.dir/solvers/value.cpp.o"
+  "CMakeFiles/ggg_stochastic_discounted_solver_value.dir/solvers/value.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_stochastic_discounted_solver_value.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ggg_stochastic_discounted_solver_value_float"
+  "../../bin/ggg_stochastic_discounted_solver_value_float.pdb"
+  "CMakeFiles/ggg_stochastic_discounted_solver_value_float.dir/solvers/value.cpp.o"
+  "CMakeFiles/ggg_stochastic_discounted_solver_value_float.dir/solvers/value.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ggg_stochastic_discounted_solver_value_float.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
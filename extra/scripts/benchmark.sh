@@ -4,7 +4,7 @@
 # No dependencies or libraries required beyond standard shell tools.
 # Supports flat game directories and type-based subdirectories.
 # Usage:
-#   bash benchmark.sh <games_dir> <solver_dir> [--time TIMEOUT_SECONDS] [-o OUTPUT_FILE] [--solvers NAME1,NAME2,...]
+#   bash benchmark.sh <games_dir> <solver_dir> [--time TIMEOUT_SECONDS] [-o OUTPUT_FILE] [--profile] [--repeat N] [--warmup K] [--pin-cpu CPU] [--prefault] [--solvers NAME1,NAME2,...]
 # If no solver names are provided, prompts the user to choose solvers from the selected directory.
 
 set -eu
@@ -23,14 +23,21 @@ selected_solver_count=0
 solvers_dir=""
 timeout_sec=300
 output_file="$script_dir/results.json"
+profile=0
+declare -a solver_args=()
 
 usage() {
   cat >&2 <<EOF
-Usage: $0 <games_dir> <solver_dir> [--time TIMEOUT_SECONDS] [-o OUTPUT_FILE] [--solver NAME]... [--solvers NAME1,NAME2,...]
+Usage: $0 <games_dir> <solver_dir> [--time TIMEOUT_SECONDS] [-o OUTPUT_FILE] [--profile] [--repeat N] [--warmup K] [--pin-cpu CPU] [--prefault] [--solver NAME]... [--solvers NAME1,NAME2,...]
 
 Options:
   --time SECONDS     Timeout per solver run (default: 300)
   -o, --output FILE  Output JSON file (default: $output_file)
+  --profile          Record the solvers' --profile breakdown (phase times, peak memory, statistics)
+  --repeat N         Solve each game N times in one solver process and record the median time
+  --warmup K         Untimed solves before the timed ones
+  --pin-cpu CPU      Run the solvers on this CPU only
+  --prefault         Keep memory faulted in by earlier solves for later ones
   --solver NAME      Select a solver by name; may be repeated
   --solvers LIST     Select comma-separated solver names
   -h, --help         Show this help message
@@ -172,6 +179,23 @@ while [ $# -gt 0 ]; do
       output_file="$2"
       shift 2
       ;;
+    --profile)
+      profile=1
+      shift
+      ;;
+    --repeat|--warmup|--pin-cpu)
+      [ $# -ge 2 ] || {
+        echo "Missing value for $1" >&2
+        usage
+        exit 1
+      }
+      solver_args+=("$1" "$2")
+      shift 2
+      ;;
+    --prefault)
+      solver_args+=("$1")
+      shift
+      ;;
     --solver)
       [ $# -ge 2 ] || {
         echo "Missing value for --solver" >&2
@@ -316,6 +340,12 @@ collect_solvers() {
   fi
 }
 
+# Record printed by a solver run with --time-only --profile --format json
+profile_record() {
+  local output="$1"
+  printf "%s\n" "$output" | grep '"profile": ' | tail -n 1 | sed 's/.*"profile": \(.*\)}$/\1/'
+}
+
 # Solver execution function
 run_solver() {
   local solver_path="$1" game="$2" type="$3"
@@ -328,8 +358,14 @@ run_solver() {
   vertices=$1
   edges=$2
 
+  if [ $profile -eq 1 ]; then
+    set -- --time-only --profile --format json
+  else
+    set -- --time-only
+  fi
+
   start=$(date +%s.%N)
-  if output=$(timeout "$timeout_sec" "$solver_path" --time-only "$game" 2>&1); then
+  if output=$(timeout "$timeout_sec" "$solver_path" "$@" ${solver_args[@]+"${solver_args[@]}"} "$game" 2>&1); then
     end=$(date +%s.%N)
     elapsed=$(echo "$end - $start" | bc)
     elapsed=$(normalize_decimal "$elapsed")
@@ -349,9 +385,18 @@ run_solver() {
   [ $first -eq 0 ] && results+=",\n"
   first=0
 
-  json="  {\"solver\":\"$solver\",\"game\":\"$game_name\""
-  [ -n "$type" ] && json+=",\"type\":\"$type\""
-  json+=",\"status\":\"$status\",\"time\":$time_val,\"vertices\":$vertices,\"edges\":$edges,\"timestamp\":$(date +%s)}"
+  record=""
+  [ $profile -eq 1 ] && [ "$status" = "success" ] && record=$(profile_record "$output")
+  if [ -n "$record" ]; then
+    # The solver's own record, with the fields only the runner knows
+    json="  ${record%\}}"
+    [ -n "$type" ] && json+=",\"type\":\"$type\""
+    json+=",\"timestamp\":$(date +%s)}"
+  else
+    json="  {\"solver\":\"$solver\",\"game\":\"$game_name\""
+    [ -n "$type" ] && json+=",\"type\":\"$type\""
+    json+=",\"status\":\"$status\",\"time\":$time_val,\"vertices\":$vertices,\"edges\":$edges,\"timestamp\":$(date +%s)}"
+  fi
   results+="$json"
 
   echo "Processed $game_name with $solver ($status)"
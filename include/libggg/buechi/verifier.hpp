@@ -0,0 +1,79 @@
+#pragma once
+
+#include "libggg/graphs/csr_utilities.hpp"
+#include "libggg/parity/graph.hpp"
+#include "libggg/solutions/verification.hpp"
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace ggg {
+namespace buechi {
+
+/**
+ * @brief Check a Büchi game solution without solving the game again
+ *
+ * Büchi games are parity graphs whose accepting vertices have priority 1;
+ * as in a parity game, player 1 wins the plays that visit them infinitely
+ * often.  After the closure check (see solutions::check_closure), the
+ * one-player game left in player 0's region must have no cycle through an
+ * accepting vertex, and the one in player 1's region no cycle avoiding them.
+ * Both are one strongly-connected-component pass, run in parallel over
+ * components.
+ *
+ * @param solution Anything with get_winning_player, has_strategy and
+ *        get_strategy, e.g. a solver's RSSolution or a binary::BinarySolution
+ * @param threads Worker threads, 0 for ggg::utils::thread_count()
+ */
+template <typename SolutionType>
+solutions::Verification verify(const parity::graph::Graph &graph, const SolutionType &solution, unsigned threads = 0) {
+    solutions::InducedGame game;
+    if (auto closure = solutions::check_closure(graph, solution, game, threads); !closure) {
+        return closure;
+    }
+    const auto accepting = [&](std::size_t v) { return graph[v].priority == 1; };
+
+    // Player 1's region: removing the accepting vertices must leave it acyclic.
+    auto result = solutions::check_cyclic_components(
+        game, 1,
+        [&](const graphs::csr_utilities::CompressedAdjacency &local, std::span<const std::size_t> members) -> std::optional<std::string> {
+            std::vector<std::size_t> rejecting;
+            for (std::size_t v = 0; v < members.size(); ++v) {
+                if (!accepting(members[v])) {
+                    rejecting.push_back(v);
+                }
+            }
+            std::optional<std::string> reason;
+            graphs::csr_utilities::StrongComponents scc(local);
+            scc.run(rejecting, [&](std::size_t v) { return !accepting(members[v]); },
+                    [&](std::span<const std::size_t> component, bool cyclic) {
+                        if (cyclic && !reason) {
+                            reason = "player 0 can avoid accepting vertices forever from '" + graph[members[component.front()]].name +
+                                     "' in the winning region of player 1";
+                        }
+                    });
+            return reason;
+        },
+        threads);
+    if (!result) {
+        return result;
+    }
+
+    // Player 0's region: no cycle may contain an accepting vertex.
+    return solutions::check_cyclic_components(
+        game, 0,
+        [&](const graphs::csr_utilities::CompressedAdjacency &, std::span<const std::size_t> members) -> std::optional<std::string> {
+            for (const std::size_t v : members) {
+                if (accepting(v)) {
+                    return "player 1 can visit the accepting vertex '" + graph[v].name +
+                           "' infinitely often in the winning region of player 0";
+                }
+            }
+            return std::nullopt;
+        },
+        threads);
+}
+
+} // namespace buechi
+} // namespace ggg
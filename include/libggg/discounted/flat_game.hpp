@@ -0,0 +1,145 @@
+#pragma once
+
+#include "libggg/discounted/graph.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace ggg {
+namespace discounted {
+
+/**
+ * @brief Deterministic discounted game in flat arrays
+ *
+ * The out-edges of vertex @c v are `[edge_offsets[v], edge_offsets[v + 1])`,
+ * in `boost::out_edges` order.  The value of edge @c e under a valuation x is
+ * `weight[e] + discount[e] · x[target[e]]`; there is no probabilistic closure
+ * to expand, so the game is a plain compressed sparse row (CSR) adjacency.
+ */
+struct FlatGame {
+    std::vector<int> player;               ///< Owner of every vertex
+    std::vector<std::size_t> edge_offsets; ///< Size num_vertices + 1
+    std::vector<std::size_t> target;       ///< Target of every edge
+    std::vector<double> weight;            ///< Weight of every edge
+    std::vector<double> discount;          ///< Discount of every edge
+
+    std::size_t num_vertices() const { return edge_offsets.empty() ? 0 : edge_offsets.size() - 1; }
+    std::size_t num_edges() const { return target.size(); }
+    std::size_t first_edge(std::size_t v) const { return edge_offsets[v]; }
+    std::size_t end_edge(std::size_t v) const { return edge_offsets[v + 1]; }
+
+    /**
+     * @brief Value of edge @p e under the valuation @p values (indexed by vertex)
+     */
+    double value(std::size_t e, const std::vector<double> &values) const {
+        return weight[e] + discount[e] * values[target[e]];
+    }
+
+    /**
+     * @brief Largest discount of any edge
+     */
+    double max_discount() const {
+        return discount.empty() ? 0.0 : *std::max_element(discount.begin(), discount.end());
+    }
+};
+
+/**
+ * @brief Flatten a discounted game into a FlatGame
+ */
+inline FlatGame make_flat_game(const graph::Graph &graph) {
+    const std::size_t n = boost::num_vertices(graph);
+    FlatGame game;
+    game.player.resize(n);
+    game.edge_offsets.assign(1, 0);
+    game.target.reserve(boost::num_edges(graph));
+    game.weight.reserve(boost::num_edges(graph));
+    game.discount.reserve(boost::num_edges(graph));
+    for (std::size_t v = 0; v < n; ++v) {
+        game.player[v] = graph[v].player;
+        const auto [out_begin, out_end] = boost::out_edges(v, graph);
+        for (auto it = out_begin; it != out_end; ++it) {
+            game.target.push_back(boost::target(*it, graph));
+            game.weight.push_back(graph[*it].weight);
+            game.discount.push_back(graph[*it].discount);
+        }
+        game.edge_offsets.push_back(game.target.size());
+    }
+    return game;
+}
+
+/**
+ * @brief Best edge of @p v for its owner under @p values
+ *
+ * @param choice Receives the first best edge (maximal for player 0, minimal
+ *        for player 1)
+ * @return Value of that edge
+ */
+inline double best_edge(const FlatGame &game, std::size_t v, const std::vector<double> &values, std::size_t &choice) {
+    const bool maximise = game.player[v] == 0;
+    choice = game.first_edge(v);
+    double best = game.value(choice, values);
+    for (std::size_t e = choice + 1; e < game.end_edge(v); ++e) {
+        const double value = game.value(e, values);
+        if (maximise ? value > best : value < best) {
+            best = value;
+            choice = e;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Exact values of a positional strategy profile
+ *
+ * Fixing one edge per vertex leaves a functional graph: every vertex reaches
+ * exactly one cycle.  The value of a cycle vertex u is the discounted weight
+ * sum once around the cycle divided by 1 - (product of its discounts); every
+ * other value follows by one backup from its successor.  Each vertex is
+ * visited once, so this takes O(n) time and no linear solver.
+ *
+ * @param profile Chosen edge of every vertex
+ * @param values Receives the value of every vertex
+ */
+inline void evaluate_profile(const FlatGame &game, const std::vector<std::size_t> &profile, std::vector<double> &values) {
+    const std::size_t n = game.num_vertices();
+    enum : unsigned char { Unvisited, OnPath, Done };
+    std::vector<unsigned char> state(n, Unvisited);
+    std::vector<std::size_t> path;
+    values.resize(n);
+    for (std::size_t root = 0; root < n; ++root) {
+        if (state[root] != Unvisited) {
+            continue;
+        }
+        std::size_t v = root;
+        while (state[v] == Unvisited) {
+            state[v] = OnPath;
+            path.push_back(v);
+            v = game.target[profile[v]];
+        }
+        if (state[v] == OnPath) {
+            // v closes a cycle: accumulate weights and discounts once around it.
+            double sum = 0.0;
+            double factor = 1.0;
+            std::size_t u = v;
+            do {
+                const std::size_t e = profile[u];
+                sum += factor * game.weight[e];
+                factor *= game.discount[e];
+                u = game.target[e];
+            } while (u != v);
+            values[v] = sum / (1.0 - factor);
+            state[v] = Done;
+        }
+        while (!path.empty()) {
+            const std::size_t u = path.back();
+            path.pop_back();
+            if (state[u] != Done) {
+                values[u] = game.value(profile[u], values);
+                state[u] = Done;
+            }
+        }
+    }
+}
+
+} // namespace discounted
+} // namespace ggg
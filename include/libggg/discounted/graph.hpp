@@ -0,0 +1,54 @@
+#pragma once
+#include "libggg/graphs/discount_utilities.hpp"
+#include "libggg/graphs/graph_utilities.hpp"
+#include "libggg/graphs/player_utilities.hpp"
+#include "libggg/graphs/validator.hpp"
+
+namespace ggg {
+namespace discounted {
+namespace graph {
+
+// Discounted-payoff graph property field lists
+#define DISCOUNTED_VERTEX_FIELDS(X) \
+    X(std::string, name, "")        \
+    X(int, player, -1)
+
+#define DISCOUNTED_EDGE_FIELDS(X) \
+    X(std::string, label, "")     \
+    X(double, weight, 0.0)        \
+    X(double, discount, 0.0)
+
+#define DISCOUNTED_GRAPH_FIELDS(X) /* none */
+
+// Instantiate Graph/parse/write in ggg::discounted::graph
+DEFINE_GAME_GRAPH(DISCOUNTED_VERTEX_FIELDS, DISCOUNTED_EDGE_FIELDS, DISCOUNTED_GRAPH_FIELDS)
+
+#undef DISCOUNTED_VERTEX_FIELDS
+#undef DISCOUNTED_EDGE_FIELDS
+#undef DISCOUNTED_GRAPH_FIELDS
+
+// Standard validators for discounted-payoff graphs
+using graphs::NoDuplicateEdgesValidator;
+using graphs::OutDegreeValidator;
+using graphs::discount_utilities::DiscountValidator;
+using graphs::player_utilities::PlayerValidator;
+
+/**
+ * @brief Standard composite validator for deterministic discounted-payoff games
+ *
+ * This validator checks:
+ * - Players are either 0 or 1
+ * - All vertices have at least one outgoing edge
+ * - Discount factors on all edges are in (0,1)
+ * - No duplicate edges exist
+ */
+using StandardValidator = graphs::CompositeValidator<
+    Graph,
+    PlayerValidator<0, 1>,
+    OutDegreeValidator<1>,
+    DiscountValidator,
+    NoDuplicateEdgesValidator>;
+
+} // namespace graph
+} // namespace discounted
+} // namespace ggg
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "libggg/discounted/flat_game.hpp"
+#include "libggg/discounted/graph.hpp"
+#include "libggg/solvers/solver.hpp"
+#include <cstddef>
+#include <string>
+
+namespace ggg {
+namespace discounted {
+
+using SISolutionType = ggg::solutions::RSQSolution<graph::Graph>;
+
+/**
+ * @brief Strategy improvement for deterministic discounted-payoff games
+ *
+ * Hoffman-Karp strategy iteration @cite DBLP:journals/or/Howard60 on the
+ * game's FlatGame, warm-started by value iteration.  A few Gauss-Seidel
+ * sweeps from zero give both players' initial strategies; then player 1's
+ * best response to player 0's strategy is found by strategy iteration, and
+ * player 0 switches every vertex with a strictly better edge, until neither
+ * player can improve.  Strategy profiles are evaluated exactly in linear time
+ * by evaluate_profile(), so the reported values are exact up to rounding.
+ *
+ * The solution reports values, winning regions (player 0 wins iff the value
+ * is non-negative) and optimal strategies of both players.
+ */
+class DiscountedStrategyImprovementSolver : public ggg::solvers::Solver<graph::Graph, SISolutionType> {
+  public:
+    /**
+     * @param value_sweeps Maximal number of value iteration sweeps before
+     *        strategy iteration (stopped early once a sweep changes no
+     *        strategy); 0 starts from every vertex's first edge
+     */
+    explicit DiscountedStrategyImprovementSolver(std::size_t value_sweeps = 64) : value_sweeps_(value_sweeps) {}
+
+    auto solve(const graph::Graph &graph) -> SISolutionType override;
+    [[nodiscard]] auto get_name() const -> std::string override { return "Strategy Improvement Discounted Game Solver"; }
+
+  private:
+    std::size_t value_sweeps_;
+};
+
+} // namespace discounted
+} // namespace ggg
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "libggg/discounted/flat_game.hpp"
+#include "libggg/discounted/graph.hpp"
+#include "libggg/solvers/solver.hpp"
+#include <string>
+
+namespace ggg {
+namespace discounted {
+
+using ValueSolutionType = ggg::solutions::RSQSolution<graph::Graph>;
+
+/**
+ * @brief Value iteration for deterministic discounted-payoff games
+ *
+ * Gauss-Seidel value iteration @cite DBLP:journals/pnas/Shapley53 on the
+ * game's FlatGame.  With γ the largest discount, the values after a sweep
+ * that changed no value by more than r are within γ/(1-γ) · r of the game's
+ * values; iteration stops once this bound reaches the requested precision.
+ *
+ * The solution reports values, winning regions (player 0 wins iff the value
+ * is non-negative) and the best edge of every vertex for its owner.
+ */
+class DiscountedValueSolver : public ggg::solvers::Solver<graph::Graph, ValueSolutionType> {
+  public:
+    /**
+     * @param precision Guaranteed maximal error of the values
+     */
+    explicit DiscountedValueSolver(double precision = 1e-9) : precision_(precision) {}
+
+    auto solve(const graph::Graph &graph) -> ValueSolutionType override;
+    [[nodiscard]] auto get_name() const -> std::string override { return "Value Iteration Discounted Game Solver"; }
+
+  private:
+    double precision_;
+};
+
+} // namespace discounted
+} // namespace ggg
@@ -0,0 +1,255 @@
+#pragma once
+
+#include <algorithm>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace ggg {
+namespace graphs {
+namespace csr_utilities {
+
+/**
+ * @brief Compressed sparse row (CSR) view of a graph's adjacency
+ *
+ * Stores the neighbours of every vertex in one contiguous array, indexed by
+ * the vertex index.  The neighbours of vertex @c v are
+ * `targets[offsets[v] .. offsets[v + 1])`, in the order in which Boost
+ * enumerates the corresponding edges.
+ *
+ * Solvers use this layout in their inner loops instead of walking
+ * `boost::out_edges` / `boost::in_edges`, which avoids per-edge iterator
+ * overhead and keeps all per-vertex state in plain vectors.
+ */
+struct CompressedAdjacency {
+    std::vector<std::size_t> offsets; ///< Size num_vertices + 1
+    std::vector<std::size_t> targets; ///< Size num_edges
+
+    /**
+     * @brief Number of vertices covered by this adjacency
+     */
+    std::size_t num_vertices() const {
+        return offsets.empty() ? 0 : offsets.size() - 1;
+    }
+
+    /**
+     * @brief Number of neighbours of vertex @p v
+     */
+    std::size_t degree(std::size_t v) const {
+        return offsets[v + 1] - offsets[v];
+    }
+
+    /**
+     * @brief Contiguous range of neighbour indices of vertex @p v
+     */
+    std::span<const std::size_t> neighbours(std::size_t v) const {
+        return {targets.data() + offsets[v], targets.data() + offsets[v + 1]};
+    }
+};
+
+/**
+ * @brief Build the CSR successor lists of a graph
+ *
+ * Vertex descriptors must be dense indices in `[0, num_vertices)`, which is
+ * the case for every game graph defined through `DEFINE_GAME_GRAPH`
+ * (`boost::vecS` vertex storage).
+ *
+ * @tparam GraphType Boost graph with integral vertex descriptors
+ * @param graph The graph to compress
+ * @return Successor lists; `neighbours(v)` follows `boost::out_edges(v, graph)`
+ */
+template <typename GraphType>
+inline CompressedAdjacency make_successors(const GraphType &graph) {
+    static_assert(std::is_integral_v<typename boost::graph_traits<GraphType>::vertex_descriptor>,
+                  "CSR conversion requires dense integral vertex descriptors");
+
+    const std::size_t n = boost::num_vertices(graph);
+    CompressedAdjacency result;
+    result.offsets.assign(n + 1, 0);
+    result.targets.reserve(boost::num_edges(graph));
+
+    for (std::size_t v = 0; v < n; ++v) {
+        const auto [out_begin, out_end] = boost::out_edges(v, graph);
+        for (auto it = out_begin; it != out_end; ++it) {
+            result.targets.push_back(boost::target(*it, graph));
+        }
+        result.offsets[v + 1] = result.targets.size();
+    }
+    return result;
+}
+
+/**
+ * @brief Build the CSR predecessor lists of a graph
+ *
+ * Only out-edge traversal is required, so this also works on directed
+ * (non-bidirectional) graphs.  Predecessors of each vertex appear in
+ * increasing source order.
+ *
+ * @tparam GraphType Boost graph with integral vertex descriptors
+ * @param graph The graph to compress
+ * @return Predecessor lists; `neighbours(v)` are the sources of edges into v
+ */
+template <typename GraphType>
+inline CompressedAdjacency make_predecessors(const GraphType &graph) {
+    static_assert(std::is_integral_v<typename boost::graph_traits<GraphType>::vertex_descriptor>,
+                  "CSR conversion requires dense integral vertex descriptors");
+
+    const std::size_t n = boost::num_vertices(graph);
+    CompressedAdjacency result;
+    result.offsets.assign(n + 1, 0);
+    result.targets.resize(boost::num_edges(graph));
+
+    // Counting sort by target: count in-degrees, prefix-sum, then scatter.
+    const auto [edges_begin, edges_end] = boost::edges(graph);
+    for (auto it = edges_begin; it != edges_end; ++it) {
+        ++result.offsets[boost::target(*it, graph) + 1];
+    }
+    for (std::size_t v = 0; v < n; ++v) {
+        result.offsets[v + 1] += result.offsets[v];
+    }
+
+    std::vector<std::size_t> cursor(result.offsets.begin(), result.offsets.end() - 1);
+    for (std::size_t v = 0; v < n; ++v) {
+        const auto [out_begin, out_end] = boost::out_edges(v, graph);
+        for (auto it = out_begin; it != out_end; ++it) {
+            result.targets[cursor[boost::target(*it, graph)]++] = v;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Subgraph of @p graph induced by @p vertices, re-indexed locally
+ *
+ * Vertex @c vertices[i] becomes vertex @c i; edges leaving the set are
+ * dropped.  Lookups binary-search @p vertices, so building the subgraph
+ * needs no scratch array of the full graph's size and several subgraphs can
+ * be built concurrently.
+ *
+ * @param vertices Vertices to keep, sorted in increasing order
+ */
+inline CompressedAdjacency make_subgraph(const CompressedAdjacency &graph, std::span<const std::size_t> vertices) {
+    CompressedAdjacency result;
+    result.offsets.assign(1, 0);
+    result.offsets.reserve(vertices.size() + 1);
+    for (const std::size_t v : vertices) {
+        for (const std::size_t u : graph.neighbours(v)) {
+            const auto it = std::lower_bound(vertices.begin(), vertices.end(), u);
+            if (it != vertices.end() && *it == u) {
+                result.targets.push_back(static_cast<std::size_t>(it - vertices.begin()));
+            }
+        }
+        result.offsets.push_back(result.targets.size());
+    }
+    return result;
+}
+
+/**
+ * @brief Strongly connected components of subgraphs of a CSR graph
+ *
+ * Iterative Tarjan with scratch arrays kept between runs, so a graph can be
+ * decomposed many times over shrinking vertex sets (as the parity and
+ * mean-payoff certificate checks do) at a cost proportional to the edges of
+ * each subgraph, not the whole graph.
+ */
+class StrongComponents {
+  public:
+    explicit StrongComponents(const CompressedAdjacency &graph)
+        : graph_(graph), index_(graph.num_vertices(), kNone), low_(graph.num_vertices(), 0) {}
+
+    /**
+     * @brief Decompose the subgraph induced by the vertices with @p in(v) true
+     *
+     * @param roots Vertices to start from; every vertex of the subgraph must
+     *        be reachable from one of them (typically: all of them)
+     * @param in Membership predicate, bool(std::size_t)
+     * @param emit Called once per component, in the order Tarjan completes
+     *        them (reverse topological), as
+     *        `emit(std::span<const std::size_t> members, bool cyclic)`;
+     *        @c cyclic is true if the component contains a cycle, i.e. it has
+     *        several vertices or a self-loop
+     */
+    template <typename In, typename Emit>
+    void run(std::span<const std::size_t> roots, In &&in, Emit &&emit) {
+        std::size_t counter = 0;
+        for (const std::size_t root : roots) {
+            if (!in(root) || index_[root] != kNone) {
+                continue;
+            }
+            open(root, counter);
+            while (!frames_.empty()) {
+                Frame &frame = frames_.back();
+                const std::size_t v = frame.vertex;
+                const auto successors = graph_.neighbours(v);
+                if (frame.next < successors.size()) {
+                    const std::size_t u = successors[frame.next++];
+                    if (!in(u)) {
+                        continue;
+                    }
+                    if (index_[u] == kNone) {
+                        open(u, counter);
+                    } else if (low_[u] != kDone) {
+                        low_[v] = std::min(low_[v], index_[u]);
+                    }
+                    continue;
+                }
+                frames_.pop_back();
+                if (!frames_.empty()) {
+                    const std::size_t parent = frames_.back().vertex;
+                    low_[parent] = std::min(low_[parent], low_[v]);
+                }
+                if (low_[v] == index_[v]) {
+                    const auto first = std::find(stack_.rbegin(), stack_.rend(), v).base() - 1;
+                    const std::span<const std::size_t> members(&*first, static_cast<std::size_t>(stack_.end() - first));
+                    bool cyclic = members.size() > 1;
+                    if (!cyclic) {
+                        const auto successors_of_v = graph_.neighbours(v);
+                        cyclic = std::find(successors_of_v.begin(), successors_of_v.end(), v) != successors_of_v.end();
+                    }
+                    emit(members, cyclic);
+                    for (const std::size_t u : members) {
+                        low_[u] = kDone;
+                    }
+                    stack_.erase(first, stack_.end());
+                }
+            }
+        }
+        // Reset the scratch entries this run touched.
+        for (const std::size_t v : touched_) {
+            index_[v] = kNone;
+            low_[v] = 0;
+        }
+        touched_.clear();
+    }
+
+  private:
+    static constexpr std::size_t kNone = std::numeric_limits<std::size_t>::max();
+    static constexpr std::size_t kDone = std::numeric_limits<std::size_t>::max();
+
+    struct Frame {
+        std::size_t vertex;
+        std::size_t next;
+    };
+
+    const CompressedAdjacency &graph_;
+    std::vector<std::size_t> index_;
+    std::vector<std::size_t> low_;
+    std::vector<std::size_t> stack_;
+    std::vector<std::size_t> touched_;
+    std::vector<Frame> frames_;
+
+    void open(std::size_t v, std::size_t &counter) {
+        index_[v] = low_[v] = counter++;
+        stack_.push_back(v);
+        touched_.push_back(v);
+        frames_.push_back({v, 0});
+    }
+};
+
+} // namespace csr_utilities
+} // namespace graphs
+} // namespace ggg
@@ -0,0 +1,296 @@
+#pragma once
+
+#include "libggg/graphs/csr_utilities.hpp"
+#include "libggg/mean_payoff/verifier.hpp"
+#include "libggg/solvers/cancellation.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace ggg {
+namespace mean_payoff {
+
+/**
+ * @brief Credit needed at a vertex of weight @p weight to move to a successor needing @p credit
+ *
+ * Both credits are capped at @p top, which stands for "no finite credit suffices".
+ */
+inline long long required_credit(long long credit, long long weight, long long top) {
+    return credit >= top ? top : std::min(std::max(0LL, credit - weight), top);
+}
+
+/**
+ * @brief Saturation bound ⊤ of the energy progress measure: 1 + Σ max(0, -w(v))
+ *
+ * No finite minimal credit exceeds the sum of the negative weights.
+ * @throws std::overflow_error if the bound does not fit in 64 bits
+ */
+inline long long energy_top(const std::vector<long long> &weight) {
+    long long top = 1;
+    for (const long long w : weight) {
+        if (w < 0 && __builtin_sub_overflow(top, w, &top)) {
+            throw std::overflow_error("energy progress measure bound exceeds 64 bits");
+        }
+    }
+    return top;
+}
+
+/**
+ * @brief Lift @p credit to the least energy progress measure above it
+ *
+ * Vertex weights are collected when a vertex is visited: a player 0 vertex
+ * needs to cover required_credit() of one successor, a player 1 vertex of
+ * all of them.  Runs the small energy progress measure lifting algorithm of
+ * @cite DBLP:journals/fmsd/BrimCDGR11, counting for every player 0 vertex the
+ * successors its credit covers, so it is only revisited once none is left.
+ * Credits start from @p credit (0 for the least measure); vertices starting
+ * at @p top stay there, which excludes them from the game.
+ *
+ * @return Number of lifts
+ */
+inline long long lift_energy_measure(const graphs::csr_utilities::CompressedAdjacency &successors,
+                                     const graphs::csr_utilities::CompressedAdjacency &predecessors,
+                                     const std::vector<long long> &weight, const std::vector<char> &is_player1, long long top,
+                                     std::vector<long long> &credit) {
+    const std::size_t n = weight.size();
+    const auto required = [&](std::size_t v, long long c) { return required_credit(c, weight[v], top); };
+
+    // For player 0 vertices: number of successors whose requirement is
+    // already covered by credit[v].  The vertex must be lifted once none is.
+    std::vector<std::size_t> covered(n, 0);
+
+    std::vector<std::size_t> worklist;
+    std::vector<char> queued(n, 0);
+    worklist.reserve(n);
+
+    for (std::size_t v = 0; v < n; ++v) {
+        if (credit[v] >= top) {
+            continue;
+        }
+        std::size_t covers = 0;
+        for (const std::size_t u : successors.neighbours(v)) {
+            covers += required(v, credit[u]) <= credit[v];
+        }
+        if (!is_player1[v]) {
+            covered[v] = covers;
+        }
+        if (is_player1[v] ? covers < successors.degree(v) : covers == 0) {
+            worklist.push_back(v);
+            queued[v] = 1;
+        }
+    }
+
+    long long lifts = 0;
+    while (!worklist.empty()) {
+        ggg::solvers::throw_if_cancelled();
+        const std::size_t v = worklist.back();
+        worklist.pop_back();
+        queued[v] = 0;
+
+        const long long old_credit = credit[v];
+        long long best = is_player1[v] ? 0 : top;
+        for (const std::size_t u : successors.neighbours(v)) {
+            const long long r = required(v, credit[u]);
+            best = is_player1[v] ? std::max(best, r) : std::min(best, r);
+        }
+        if (best > old_credit) {
+            credit[v] = best;
+            lifts++;
+        }
+
+        if (credit[v] != old_credit) {
+            for (const std::size_t p : predecessors.neighbours(v)) {
+                // A player 0 self-loop is accounted for by the recount below.
+                if (queued[p] || credit[p] >= top || (p == v && !is_player1[v])) {
+                    continue;
+                }
+                if (required(p, credit[v]) <= credit[p]) {
+                    continue;
+                }
+                if (is_player1[p]) {
+                    worklist.push_back(p);
+                    queued[p] = 1;
+                } else if (required(p, old_credit) <= credit[p] && --covered[p] == 0) {
+                    worklist.push_back(p);
+                    queued[p] = 1;
+                }
+            }
+        }
+
+        if (!is_player1[v]) {
+            covered[v] = 0;
+            for (const std::size_t u : successors.neighbours(v)) {
+                covered[v] += required(v, credit[u]) <= credit[v];
+            }
+            if (covered[v] == 0 && credit[v] < top && !queued[v]) {
+                worklist.push_back(v);
+                queued[v] = 1;
+            }
+        }
+    }
+    return lifts;
+}
+
+/**
+ * @brief Tell mean payoff > 0 from mean payoff 0 where @p credit is finite
+ *
+ * @p credit must be a least energy progress measure (see
+ * lift_energy_measure()); the vertices below @p top have mean payoff >= 0
+ * and player 1 cannot leave them.  Player 0 starts from successors its
+ * credit covers, under which no cycle has negative weight, so the cycles
+ * player 0 loses are those of weight 0: the cycles of edges tight for
+ * shortest-path potentials, found as in verify().  While player 1 can reach
+ * one, player 0 switches to successors with a longer shortest path to them
+ * (strategy improvement); a switch only closes cycles of positive weight.
+ * Once no switch helps, the vertices still reaching a zero cycle have mean
+ * payoff 0, since player 1 can keep to cycles of weight <= 0 from them.
+ *
+ * @param strategy Set, for the player 0 vertices of mean payoff > 0, to a
+ *        successor such that every cycle player 1 can then close has
+ *        positive weight; @c std::size_t(-1) elsewhere
+ * @return 1 for the vertices of mean payoff > 0
+ */
+inline std::vector<char> positive_mean_payoff(const graphs::csr_utilities::CompressedAdjacency &successors,
+                                              const std::vector<long long> &weight, const std::vector<char> &is_player1,
+                                              long long top, const std::vector<long long> &credit,
+                                              std::vector<std::size_t> &strategy) {
+    const std::size_t n = weight.size();
+    constexpr std::size_t no_vertex = static_cast<std::size_t>(-1);
+    constexpr long long unreachable = std::numeric_limits<long long>::max();
+    const auto in = [&](std::size_t v) { return credit[v] < top; };
+
+    strategy.assign(n, no_vertex);
+    for (std::size_t v = 0; v < n; ++v) {
+        if (in(v) && !is_player1[v]) {
+            for (const std::size_t u : successors.neighbours(v)) {
+                if (required_credit(credit[u], weight[v], top) <= credit[v]) {
+                    strategy[v] = u;
+                    break;
+                }
+            }
+        }
+    }
+
+    std::vector<std::size_t> all(n);
+    std::iota(all.begin(), all.end(), std::size_t{0});
+    std::vector<std::int64_t> distance;
+    std::vector<long long> to_zero_cycle(n, unreachable);
+    const auto cost = [&](std::size_t v) { return weight[v]; };
+
+    while (true) {
+        ggg::solvers::throw_if_cancelled();
+
+        // The edges left to play: player 0's choices and all of player 1's
+        graphs::csr_utilities::CompressedAdjacency play;
+        play.offsets.assign(1, 0);
+        for (std::size_t v = 0; v < n; ++v) {
+            if (in(v)) {
+                if (is_player1[v]) {
+                    play.targets.insert(play.targets.end(), successors.neighbours(v).begin(), successors.neighbours(v).end());
+                } else {
+                    play.targets.push_back(strategy[v]);
+                }
+            }
+            play.offsets.push_back(play.targets.size());
+        }
+        if (detail::find_negative_cycle(play, cost, distance)) {
+            throw std::logic_error("strategy improvement closed a negative cycle");
+        }
+
+        // Vertices on cycles of weight 0, i.e. on cycles of tight edges
+        graphs::csr_utilities::CompressedAdjacency tight;
+        tight.offsets.assign(1, 0);
+        for (std::size_t v = 0; v < n; ++v) {
+            for (const std::size_t u : play.neighbours(v)) {
+                if (distance[v] + weight[v] == distance[u]) {
+                    tight.targets.push_back(u);
+                }
+            }
+            tight.offsets.push_back(tight.targets.size());
+        }
+        std::fill(to_zero_cycle.begin(), to_zero_cycle.end(), unreachable);
+        std::deque<std::size_t> queue;
+        graphs::csr_utilities::StrongComponents(tight).run(all, in, [&](std::span<const std::size_t> component, bool cyclic) {
+            if (cyclic) {
+                for (const std::size_t v : component) {
+                    to_zero_cycle[v] = 0;
+                    queue.push_back(v);
+                }
+            }
+        });
+        if (queue.empty()) {
+            break;
+        }
+
+        // Shortest path of player 1 to a zero cycle; with no negative cycle
+        // the queue-based Bellman-Ford search terminates.
+        graphs::csr_utilities::CompressedAdjacency back;
+        back.offsets.assign(n + 1, 0);
+        back.targets.resize(play.targets.size());
+        for (const std::size_t u : play.targets) {
+            ++back.offsets[u + 1];
+        }
+        std::partial_sum(back.offsets.begin(), back.offsets.end(), back.offsets.begin());
+        std::vector<std::size_t> cursor(back.offsets.begin(), back.offsets.end() - 1);
+        for (std::size_t v = 0; v < n; ++v) {
+            for (const std::size_t u : play.neighbours(v)) {
+                back.targets[cursor[u]++] = v;
+            }
+        }
+        std::vector<char> queued(n, 0);
+        for (const std::size_t v : queue) {
+            queued[v] = 1;
+        }
+        while (!queue.empty()) {
+            const std::size_t u = queue.front();
+            queue.pop_front();
+            queued[u] = 0;
+            for (const std::size_t v : back.neighbours(u)) {
+                if (weight[v] + to_zero_cycle[u] < to_zero_cycle[v]) {
+                    to_zero_cycle[v] = weight[v] + to_zero_cycle[u];
+                    if (!queued[v]) {
+                        queued[v] = 1;
+                        queue.push_back(v);
+                    }
+                }
+            }
+        }
+
+        // Switch to the successor farthest from a zero cycle where that is
+        // farther than the current one
+        bool improved = false;
+        for (std::size_t v = 0; v < n; ++v) {
+            if (!in(v) || is_player1[v]) {
+                continue;
+            }
+            for (const std::size_t u : successors.neighbours(v)) {
+                if (in(u) && to_zero_cycle[u] > to_zero_cycle[strategy[v]]) {
+                    strategy[v] = u;
+                    improved = true;
+                }
+            }
+        }
+        if (!improved) {
+            break;
+        }
+    }
+
+    // After the last round either no zero cycle is left (to_zero_cycle was
+    // reset to unreachable) or none can be avoided from where it is reached.
+    std::vector<char> positive(n, 0);
+    for (std::size_t v = 0; v < n; ++v) {
+        positive[v] = in(v) && to_zero_cycle[v] == unreachable;
+        if (!positive[v]) {
+            strategy[v] = no_vertex;
+        }
+    }
+    return positive;
+}
+
+} // namespace mean_payoff
+} // namespace ggg
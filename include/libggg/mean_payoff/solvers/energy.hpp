@@ -0,0 +1,65 @@
+#pragma once
+
+#include "libggg/mean_payoff/graph.hpp"
+#include "libggg/solvers/solver.hpp"
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/graph_traits.hpp>
+
+namespace ggg {
+namespace mean_payoff {
+
+using EnergySolutionType = ggg::solutions::RSQSolution<graph::Graph, ggg::strategy::DeterministicStrategy<graph::Graph>, long long>;
+
+/**
+ * @brief Energy game solver reporting the minimal initial credit of every vertex
+ *
+ * Interprets the mean-payoff graph as an energy game: a play v0 v1 v2 ... from
+ * initial credit c is won by player 0 iff c + w(v0) + ... + w(vk) >= 0 for
+ * every prefix, i.e. vertex weights are collected when a vertex is visited.
+ *
+ * The minimal credits are computed with the small energy progress measure
+ * lifting algorithm of @cite DBLP:journals/fmsd/BrimCDGR11 on flat CSR arrays
+ * with 64-bit arithmetic (see lift_energy_measure()).  A finite credit never
+ * exceeds the sum of the absolute negative weights, which is used as the
+ * saturation bound ⊤.
+ *
+ * The solution reports:
+ * - values: the minimal initial credit, or @ref infinite_credit (-1) when no
+ *   finite credit suffices;
+ * - winning regions: player 0 where the mean-payoff value is > 0, as for the
+ *   other mean-payoff solvers.  A vertex of value exactly 0 has a finite
+ *   credit but is won by player 1.  Among the vertices of finite credit, the
+ *   zero cycles player 1 can force are found on edges tight for
+ *   shortest-path potentials and avoided by strategy improvement (see
+ *   positive_mean_payoff());
+ * - strategies: for player 0 on its winning region, a successor under which
+ *   every cycle player 1 can close has positive weight; for player 1 on its
+ *   winning region, a successor whose requirement is covered in the dual
+ *   energy game (players swapped, weights negated), so every cycle player 0
+ *   can close has weight <= 0.
+ */
+class EnergySolver : public ggg::solvers::Solver<graph::Graph, EnergySolutionType> {
+  public:
+    /**
+     * @brief Value reported for vertices from which no finite credit suffices
+     */
+    static constexpr long long infinite_credit = -1;
+
+    /**
+     * @brief Solve the energy game given by the mean-payoff graph
+     * @param graph Mean payoff graph to solve
+     * @return Winning regions, strategies and minimal initial credits
+     */
+    EnergySolutionType solve(const graph::Graph &graph) override;
+
+    /**
+     * @brief Get solver name
+     * @return Solver description
+     */
+    std::string get_name() const override {
+        return "Energy (minimal initial credit) Solver";
+    }
+};
+
+} // namespace mean_payoff
+} // namespace ggg
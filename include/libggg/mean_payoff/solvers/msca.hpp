@@ -1,72 +1,192 @@
 #pragma once
 
+#include "libggg/graphs/csr_utilities.hpp"
 #include "libggg/mean_payoff/graph.hpp"
 #include "libggg/solvers/solver.hpp"
 #include <boost/dynamic_bitset.hpp>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/graph_traits.hpp>
-#include <map>
+#include <boost/rational.hpp>
 #include <vector>
 
 namespace ggg {
 namespace mean_payoff {
 
 using MSCASolutionType = ggg::solutions::RSQSolution<graph::Graph, ggg::strategy::DeterministicStrategy<graph::Graph>, long long>;
+using MSCAValueSolutionType = ggg::solutions::RSQSolution<graph::Graph, ggg::strategy::DeterministicStrategy<graph::Graph>, boost::rational<long long>>;
+
+class MSCAValueSolver;
 
 /**
  * @brief Mean-payoff Solver with Constraint Analysis (MSCA)
  *
  * Implementation of the MSCA algorithm for solving mean-payoff games
- * based on @cite DBLP:journals/fmsd/BrimCDGR11 and @cite DBLP:conf/icalp/DorfmanKZ19. 
- * This algorithm uses constraint analysis and scaling techniques for efficient computation.
+ * based on @cite DBLP:journals/fmsd/BrimCDGR11 and @cite DBLP:conf/icalp/DorfmanKZ19.
+ * The solver computes the least energy progress measure f, where the weight
+ * of a vertex is collected when it is entered: an edge (u, v) is consistent
+ * iff f(u) >= f(v) - w(v).  Instead of lifting one vertex at a time, a bad
+ * vertex is lifted together with every vertex whose constraints are tight on
+ * it, by the largest amount that keeps all other constraints satisfied.
+ * The closure is grown and raised lazily: its members share one offset, and
+ * the constraints that bound the lift are kept in a binary heap keyed by the
+ * offset at which they become tight, so each step only touches the vertices
+ * whose constraints change.  Weights are processed by scaling: the game
+ * with weights ⌈w/2⌉ is solved first and twice its measure seeds the next
+ * level.
+ *
+ * Measures are capped at ⊤ = 1 + Σ max(0, -w(v)); no finite credit exceeds
+ * it.  The solution value is the credit, or -1 for ⊤.  As for the other
+ * mean-payoff solvers, player 0 wins the vertices with mean payoff > 0: those
+ * with a finite credit for the weights n·w - 1, which a second, warm-started
+ * run computes.  Its measure also gives player 0's strategy, a consistent
+ * edge, so every cycle it allows has positive weight.
  */
 class MSCASolver : public ggg::solvers::Solver<graph::Graph, MSCASolutionType> {
   public:
-    ggg::solutions::RSQSolution<graph::Graph, ggg::strategy::DeterministicStrategy<graph::Graph>, long long> solve(const graph::Graph &graph) override;
+    MSCASolutionType solve(const graph::Graph &graph) override;
     std::string get_name() const override { return "MSCA (Mean-payoff Solver with Constraint Analysis) Solver"; }
 
   private:
-    using Vertex = graph::Graph::vertex_descriptor;
+    friend class MSCAValueSolver;
+
     using Bitset = boost::dynamic_bitset<unsigned long long>;
 
-    long long scaling_val_;
-    long long delta_value_;
-    long long nw_;
-    int working_vertex_index_;
-
-    std::map<Vertex, int> vertex_to_index_;
-    std::vector<Vertex> index_to_vertex_;
-
-    std::vector<long long> weight_;
-    std::vector<long long> msrfun_;
-    std::vector<int> count_;
-    std::vector<Vertex> strategy_;
-    Bitset rescaled_;
-    Bitset setL_;
-    Bitset setB_;
-
-    unsigned long count_update_;
-    unsigned long count_delta_;
-    unsigned long count_iter_delta_;
-    unsigned long count_super_delta_;
-    unsigned long count_null_delta_;
-    unsigned long count_scaling_;
-    unsigned long max_delta_;
-
-    const graph::Graph *graph_;
-
-    void init(const graph::Graph &graph);
-    long long calc_n_w();
-    long long wf(int predecessor_idx, int successor_idx);
-    long long delta_p1();
-    long long delta_p2();
-    void delta();
-    void update_func(int pos);
-    void update_energy();
-    void compute_energy();
-
-    bool is_empty() const;
-    void reset();
+    /**
+     * @brief Game data shared by every run on one graph; never modified
+     */
+    struct Game {
+        explicit Game(const graph::Graph &graph);
+
+        std::size_t n;
+        graphs::csr_utilities::CompressedAdjacency successors;
+        graphs::csr_utilities::CompressedAdjacency predecessors;
+        std::vector<char> is_player1;
+        std::vector<long long> base_weight;
+    };
+
+    /**
+     * @brief Lifting state of one run: weights, measure, closure and heap
+     *
+     * A run stays valid for later thresholds, whose least measures its
+     * current one bounds from below after rescale_measure().
+     */
+    class Run {
+      public:
+        explicit Run(const Game &game);
+
+        void set_threshold(long long numerator, long long denominator);
+        void rescale_measure(long long from_denominator, long long to_denominator);
+        void compute_energy();
+        void compute_energy_warm();
+
+        long long measure(std::size_t vertex) const { return setB_[vertex] ? msrfun_[vertex] + offset_ : msrfun_[vertex]; }
+        long long wf(std::size_t predecessor, std::size_t successor) const;
+        bool is_top(std::size_t vertex) const { return measure(vertex) >= top_; }
+        void log_statistics() const;
+
+      private:
+        /**
+         * @brief Pending constraint change while the closure is being raised
+         *
+         * `key` is the closure offset at which the constraint becomes tight.
+         * Exit events: an edge from member `vertex` to non-member `other`
+         * becomes consistent.  Join events: non-member `vertex` must join the
+         * closure; for player 0 vertices `other` is the stamp the event was
+         * scheduled with.
+         */
+        struct Event {
+            long long key;
+            int kind;
+            std::size_t vertex;
+            std::size_t other;
+
+            friend bool operator>(const Event &a, const Event &b) {
+                return a.key != b.key ? a.key > b.key : a.kind > b.kind;
+            }
+        };
+        static constexpr int kExit = 0;
+        static constexpr int kJoin = 1;
+
+        const Game &game_;
+        std::size_t n_;
+
+        std::vector<long long> weight_;
+        std::vector<long long> scaled_weight_;
+        std::vector<long long> msrfun_;
+        long long top_ = 1;
+
+        std::vector<std::size_t> closure_;
+        std::vector<std::size_t> worklist_;
+        std::vector<Event> events_;
+        std::vector<std::size_t> tight_;
+        std::vector<unsigned> stamp_;
+        long long offset_ = 0;
+        long long max_stored_ = 0;
+        Bitset setL_;
+        std::vector<char> setB_;
+
+        unsigned long count_update_ = 0;
+        unsigned long count_delta_ = 0;
+        unsigned long count_iter_delta_ = 0;
+        unsigned long count_super_delta_ = 0;
+        unsigned long count_rebuild_ = 0;
+        unsigned long count_scaling_ = 0;
+        unsigned long count_top_ = 0;
+        long long max_delta_ = 0;
+
+        void set_level(long long scale);
+        void run_level();
+        bool is_bad(std::size_t vertex) const;
+        bool is_stale(const Event &event) const;
+        void push_event(const Event &event);
+        void join_closure(std::size_t vertex, std::size_t root);
+        void schedule_exit(std::size_t vertex, std::size_t root);
+        void schedule_player0(std::size_t vertex);
+        void release_closure();
+        void update_energy(std::size_t root);
+        void lift_to_top(std::size_t vertex);
+    };
+};
+
+/**
+ * @brief Exact mean-payoff values by batched MSCA threshold queries
+ *
+ * Whether ν(v) >= p/q is decided by running MSCA on the weights q·w - p.
+ * The values are found by search_values_by_thresholds(): each round's
+ * distinct thresholds are sorted and split into contiguous blocks solved on
+ * separate threads.  All blocks read one shared copy of the game; every
+ * block owns a run whose weight array is rewritten in place for each
+ * threshold, and whose measure for a threshold seeds the next (larger) one:
+ * scaled by q'/q, the least measure for p/q is a lower bound of the least
+ * measure for p'/q' > p/q.  Runs are kept from round to round, so a block
+ * whose first threshold is not below its run's last one starts warm too.
+ *
+ * The solution reports exact rational values and winning regions (player 0
+ * wins iff the value is > 0, as for MSCASolver).  No strategies are reported.
+ */
+class MSCAValueSolver : public ggg::solvers::Solver<graph::Graph, MSCAValueSolutionType> {
+  public:
+    /**
+     * @brief Construct the solver
+     * @param threads Number of worker threads, 0 for ggg::utils::thread_count()
+     */
+    explicit MSCAValueSolver(unsigned threads = 0) : threads_(threads) {}
+
+    /**
+     * @brief Compute the exact mean-payoff value of every vertex
+     * @param graph Mean payoff graph to solve
+     * @return Winning regions and exact mean-payoff values
+     */
+    MSCAValueSolutionType solve(const graph::Graph &graph) override;
+
+    /**
+     * @brief Get solver name
+     * @return Solver description
+     */
+    std::string get_name() const override { return "MSCA threshold search (exact values) Solver"; }
+
+  private:
+    unsigned threads_;
 };
 
 } // namespace mean_payoff
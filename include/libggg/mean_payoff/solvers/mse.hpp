@@ -15,8 +15,19 @@ namespace mean_payoff {
  * The algorithm transforms the mean payoff game into an energy game and solves it
  * using an iterative approach with progress measures.
  * Such algorithms are described in @cite DBLP:journals/iandc/BenerecettiDM24.
+ *
+ * The lifting loop runs on CSR successor/predecessor arrays indexed by vertex
+ * and keeps costs in 64-bit integers.  Every lifted cost is clamped to the
+ * limit ⊤ (sum of positive weights + 1), so costs stay within [0, ⊤] and
+ * cannot overflow whatever the magnitude of the 32-bit input weights.
+ * The quantitative value of a vertex is its final progress-measure cost.
+ * Player 0 wins (mean payoff > 0) where the cost reaches ⊤.  Player 1's
+ * strategy keeps to successors whose cost bounds its own; player 0's comes
+ * from the least energy measure on its region, improved to avoid cycles of
+ * weight 0 (see positive_mean_payoff()), so both certify the regions (see
+ * verify()).
  */
-using SolutionType = ggg::solutions::RSQSolution<graph::Graph, ggg::strategy::DeterministicStrategy<graph::Graph>, int>;
+using SolutionType = ggg::solutions::RSQSolution<graph::Graph, ggg::strategy::DeterministicStrategy<graph::Graph>, long long>;
 
 class MSESolver : public ggg::solvers::Solver<graph::Graph, SolutionType> {
   public:
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "libggg/mean_payoff/graph.hpp"
+#include "libggg/solvers/solver.hpp"
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/rational.hpp>
+
+namespace ggg {
+namespace mean_payoff {
+
+using SISolutionType = ggg::solutions::RSQSolution<graph::Graph, ggg::strategy::DeterministicStrategy<graph::Graph>, boost::rational<long long>>;
+
+/**
+ * @brief Strategy improvement for mean payoff vertex games
+ *
+ * Björklund–Vorobyov style strategy iteration for player 0
+ * @cite DBLP:journals/dam/BjorklundV07.  Player 0 may additionally retreat
+ * from any of its vertices to a sink; a strategy is valued by player 1's best
+ * response, i.e. shortest distances to the sink, -∞ where player 1 reaches a
+ * losing cycle and +∞ where it can neither.  Valuations are computed by
+ * queue-based Bellman–Ford on flat CSR arrays; all profitable switches are
+ * then evaluated in parallel and applied at once, until none is left.  The
+ * vertices valued +∞ by the final strategy are the ones player 0 wins.
+ *
+ * A threshold query ν(v) >= p/q runs this on the weights q·w - p, with the
+ * previous query's strategy as the starting point.  Exact values are found
+ * by search_values_by_thresholds(); the number of improvement rounds does not
+ * depend on the size of the weights.
+ *
+ * The solution reports exact rational values, winning regions (player 0 wins
+ * iff the value is strictly positive) and winning strategies for both
+ * players.  Player 1's comes from the same iteration on the mirrored game,
+ * with the players swapped and the weights negated, at the threshold 0.
+ */
+class StrategyImprovementSolver : public ggg::solvers::Solver<graph::Graph, SISolutionType> {
+  public:
+    /**
+     * @brief Construct the solver
+     * @param threads Number of threads evaluating switches, 0 for ggg::utils::thread_count()
+     */
+    explicit StrategyImprovementSolver(unsigned threads = 0) : threads_(threads) {}
+
+    /**
+     * @brief Solve the mean payoff game by strategy improvement
+     * @param graph Mean payoff graph to solve
+     * @return Winning regions, strategies and exact mean-payoff values
+     */
+    SISolutionType solve(const graph::Graph &graph) override;
+
+    /**
+     * @brief Get solver name
+     * @return Solver description
+     */
+    std::string get_name() const override {
+        return "Strategy Improvement (Björklund-Vorobyov) Solver";
+    }
+
+  private:
+    unsigned threads_;
+};
+
+} // namespace mean_payoff
+} // namespace ggg
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "libggg/mean_payoff/graph.hpp"
+#include "libggg/solvers/solver.hpp"
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/rational.hpp>
+
+namespace ggg {
+namespace mean_payoff {
+
+using ZPSolutionType = ggg::solutions::RSQSolution<graph::Graph, ggg::strategy::DeterministicStrategy<graph::Graph>, boost::rational<long long>>;
+
+/**
+ * @brief Parallel Zwick–Paterson value iteration for mean payoff vertex games
+ *
+ * Computes the k-step values v_k(v) = w(v) + opt_{u in succ(v)} v_{k-1}(u),
+ * where player 0 maximises and player 1 minimises, following
+ * @cite DBLP:journals/tcs/ZwickP96.  Every round is a gather over the CSR
+ * successor lists into a second buffer (double buffering), split into
+ * contiguous vertex blocks processed by persistent worker threads.
+ *
+ * Each round also records the greedy choice of every vertex.  From a short
+ * warm-up on, these choices are checked for optimality on rounds growing
+ * geometrically: the candidate value of a vertex is the mean of the cycle
+ * both players' choices reach from it, and the candidates are exact if
+ * neither player can do better against the other's choices, i.e. candidates
+ * never move in the opponent's favour along its edges and no cycle within a
+ * candidate class does (checked by Bellman–Ford).  On periodic games the
+ * greedy choices of a single round can mix cycles of different phases; a
+ * failed check then lets the players improve them for a few policy-iteration
+ * steps (by candidate, then by bias) before checking again.  Iteration stops
+ * at the first round that passes.
+ *
+ * As a fallback, the mean-payoff value ν(v) has denominator at most n and
+ * satisfies |v_k(v) − k·ν(v)| <= 2nW (W the largest absolute weight).  A
+ * vertex is stabilised as soon as the interval [(v_k − 2nW)/k, (v_k + 2nW)/k]
+ * contains exactly one fraction with denominator <= n, found via its Farey
+ * neighbours; iteration stops once every vertex is stabilised, which happens
+ * at the latest after 4n³W rounds.  std::overflow_error is thrown if v_k
+ * would leave 64 bits first.
+ *
+ * The solution reports exact rational values and winning regions (player 0
+ * wins iff the value is strictly positive).  When the final choices pass the
+ * check, they are reported as both players' strategies on their winning
+ * regions.
+ */
+class ZwickPatersonSolver : public ggg::solvers::Solver<graph::Graph, ZPSolutionType> {
+  public:
+    /**
+     * @brief Construct the solver
+     * @param threads Number of worker threads, 0 for ggg::utils::thread_count()
+     */
+    explicit ZwickPatersonSolver(unsigned threads = 0) : threads_(threads) {}
+
+    /**
+     * @brief Solve the mean payoff game by bounded value iteration
+     * @param graph Mean payoff graph to solve
+     * @return Winning regions, exact mean-payoff values and, when certified, strategies
+     */
+    ZPSolutionType solve(const graph::Graph &graph) override;
+
+    /**
+     * @brief Get solver name
+     * @return Solver description
+     */
+    std::string get_name() const override {
+        return "Zwick-Paterson (parallel value iteration) Solver";
+    }
+
+  private:
+    unsigned threads_;
+};
+
+} // namespace mean_payoff
+} // namespace ggg
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "libggg/solvers/cancellation.hpp"
+#include "libggg/utils/fraction.hpp"
+#include <boost/rational.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace ggg {
+namespace mean_payoff {
+
+/**
+ * @brief Recover exact mean-payoff values from threshold decisions
+ *
+ * Every mean-payoff value ν(v) of a game with n vertices and weights in
+ * [-W, W] is a fraction in [-W, W] with denominator at most n.  This runs a
+ * batched (parallel) binary search for all vertices at once: each vertex keeps
+ * an interval [lo, hi) known to contain ν(v); in each round, vertices sharing
+ * an interval share a query threshold t, the simplest fraction in the middle
+ * third of that interval.  All distinct thresholds of a round are passed to
+ * @p decide in one batch, which lets the caller solve them concurrently and
+ * warm-start neighbouring thresholds.  A vertex is resolved once its interval
+ * contains a single fraction with denominator <= n; the interval shrinks by at
+ * least a third per round, so this takes O(log(nW)) rounds.
+ *
+ * @tparam DecideBatch Callable with signature
+ *         `std::vector<std::vector<char>>(const std::vector<utils::Fraction> &thresholds)`
+ *         returning, for every threshold t (given in increasing order), a
+ *         vector with one entry per vertex that is non-zero iff ν(v) >= t
+ * @param n Number of vertices (vertex indices are 0..n-1)
+ * @param max_weight Largest absolute vertex weight W
+ * @param decide Batch threshold oracle
+ * @return Exact value of every vertex
+ */
+template <typename DecideBatch>
+std::vector<boost::rational<long long>> search_values_by_thresholds(std::size_t n, long long max_weight, DecideBatch &&decide) {
+    using utils::Fraction;
+    const long long order = static_cast<long long>(n);
+
+    std::vector<Fraction> lo(n, Fraction{-max_weight, 1});
+    std::vector<Fraction> hi(n, Fraction{max_weight + 1, 1});
+    std::vector<boost::rational<long long>> values(n);
+    std::vector<char> resolved(n, 0);
+    std::vector<std::size_t> pending;
+
+    const auto try_resolve = [&](std::size_t v) {
+        Fraction value;
+        if (utils::unique_of_order(lo[v], hi[v], order, true, value)) {
+            values[v] = value.to_rational();
+            resolved[v] = 1;
+        }
+    };
+    for (std::size_t v = 0; v < n; ++v) {
+        try_resolve(v);
+        if (!resolved[v]) {
+            pending.push_back(v);
+        }
+    }
+
+    while (!pending.empty()) {
+        ggg::solvers::throw_if_cancelled();
+        // Query the simplest fraction of the middle third of each interval;
+        // vertices with equal intervals share their threshold.
+        std::vector<Fraction> query(n);
+        std::vector<Fraction> thresholds;
+        thresholds.reserve(pending.size());
+        for (const std::size_t v : pending) {
+            const __int128 l = lo[v].num * hi[v].den;
+            const __int128 h = hi[v].num * lo[v].den;
+            const __int128 d = 3 * lo[v].den * hi[v].den;
+            query[v] = utils::simplest_between({2 * l + h, d}, {l + 2 * h, d});
+            thresholds.push_back(query[v]);
+        }
+        std::sort(thresholds.begin(), thresholds.end());
+        thresholds.erase(std::unique(thresholds.begin(), thresholds.end()), thresholds.end());
+
+        std::vector<std::size_t> query_of(n);
+        for (const std::size_t v : pending) {
+            query_of[v] = static_cast<std::size_t>(std::lower_bound(thresholds.begin(), thresholds.end(), query[v]) - thresholds.begin());
+        }
+
+        const std::vector<std::vector<char>> at_least = decide(thresholds);
+
+        std::vector<std::size_t> still_pending;
+        for (const std::size_t v : pending) {
+            const std::size_t q = query_of[v];
+            if (at_least[q][v]) {
+                lo[v] = thresholds[q];
+            } else {
+                hi[v] = thresholds[q];
+            }
+            try_resolve(v);
+            if (!resolved[v]) {
+                still_pending.push_back(v);
+            }
+        }
+        pending.swap(still_pending);
+    }
+
+    return values;
+}
+
+} // namespace mean_payoff
+} // namespace ggg
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "libggg/graphs/csr_utilities.hpp"
+#include "libggg/mean_payoff/graph.hpp"
+#include "libggg/solutions/verification.hpp"
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ggg {
+namespace mean_payoff {
+
+namespace detail {
+
+// Bellman-Ford (queue-based) over one component with edge u -> v costing
+// cost(u), started from every vertex at distance 0.  Returns a vertex on a
+// negative cycle if there is one; otherwise leaves shortest distances in
+// @p distance.  A vertex whose shortest path reaches n edges lies behind a
+// negative cycle, and walking n parents back from it lands on the cycle.
+template <typename Cost>
+std::optional<std::size_t> find_negative_cycle(const graphs::csr_utilities::CompressedAdjacency &local, Cost &&cost,
+                                               std::vector<std::int64_t> &distance) {
+    const std::size_t n = local.num_vertices();
+    distance.assign(n, 0);
+    std::vector<std::size_t> length(n, 0);
+    std::vector<std::size_t> parent(n, n);
+    std::vector<unsigned char> queued(n, 1);
+    std::deque<std::size_t> queue;
+    for (std::size_t v = 0; v < n; ++v) {
+        queue.push_back(v);
+    }
+    while (!queue.empty()) {
+        const std::size_t u = queue.front();
+        queue.pop_front();
+        queued[u] = 0;
+        const std::int64_t through = distance[u] + cost(u);
+        for (const std::size_t v : local.neighbours(u)) {
+            if (through >= distance[v]) {
+                continue;
+            }
+            distance[v] = through;
+            parent[v] = u;
+            length[v] = length[u] + 1;
+            if (length[v] >= n) {
+                std::size_t w = v;
+                for (std::size_t k = 0; k < n; ++k) {
+                    w = parent[w];
+                }
+                return w;
+            }
+            if (!queued[v]) {
+                queued[v] = 1;
+                queue.push_back(v);
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+// A cycle of the component costing less than 0, or at most 0 with
+// @p zero_loses, as a vertex on it; the cycle's cost is told apart by the
+// second member (true: zero).  Zero-cost cycles, once there is no negative
+// one, are exactly the cycles of edges tight for the shortest distances.
+template <typename Cost>
+std::optional<std::pair<std::size_t, bool>> find_losing_cycle(const graphs::csr_utilities::CompressedAdjacency &local, Cost &&cost,
+                                                              bool zero_loses) {
+    std::vector<std::int64_t> distance;
+    if (const auto cycle = find_negative_cycle(local, cost, distance)) {
+        return std::make_pair(*cycle, false);
+    }
+    if (!zero_loses) {
+        return std::nullopt;
+    }
+    graphs::csr_utilities::CompressedAdjacency tight;
+    tight.offsets.assign(1, 0);
+    for (std::size_t u = 0; u < local.num_vertices(); ++u) {
+        for (const std::size_t v : local.neighbours(u)) {
+            if (distance[u] + cost(u) == distance[v]) {
+                tight.targets.push_back(v);
+            }
+        }
+        tight.offsets.push_back(tight.targets.size());
+    }
+    std::vector<std::size_t> all(local.num_vertices());
+    for (std::size_t v = 0; v < all.size(); ++v) {
+        all[v] = v;
+    }
+    std::optional<std::pair<std::size_t, bool>> found;
+    graphs::csr_utilities::StrongComponents scc(tight);
+    scc.run(all, [](std::size_t) { return true; }, [&](std::span<const std::size_t> component, bool cyclic) {
+        if (cyclic && !found) {
+            found = std::make_pair(component.front(), true);
+        }
+    });
+    return found;
+}
+
+} // namespace detail
+
+/**
+ * @brief Mean payoff player 0 needs to win a play
+ *
+ * All mean-payoff solvers give plays of mean payoff exactly 0 to player 1,
+ * i.e. check their solutions with Positive (see docs/games.md).
+ */
+enum class Threshold {
+    NonNegative, ///< Player 0 wins iff the mean payoff is >= 0
+    Positive     ///< Player 0 wins iff the mean payoff is > 0
+};
+
+/**
+ * @brief Check a mean-payoff game solution without solving the game again
+ *
+ * After the closure check (see solutions::check_closure), every cycle
+ * player 1 can close in player 0's region must have a weight player 0 wins
+ * by @p threshold, and every cycle player 0 can close in player 1's region
+ * one it loses.  Each strongly connected component of a region is checked
+ * for a negative cycle with Bellman-Ford, and where zero-weight cycles
+ * matter, for cycles of edges tight for the resulting distances.
+ * Components are checked in parallel.
+ *
+ * @param solution Anything with get_winning_player, has_strategy and
+ *        get_strategy, e.g. a solver's RSQSolution or a binary::BinarySolution;
+ *        it needs strategies for both players
+ * @param threshold Who wins plays of mean payoff 0
+ * @param threads Worker threads, 0 for ggg::utils::thread_count()
+ */
+template <typename SolutionType>
+solutions::Verification verify(const graph::Graph &graph, const SolutionType &solution, Threshold threshold,
+                               unsigned threads = 0) {
+    solutions::InducedGame game;
+    if (auto closure = solutions::check_closure(graph, solution, game, threads); !closure) {
+        return closure;
+    }
+    for (const int player : {0, 1}) {
+        // Cycles are costed so that the ones the winner loses are negative
+        // (or zero): player 0 loses low weights, player 1 high ones.
+        const bool zero_loses = (threshold == Threshold::Positive) == (player == 0);
+        auto result = solutions::check_cyclic_components(
+            game, player,
+            [&](const graphs::csr_utilities::CompressedAdjacency &local, std::span<const std::size_t> members) -> std::optional<std::string> {
+                const auto cost = [&](std::size_t v) {
+                    const std::int64_t weight = graph[members[v]].weight;
+                    return player == 0 ? weight : -weight;
+                };
+                const auto cycle = detail::find_losing_cycle(local, cost, zero_loses);
+                if (!cycle) {
+                    return std::nullopt;
+                }
+                const char *kind = cycle->second ? "zero-weight" : (player == 0 ? "negative" : "positive");
+                return "player " + std::to_string(1 - player) + " wins a " + kind + " cycle through '" +
+                       graph[members[cycle->first]].name + "' in the winning region of player " + std::to_string(player);
+            },
+            threads);
+        if (!result) {
+            return result;
+        }
+    }
+    return {};
+}
+
+/**
+ * @brief verify() at Threshold::Positive, the winning condition of every
+ *        mean-payoff solver; the check behind the solver tools' --verify
+ */
+template <typename SolutionType>
+solutions::Verification verify_positive(const graph::Graph &graph, const SolutionType &solution) {
+    return verify(graph, solution, Threshold::Positive);
+}
+
+} // namespace mean_payoff
+} // namespace ggg
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "libggg/parity/graph.hpp"
+#include "libggg/solvers/portfolio.hpp"
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ggg {
+namespace parity {
+
+/**
+ * @brief Solution of a portfolio run, naming the solver that produced it
+ */
+class ParityPortfolioSolution : public ggg::solutions::RSSolution<graph::Graph> {
+  public:
+    ParityPortfolioSolution() = default;
+    ParityPortfolioSolution(ggg::solutions::RSSolution<graph::Graph> solution)
+        : ggg::solutions::RSSolution<graph::Graph>(std::move(solution)) {}
+
+    void set_winner(std::string winner) { winner_ = std::move(winner); }
+    const std::string &get_winner() const { return winner_; }
+
+    std::map<std::string, std::string> get_statistics() const { return {{"winner", winner_}}; }
+
+  private:
+    std::string winner_;
+};
+
+/**
+ * @brief Races parity solvers on one game and keeps the first verified solution
+ *
+ * Runs the named solvers in parallel, as ggg::solvers::PortfolioSolver
+ * does.  Each solution is checked with ggg::parity::verify() before it is
+ * accepted, since the members are not correct on every game; a rejected
+ * member drops out and the race goes on, and the solve fails only if no
+ * member's solution passes.  Every solver checks for cancellation in its
+ * main loop, so the others stop soon after a solution is accepted.
+ */
+class ParityPortfolioSolver : public ggg::solvers::PortfolioSolver<graph::Graph, ParityPortfolioSolution> {
+  public:
+    /**
+     * @brief Race priority promotion, progressive small progress measures and Zielonka's recursive algorithm
+     */
+    ParityPortfolioSolver();
+
+    /**
+     * @param solvers Names of the solvers raced, as listed by available(); "pp" and "spm" are accepted too
+     * @throws std::invalid_argument for an unknown name
+     */
+    explicit ParityPortfolioSolver(const std::vector<std::string> &solvers);
+
+    ParityPortfolioSolution solve(const graph::Graph &graph) override;
+
+    /**
+     * @brief Names of the solvers a portfolio can race
+     */
+    static std::vector<std::string> available();
+};
+
+} // namespace parity
+} // namespace ggg
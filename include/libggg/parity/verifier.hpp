@@ -0,0 +1,104 @@
+#pragma once
+
+#include "libggg/graphs/csr_utilities.hpp"
+#include "libggg/parity/graph.hpp"
+#include "libggg/solutions/verification.hpp"
+#include <algorithm>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace ggg {
+namespace parity {
+
+namespace detail {
+
+// Whether the opponent of `player` wins a cycle of the component: the
+// highest priority on every cycle must have the parity of `player`.  A
+// component whose top priority is right for `player` is split by removing
+// the vertices of that priority, and the rest decomposed again; each round
+// removes a priority, so this takes O(d · m log n) for d priorities.
+inline std::optional<std::string> find_losing_cycle(const graph::Graph &graph,
+                                                    const graphs::csr_utilities::CompressedAdjacency &local,
+                                                    std::span<const std::size_t> members, int player) {
+    const std::size_t n = local.num_vertices();
+    graphs::csr_utilities::StrongComponents scc(local);
+    std::vector<unsigned char> in(n, 0);
+    std::vector<std::vector<std::size_t>> work(1);
+    work.back().resize(n);
+    for (std::size_t v = 0; v < n; ++v) {
+        work.back()[v] = v;
+    }
+    std::vector<std::vector<std::size_t>> found;
+    while (!work.empty()) {
+        const auto set = std::move(work.back());
+        work.pop_back();
+        for (const std::size_t v : set) {
+            in[v] = 1;
+        }
+        found.clear();
+        scc.run(set, [&](std::size_t v) { return in[v] != 0; }, [&](std::span<const std::size_t> component, bool cyclic) {
+            if (cyclic) {
+                found.emplace_back(component.begin(), component.end());
+            }
+        });
+        for (const std::size_t v : set) {
+            in[v] = 0;
+        }
+        for (auto &component : found) {
+            const auto priority = [&](std::size_t v) { return graph[members[v]].priority; };
+            const std::size_t top = *std::max_element(component.begin(), component.end(),
+                                                      [&](std::size_t a, std::size_t b) { return priority(a) < priority(b); });
+            if (priority(top) % 2 != player) {
+                return "player " + std::to_string(1 - player) + " wins a cycle through '" + graph[members[top]].name +
+                       "' (priority " + std::to_string(priority(top)) + ") in the winning region of player " + std::to_string(player);
+            }
+            const int top_priority = priority(top);
+            std::erase_if(component, [&](std::size_t v) { return priority(v) == top_priority; });
+            if (!component.empty()) {
+                work.push_back(std::move(component));
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace detail
+
+/**
+ * @brief Check a parity game solution without solving the game again
+ *
+ * The solution is a certificate if every vertex has a winner, the winners'
+ * strategies keep play in their regions (see solutions::check_closure), and
+ * in the one-player game each fixed strategy leaves, every cycle the
+ * opponent can close has a highest priority of the winner's parity.  The
+ * cycle check runs in parallel over the strongly connected components of
+ * each region.
+ *
+ * @param solution Anything with get_winning_player, has_strategy and
+ *        get_strategy, e.g. a solver's RSSolution or a binary::BinarySolution
+ * @param threads Worker threads, 0 for ggg::utils::thread_count()
+ */
+template <typename SolutionType>
+solutions::Verification verify(const graph::Graph &graph, const SolutionType &solution, unsigned threads = 0) {
+    solutions::InducedGame game;
+    if (auto closure = solutions::check_closure(graph, solution, game, threads); !closure) {
+        return closure;
+    }
+    for (const int player : {0, 1}) {
+        auto result = solutions::check_cyclic_components(
+            game, player,
+            [&](const graphs::csr_utilities::CompressedAdjacency &local, std::span<const std::size_t> members) {
+                return detail::find_losing_cycle(graph, local, members, player);
+            },
+            threads);
+        if (!result) {
+            return result;
+        }
+    }
+    return {};
+}
+
+} // namespace parity
+} // namespace ggg
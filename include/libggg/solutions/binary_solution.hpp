@@ -0,0 +1,452 @@
+#pragma once
+
+#include "libggg/solutions/concepts.hpp"
+#include "libggg/utils/output_sink.hpp"
+#include <algorithm>
+#include <bit>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/rational.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define GGG_BINARY_SOLUTION_MMAP 1
+#endif
+
+namespace ggg {
+namespace solutions {
+namespace binary {
+
+inline constexpr char magic[8] = {'G', 'G', 'G', 'S', 'O', 'L', 'N', '\0'};
+inline constexpr std::uint32_t version = 1;
+
+static_assert(std::endian::native == std::endian::little, "binary solution files are little-endian");
+
+/**
+ * @brief Encoding of the values section
+ */
+enum class ValueKind : std::uint32_t {
+    None = 0,
+    Float64 = 1,   ///< double
+    Int64 = 2,     ///< std::int64_t
+    Rational64 = 3 ///< std::int64_t numerator, std::int64_t denominator
+};
+
+/**
+ * @brief Header of a binary solution file
+ *
+ * Layout (little-endian, every section starts at a multiple of 8 bytes):
+ *
+ * | Section    | Contents                                                              |
+ * |------------|-----------------------------------------------------------------------|
+ * | Header     | magic "GGGSOLN\0", version, value kind, vertex count, solve time,     |
+ * |            | section offsets (0 = absent) and total file size                      |
+ * | Regions    | two bitsets of ceil(n / 64) words: won by player 0, won by player 1   |
+ * | Strategy   | one uint32 successor per vertex (see no_strategy, null_strategy)      |
+ * | Values     | a presence bitset, then one value per vertex in the header's kind     |
+ * | Statistics | entry count, then (key length, value length, key, value) per entry    |
+ *
+ * Vertices that are not won by either player (unset or -1) have neither region
+ * bit.  Only deterministic strategies are stored.  Values are stored exactly
+ * for double, 64-bit integers and boost::rational<long long>; other value
+ * types are converted to double.
+ */
+struct Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t value_kind;
+    std::uint64_t num_vertices;
+    double solve_time;          ///< Milliseconds
+    std::uint64_t regions;      ///< Offset of the regions section, 0 if absent
+    std::uint64_t strategy;     ///< Offset of the strategy section, 0 if absent
+    std::uint64_t values;       ///< Offset of the values section, 0 if absent
+    std::uint64_t statistics;   ///< Offset of the statistics section
+    std::uint64_t file_size;
+};
+
+inline constexpr std::uint32_t no_strategy = std::numeric_limits<std::uint32_t>::max(); ///< Vertex without strategy
+inline constexpr std::uint32_t null_strategy = no_strategy - 1;                    ///< Strategy set to null_vertex()
+
+namespace detail {
+
+inline std::uint64_t bitset_words(std::uint64_t n) { return (n + 63) / 64; }
+inline std::uint64_t align8(std::uint64_t offset) { return (offset + 7) & ~std::uint64_t(7); }
+
+template <typename T>
+inline void put_raw(utils::OutputSink &out, const T &value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    out.write(std::string_view(reinterpret_cast<const char *>(&value), sizeof(T)));
+}
+
+inline void pad(utils::OutputSink &out, std::uint64_t &offset) {
+    while (offset % 8 != 0) {
+        out.put('\0');
+        ++offset;
+    }
+}
+
+template <typename T>
+struct ValueEncoding {
+    static constexpr ValueKind kind = ValueKind::Float64;
+    static constexpr std::uint64_t size = sizeof(double);
+    static void write(utils::OutputSink &out, const T &value) { put_raw(out, static_cast<double>(value)); }
+};
+
+template <typename T>
+    requires(std::is_integral_v<T> && !std::is_same_v<T, bool>)
+struct ValueEncoding<T> {
+    static constexpr ValueKind kind = ValueKind::Int64;
+    static constexpr std::uint64_t size = sizeof(std::int64_t);
+    static void write(utils::OutputSink &out, const T &value) { put_raw(out, static_cast<std::int64_t>(value)); }
+};
+
+template <typename I>
+struct ValueEncoding<boost::rational<I>> {
+    static constexpr ValueKind kind = ValueKind::Rational64;
+    static constexpr std::uint64_t size = 2 * sizeof(std::int64_t);
+    static void write(utils::OutputSink &out, const boost::rational<I> &value) {
+        put_raw(out, static_cast<std::int64_t>(value.numerator()));
+        put_raw(out, static_cast<std::int64_t>(value.denominator()));
+    }
+};
+
+inline std::uint64_t value_size(ValueKind kind) {
+    switch (kind) {
+    case ValueKind::Float64:
+    case ValueKind::Int64:
+        return 8;
+    case ValueKind::Rational64:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+template <typename SolutionType>
+concept HasStatisticsMap = requires(const SolutionType &solution) {
+    { solution.get_statistics() } -> std::convertible_to<std::map<std::string, std::string>>;
+};
+
+template <typename SolutionType, typename GraphType>
+concept HasTypedValues = requires { typename SolutionType::Value; } &&
+                         HasValueMapping<SolutionType, GraphType, typename SolutionType::Value>;
+
+} // namespace detail
+
+/**
+ * @brief Write @p solution of a game on @p graph as a binary solution file
+ *
+ * Streams the sections vertex by vertex through @p out, so writing takes no
+ * memory beyond the sink's buffer.
+ *
+ * @param solve_time Solve time in milliseconds, recorded in the header
+ * @param statistics Key/value statistics; taken from the solution's
+ *        get_statistics() when it has one and this is empty
+ */
+template <typename GraphType, typename SolutionType>
+    requires HasRegions<SolutionType, GraphType>
+void write(utils::OutputSink &out, const GraphType &graph, const SolutionType &solution, double solve_time = 0.0,
+           std::map<std::string, std::string> statistics = {}) {
+    using namespace detail;
+    const std::uint64_t n = num_vertices(graph); // found by ADL for any Boost graph
+    const std::uint64_t words = bitset_words(n);
+    constexpr bool with_strategy = HasStrategy<SolutionType, GraphType>;
+    constexpr bool with_values = HasTypedValues<SolutionType, GraphType>;
+    if constexpr (detail::HasStatisticsMap<SolutionType>) {
+        if (statistics.empty()) {
+            statistics = solution.get_statistics();
+        }
+    }
+
+    Header header{};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version = version;
+    header.num_vertices = n;
+    header.solve_time = solve_time;
+    std::uint64_t offset = sizeof(Header);
+    header.regions = offset;
+    offset += 2 * words * 8;
+    if constexpr (with_strategy) {
+        header.strategy = offset;
+        offset = align8(offset + n * 4);
+    }
+    if constexpr (with_values) {
+        using Encoding = ValueEncoding<typename SolutionType::Value>;
+        header.value_kind = static_cast<std::uint32_t>(Encoding::kind);
+        header.values = offset;
+        offset += words * 8 + n * Encoding::size;
+    }
+    header.statistics = offset;
+    offset += 8;
+    for (const auto &[key, value] : statistics) {
+        offset += 8 + key.size() + value.size();
+    }
+    header.file_size = align8(offset);
+    put_raw(out, header);
+
+    const auto write_bitset = [&](auto &&bit) {
+        for (std::uint64_t w = 0; w < words; ++w) {
+            std::uint64_t word = 0;
+            for (std::uint64_t v = w * 64; v < std::min(n, w * 64 + 64); ++v) {
+                if (bit(v)) {
+                    word |= std::uint64_t(1) << (v % 64);
+                }
+            }
+            put_raw(out, word);
+        }
+    };
+    write_bitset([&](std::uint64_t v) { return solution.is_won_by_player0(v); });
+    write_bitset([&](std::uint64_t v) { return solution.is_won_by_player1(v); });
+    offset = sizeof(Header) + 2 * words * 8;
+    if constexpr (with_strategy) {
+        for (std::uint64_t v = 0; v < n; ++v) {
+            std::uint32_t code = no_strategy;
+            if (solution.has_strategy(v)) {
+                const auto target = solution.get_strategy(v);
+                if (target == boost::graph_traits<GraphType>::null_vertex()) {
+                    code = null_strategy;
+                } else if (static_cast<std::uint64_t>(target) >= null_strategy) {
+                    throw std::length_error("vertex does not fit a 32-bit strategy entry");
+                } else {
+                    code = static_cast<std::uint32_t>(target);
+                }
+            }
+            put_raw(out, code);
+        }
+        offset += n * 4;
+        pad(out, offset);
+    }
+    if constexpr (with_values) {
+        using Encoding = ValueEncoding<typename SolutionType::Value>;
+        write_bitset([&](std::uint64_t v) { return solution.has_value(v); });
+        for (std::uint64_t v = 0; v < n; ++v) {
+            Encoding::write(out, solution.has_value(v) ? solution.get_value(v) : typename SolutionType::Value{});
+        }
+        offset += words * 8 + n * Encoding::size;
+    }
+    put_raw(out, static_cast<std::uint64_t>(statistics.size()));
+    offset += 8;
+    for (const auto &[key, value] : statistics) {
+        put_raw(out, static_cast<std::uint32_t>(key.size()));
+        put_raw(out, static_cast<std::uint32_t>(value.size()));
+        out.write(key).write(value);
+        offset += 8 + key.size() + value.size();
+    }
+    pad(out, offset);
+}
+
+/**
+ * @brief Read-only view of a binary solution file
+ *
+ * open() maps the file into memory, so loading costs one system call and
+ * lookups touch only the pages they need; read() and from_bytes() keep a copy
+ * in memory instead.  Accessors mirror RSQSolution (vertex ids 0..n-1), so the
+ * view satisfies the HasRegions concept and can be compared against solver
+ * output directly.
+ *
+ * @throws std::runtime_error from the factories if the data is not a valid
+ *         solution file of a supported version
+ */
+class BinarySolution {
+  public:
+    static BinarySolution open(const std::string &path) {
+#ifdef GGG_BINARY_SOLUTION_MMAP
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("cannot open solution file: " + path);
+        }
+        struct stat info{};
+        if (::fstat(fd, &info) != 0 || info.st_size == 0) {
+            ::close(fd);
+            throw std::runtime_error("invalid solution file: " + path);
+        }
+        const auto size = static_cast<std::size_t>(info.st_size);
+        void *data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED) {
+            throw std::runtime_error("cannot map solution file: " + path);
+        }
+        std::shared_ptr<const char> storage(static_cast<const char *>(data), [size](const char *p) { ::munmap(const_cast<char *>(p), size); });
+        return BinarySolution(std::move(storage), size);
+#else
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("cannot open solution file: " + path);
+        }
+        return read(file);
+#endif
+    }
+
+    static BinarySolution read(std::istream &is) {
+        return from_bytes(std::vector<char>(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()));
+    }
+
+    static BinarySolution from_bytes(std::vector<char> bytes) {
+        auto owner = std::make_shared<std::vector<char>>(std::move(bytes));
+        const std::size_t size = owner->size();
+        std::shared_ptr<const char> storage(owner, owner->data());
+        return BinarySolution(std::move(storage), size);
+    }
+
+    std::size_t num_vertices() const { return static_cast<std::size_t>(header_.num_vertices); }
+    double solve_time() const { return header_.solve_time; }
+    ValueKind value_kind() const { return static_cast<ValueKind>(header_.value_kind); }
+    bool has_strategies() const { return header_.strategy != 0; }
+    bool has_values() const { return header_.values != 0; }
+
+    bool is_won_by_player0(std::size_t vertex) const { return test(header_.regions, vertex); }
+    bool is_won_by_player1(std::size_t vertex) const { return test(header_.regions + words() * 8, vertex); }
+    int get_winning_player(std::size_t vertex) const {
+        return is_won_by_player0(vertex) ? 0 : is_won_by_player1(vertex) ? 1 : -1;
+    }
+
+    bool has_strategy(std::size_t vertex) const { return strategy_code(vertex) != no_strategy; }
+
+    /**
+     * @return Successor of @p vertex; SIZE_MAX (null_vertex of vecS graphs)
+     *         if it has none or stored null
+     */
+    std::size_t get_strategy(std::size_t vertex) const {
+        const std::uint32_t code = strategy_code(vertex);
+        return code >= null_strategy ? std::numeric_limits<std::size_t>::max() : code;
+    }
+
+    bool has_value(std::size_t vertex) const { return has_values() && test(header_.values, vertex); }
+
+    /**
+     * @return Value of @p vertex as a double, 0 if it has none
+     */
+    double get_value(std::size_t vertex) const {
+        if (!has_value(vertex)) {
+            return 0.0;
+        }
+        switch (value_kind()) {
+        case ValueKind::Float64:
+            return load<double>(value_offset(vertex));
+        case ValueKind::Int64:
+            return static_cast<double>(load<std::int64_t>(value_offset(vertex)));
+        case ValueKind::Rational64:
+            return static_cast<double>(load<std::int64_t>(value_offset(vertex))) /
+                   static_cast<double>(load<std::int64_t>(value_offset(vertex) + 8));
+        default:
+            return 0.0;
+        }
+    }
+
+    /**
+     * @brief Exact value of @p vertex as numerator/denominator (Int64 and Rational64 files)
+     * @throws std::logic_error for Float64 files
+     */
+    std::pair<std::int64_t, std::int64_t> get_exact_value(std::size_t vertex) const {
+        if (value_kind() != ValueKind::Int64 && value_kind() != ValueKind::Rational64) {
+            throw std::logic_error("solution values are not stored exactly");
+        }
+        if (!has_value(vertex)) {
+            return {0, 1};
+        }
+        const std::int64_t numerator = load<std::int64_t>(value_offset(vertex));
+        return {numerator, value_kind() == ValueKind::Int64 ? 1 : load<std::int64_t>(value_offset(vertex) + 8)};
+    }
+
+    std::map<std::string, std::string> get_statistics() const {
+        std::map<std::string, std::string> statistics;
+        std::uint64_t offset = header_.statistics;
+        const auto count = load<std::uint64_t>(offset);
+        offset += 8;
+        for (std::uint64_t i = 0; i < count; ++i) {
+            const auto key_size = load<std::uint32_t>(offset);
+            const auto value_size = load<std::uint32_t>(offset + 4);
+            offset += 8;
+            check_range(offset, key_size + std::uint64_t(value_size));
+            std::string key(data_.get() + offset, key_size);
+            std::string value(data_.get() + offset + key_size, value_size);
+            statistics.emplace(std::move(key), std::move(value));
+            offset += key_size + value_size;
+        }
+        return statistics;
+    }
+
+  private:
+    std::shared_ptr<const char> data_;
+    std::size_t size_;
+    Header header_{};
+
+    BinarySolution(std::shared_ptr<const char> data, std::size_t size) : data_(std::move(data)), size_(size) {
+        if (size_ < sizeof(Header)) {
+            throw std::runtime_error("invalid solution file: truncated header");
+        }
+        std::memcpy(&header_, data_.get(), sizeof(Header));
+        if (std::memcmp(header_.magic, magic, sizeof(magic)) != 0) {
+            throw std::runtime_error("invalid solution file: bad magic");
+        }
+        if (header_.version != version) {
+            throw std::runtime_error("unsupported solution file version " + std::to_string(header_.version));
+        }
+        if (header_.file_size > size_) {
+            throw std::runtime_error("invalid solution file: truncated");
+        }
+        const std::uint64_t n = header_.num_vertices;
+        check_range(header_.regions, 2 * words() * 8);
+        if (header_.strategy != 0) {
+            check_range(header_.strategy, n * 4);
+        }
+        if (header_.values != 0) {
+            check_range(header_.values, words() * 8 + n * detail::value_size(value_kind()));
+        }
+        check_range(header_.statistics, 8);
+    }
+
+    std::uint64_t words() const { return detail::bitset_words(header_.num_vertices); }
+
+    void check_range(std::uint64_t offset, std::uint64_t length) const {
+        if (offset > header_.file_size || length > header_.file_size - offset) {
+            throw std::runtime_error("invalid solution file: section out of range");
+        }
+    }
+
+    template <typename T>
+    T load(std::uint64_t offset) const {
+        T value;
+        std::memcpy(&value, data_.get() + offset, sizeof(T));
+        return value;
+    }
+
+    bool test(std::uint64_t bitset, std::size_t vertex) const {
+        if (vertex >= header_.num_vertices) {
+            return false;
+        }
+        return (load<std::uint64_t>(bitset + (vertex / 64) * 8) >> (vertex % 64)) & 1;
+    }
+
+    std::uint32_t strategy_code(std::size_t vertex) const {
+        if (!has_strategies() || vertex >= header_.num_vertices) {
+            return no_strategy;
+        }
+        return load<std::uint32_t>(header_.strategy + vertex * 4);
+    }
+
+    std::uint64_t value_offset(std::size_t vertex) const {
+        return header_.values + words() * 8 + vertex * detail::value_size(value_kind());
+    }
+};
+
+} // namespace binary
+} // namespace solutions
+} // namespace ggg
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <boost/graph/graph_traits.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ggg {
+namespace solutions {
+
+/**
+ * @brief Slot of a DenseVertexMap holding any value type
+ *
+ * A slot codec maps a value to its stored form:
+ * - storage_type: element type of the dense array
+ * - encode(value), decode(s)
+ * - has_empty: whether one stored form is reserved for "no entry", given
+ *   by empty() and recognised by is_empty(s)
+ *
+ * The generic slot stores the value itself and reserves no form, so the map
+ * keeps a presence bitset next to the array: a double costs 8 bytes and a bit.
+ */
+template <typename T>
+struct DenseSlot {
+    using storage_type = T;
+    static constexpr bool has_empty = false;
+    static storage_type encode(const T &value) { return value; }
+    static T decode(const storage_type &slot) { return slot; }
+};
+
+/**
+ * @brief Slot of a winning player (-1, 0 or 1) packed into one byte
+ */
+struct PlayerSlot {
+    using storage_type = std::int8_t;
+    static constexpr bool has_empty = true;
+    static storage_type empty() { return std::numeric_limits<std::int8_t>::min(); }
+    static bool is_empty(storage_type slot) { return slot == empty(); }
+    static storage_type encode(int player) { return static_cast<std::int8_t>(player); }
+    static int decode(storage_type slot) { return slot; }
+};
+
+/**
+ * @brief Slot of a vertex descriptor packed into 32 bits
+ *
+ * The two largest codes stand for "no entry" and for null_vertex(), which
+ * solvers store for vertices without a meaningful choice.
+ *
+ * @throws std::length_error from encode() for vertices that do not fit
+ */
+template <typename GraphType>
+struct VertexSlot {
+    using Vertex = typename boost::graph_traits<GraphType>::vertex_descriptor;
+    using storage_type = std::uint32_t;
+    static constexpr bool has_empty = true;
+    static constexpr storage_type null_code = std::numeric_limits<std::uint32_t>::max() - 1;
+    static storage_type empty() { return std::numeric_limits<std::uint32_t>::max(); }
+    static bool is_empty(storage_type slot) { return slot == empty(); }
+    static storage_type encode(Vertex vertex) {
+        if (vertex == boost::graph_traits<GraphType>::null_vertex()) {
+            return null_code;
+        }
+        if (static_cast<std::size_t>(vertex) >= null_code) {
+            throw std::length_error("vertex does not fit a 32-bit strategy slot");
+        }
+        return static_cast<storage_type>(vertex);
+    }
+    static Vertex decode(storage_type slot) {
+        return slot == null_code ? boost::graph_traits<GraphType>::null_vertex() : static_cast<Vertex>(slot);
+    }
+};
+
+/**
+ * @brief Map from vertex descriptors 0..n-1 to values, stored as one array
+ *
+ * A drop-in for the std::map the solutions used to hold: iteration visits the
+ * vertices with an entry in ascending order and yields std::pair<Vertex, T> by
+ * value, so range-for with structured bindings and `p.first`/`p.second` work
+ * unchanged.  Lookups and updates index the array directly; it grows to the
+ * largest vertex set so far.  Slots without an empty form (DenseSlot) add a
+ * presence bitset.
+ *
+ * @tparam Vertex Integral vertex descriptor (vecS)
+ * @tparam T Mapped type
+ * @tparam Slot Codec of the stored form (see DenseSlot)
+ */
+template <typename Vertex, typename T, typename Slot = DenseSlot<T>>
+class DenseVertexMap {
+    static_assert(std::is_integral_v<Vertex>, "DenseVertexMap requires integral (vecS) vertex descriptors");
+
+  public:
+    using key_type = Vertex;
+    using mapped_type = T;
+    using value_type = std::pair<Vertex, T>;
+    using size_type = std::size_t;
+    using storage_type = typename Slot::storage_type;
+
+    class const_iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = DenseVertexMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type;
+
+        struct pointer {
+            value_type entry;
+            const value_type *operator->() const { return &entry; }
+        };
+
+        const_iterator() = default;
+
+        reference operator*() const { return {static_cast<Vertex>(index_), Slot::decode(map_->slots_[index_])}; }
+        pointer operator->() const { return {**this}; }
+        const_iterator &operator++() {
+            ++index_;
+            skip_empty();
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+        bool operator==(const const_iterator &other) const { return index_ == other.index_; }
+        bool operator!=(const const_iterator &other) const { return index_ != other.index_; }
+
+      private:
+        friend class DenseVertexMap;
+        const DenseVertexMap *map_ = nullptr;
+        std::size_t index_ = 0;
+
+        const_iterator(const DenseVertexMap *map, std::size_t index) : map_(map), index_(index) {}
+        void skip_empty() {
+            while (index_ < map_->slots_.size() && !map_->occupied(index_)) {
+                ++index_;
+            }
+        }
+    };
+    using iterator = const_iterator;
+
+    DenseVertexMap() = default;
+
+    const_iterator begin() const {
+        const_iterator it(this, 0);
+        it.skip_empty();
+        return it;
+    }
+    const_iterator end() const { return const_iterator(this, slots_.size()); }
+
+    /**
+     * @brief Number of vertices with an entry
+     */
+    size_type size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    bool contains(Vertex vertex) const {
+        const auto index = static_cast<std::size_t>(vertex);
+        return index < slots_.size() && occupied(index);
+    }
+    size_type count(Vertex vertex) const { return contains(vertex) ? 1 : 0; }
+    const_iterator find(Vertex vertex) const {
+        return contains(vertex) ? const_iterator(this, static_cast<std::size_t>(vertex)) : end();
+    }
+
+    /**
+     * @throws std::out_of_range if @p vertex has no entry
+     */
+    T at(Vertex vertex) const {
+        if (!contains(vertex)) {
+            throw std::out_of_range("vertex has no entry");
+        }
+        return Slot::decode(slots_[static_cast<std::size_t>(vertex)]);
+    }
+
+    /**
+     * @brief Entry of @p vertex, or @p fallback if it has none
+     */
+    T get(Vertex vertex, const T &fallback) const {
+        return contains(vertex) ? Slot::decode(slots_[static_cast<std::size_t>(vertex)]) : fallback;
+    }
+
+    void set(Vertex vertex, const T &value) {
+        const auto index = static_cast<std::size_t>(vertex);
+        if (index >= slots_.size()) {
+            grow(index + 1);
+        }
+        if (!occupied(index)) {
+            ++size_;
+            if constexpr (!Slot::has_empty) {
+                present_[index] = true;
+            }
+        }
+        slots_[index] = Slot::encode(value);
+    }
+
+    void erase(Vertex vertex) {
+        if (contains(vertex)) {
+            const auto index = static_cast<std::size_t>(vertex);
+            if constexpr (Slot::has_empty) {
+                slots_[index] = Slot::empty();
+            } else {
+                present_[index] = false;
+            }
+            --size_;
+        }
+    }
+
+    /**
+     * @brief Allocate slots for vertices 0..@p num_vertices - 1 up front
+     */
+    void reserve(size_type num_vertices) {
+        if (num_vertices > slots_.size()) {
+            grow(num_vertices);
+        }
+    }
+
+    void clear() {
+        slots_.clear();
+        present_.clear();
+        size_ = 0;
+    }
+
+  private:
+    std::vector<storage_type> slots_;
+    // Presence of every slot, for slots without an empty form
+    std::vector<bool> present_;
+    size_type size_ = 0;
+
+    bool occupied(std::size_t index) const {
+        if constexpr (Slot::has_empty) {
+            return !Slot::is_empty(slots_[index]);
+        } else {
+            return present_[index];
+        }
+    }
+
+    void grow(std::size_t num_slots) {
+        if constexpr (Slot::has_empty) {
+            slots_.resize(num_slots, Slot::empty());
+        } else {
+            slots_.resize(num_slots);
+            present_.resize(num_slots, false);
+        }
+    }
+};
+
+} // namespace solutions
+} // namespace ggg
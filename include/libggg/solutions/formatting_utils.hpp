@@ -7,14 +7,49 @@
 # */
 #pragma once
 
+#include "libggg/utils/output_sink.hpp"
 #include <ostream>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace ggg {
 namespace solutions {
 namespace detail {
 
+/**
+ * @brief Convert a quantitative value into a JSON fragment.
+ * @tparam T Value type; arithmetic types are written as JSON numbers, any other
+ *           streamable type (e.g. `boost::rational`) as a JSON string of its `operator<<` output
+ * @param v Value to convert
+ * @returns JSON fragment such as `42`, `0.500000` or `"3/2"`
+ */
+template <typename T>
+inline std::string value_to_json(const T &v) {
+    if constexpr (std::is_arithmetic_v<T>) {
+        return std::to_string(v);
+    } else {
+        std::ostringstream oss;
+        oss << '"' << v << '"';
+        return oss.str();
+    }
+}
+
+/**
+ * @brief Write a quantitative value as a JSON fragment, as value_to_json() would format it
+ */
+template <typename T>
+inline void write_value_json(utils::OutputSink &out, const T &v) {
+    if constexpr (std::is_floating_point_v<T>) {
+        out.fixed(v);
+    } else if constexpr (std::is_arithmetic_v<T>) {
+        out.integer(v);
+    } else {
+        out.put('"').streamed(v).put('"');
+    }
+}
+
 /**
  * @brief Build a JSON object string from a map and return it paired with a field name.
  * @tparam Vertex   Reserved for overload resolution / caller context (unused)
@@ -88,6 +123,62 @@ inline std::ostream &stream_map_label(std::ostream &os, const std::string &label
     return os;
 }
 
+/**
+ * @brief Write a map as a JSON object member, in the format of map_member_json()/merge_json_members()
+ * @tparam Map        Map-like container type; element type must be pair-like with key convertible to std::size_t
+ * @tparam WriteValue Callable with signature void(utils::OutputSink&, const T&) that writes a mapped value as JSON
+ * @param out         Sink to write into
+ * @param key         JSON member name, written as "key":
+ * @param m           Map to write; each entry emitted as "&lt;index&gt;": &lt;value-json&gt;
+ * @param write_value Callable that writes each mapped value
+ */
+template <typename Map, typename WriteValue>
+inline void write_map_json(utils::OutputSink &out, std::string_view key, const Map &m, WriteValue write_value) {
+    out.put('"').write(key).write("\":{");
+    bool first = true;
+    for (const auto &p : m) {
+        if (!first)
+            out.put(',');
+        first = false;
+        out.put('"').integer(static_cast<std::size_t>(p.first)).write("\": ");
+        write_value(out, p.second);
+    }
+    out.put('}');
+}
+
+/**
+ * @brief Write a labeled map in the "label: {k:v,...}" format of stream_map_label()
+ * @tparam Map        Map-like container type; element type must be pair-like with key convertible to std::size_t
+ * @tparam WriteValue Callable with signature void(utils::OutputSink&, const T&) that writes a mapped value
+ */
+template <typename Map, typename WriteValue>
+inline void write_map_text(utils::OutputSink &out, std::string_view label, const Map &m, WriteValue write_value) {
+    out.write(label).write(": {");
+    bool first = true;
+    for (const auto &p : m) {
+        if (!first)
+            out.put(',');
+        first = false;
+        out.integer(static_cast<std::size_t>(p.first)).put(':');
+        write_value(out, p.second);
+    }
+    out.put('}');
+}
+
+/**
+ * @brief Collect what @p write puts into a sink as a string
+ * @tparam Write Callable with signature void(utils::OutputSink&)
+ */
+template <typename Write>
+inline std::string write_to_string(Write write) {
+    std::ostringstream oss;
+    {
+        utils::OutputSink out(oss);
+        write(out);
+    }
+    return oss.str();
+}
+
 } // namespace detail
 } // namespace solutions
 } // namespace ggg
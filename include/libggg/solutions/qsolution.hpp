@@ -1,9 +1,9 @@
 #pragma once
 
+#include "libggg/solutions/dense_vertex_map.hpp"
 #include "libggg/solutions/formatting_utils.hpp"
 #include "libggg/solutions/isolution.hpp"
 #include <boost/graph/graph_traits.hpp>
-#include <map>
 
 namespace ggg {
 namespace solutions {
@@ -16,7 +16,8 @@ namespace solutions {
  *
  * QSolution offers accessors to set and query numeric values associated with vertices
  * (for example, values produced by value-iteration or mean-payoff analyses). It
- * also provides JSON/text conversion for the stored values.
+ * also provides JSON/text conversion for the stored values, which are kept in one
+ * contiguous array indexed by vertex.
  */
 template <typename GraphType, typename ValueType = double>
 class QSolution : public virtual ISolution {
@@ -25,26 +26,39 @@ class QSolution : public virtual ISolution {
     using Value = ValueType;
 
   protected:
-    std::map<Vertex, ValueType> values_;
+    using Values = DenseVertexMap<Vertex, ValueType>;
+    Values values_;
 
   public:
     QSolution() = default;
 
     ValueType get_value(Vertex vertex) const {
-        const auto it = values_.find(vertex);
-        return it != values_.end() ? it->second : ValueType{};
+        return values_.get(vertex, ValueType{});
+    }
+    bool has_value(Vertex vertex) const { return values_.contains(vertex); }
+    void set_value(Vertex vertex, const ValueType &value) { values_.set(vertex, value); }
+    const Values &get_values() const { return values_; }
+
+    void write_json_member(utils::OutputSink &out) const {
+        detail::write_map_json(out, "values", values_, [](utils::OutputSink &out, const ValueType &v) { detail::write_value_json(out, v); });
+    }
+    void write_json(utils::OutputSink &out) const {
+        out.put('{');
+        write_json_member(out);
+        out.put('}');
+    }
+    void write_text(utils::OutputSink &out) const {
+        detail::write_map_text(out, "Values", values_, [](utils::OutputSink &out, const ValueType &v) { out.streamed(v); });
     }
-    bool has_value(Vertex vertex) const { return values_.find(vertex) != values_.end(); }
-    void set_value(Vertex vertex, const ValueType &value) { values_[vertex] = value; }
-    const std::map<Vertex, ValueType> &get_values() const { return values_; }
 
     std::string to_json() const {
-        auto member = detail::map_member_json<Vertex>("values", values_, [](const ValueType &v) { return std::to_string(v); });
-        return detail::merge_json_members({member});
+        return detail::write_to_string([this](utils::OutputSink &out) { write_json(out); });
     }
 
     friend std::ostream &operator<<(std::ostream &os, const QSolution<GraphType, ValueType> &sol) {
-        return detail::stream_map_label(os, "Values", sol.values_, [](std::ostream &os, const ValueType &v) -> std::ostream & { os << v; return os; });
+        utils::OutputSink out(os);
+        sol.write_text(out);
+        return os;
     }
 };
 
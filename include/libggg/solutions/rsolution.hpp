@@ -1,9 +1,9 @@
 #pragma once
 
+#include "libggg/solutions/dense_vertex_map.hpp"
 #include "libggg/solutions/formatting_utils.hpp"
 #include "libggg/solutions/isolution.hpp"
 #include <boost/graph/graph_traits.hpp>
-#include <map>
 
 namespace ggg {
 namespace solutions {
@@ -16,7 +16,7 @@ namespace solutions {
  *
  * RSolution provides methods to query and set the winning player for individual
  * vertices and to obtain the full map of winning regions. It also implements
- * JSON/text conversion helpers.
+ * JSON/text conversion helpers. Winners are kept one byte per vertex.
  */
 template <typename GraphType>
 class RSolution : public virtual ISolution {
@@ -24,33 +24,38 @@ class RSolution : public virtual ISolution {
     using Vertex = typename boost::graph_traits<GraphType>::vertex_descriptor;
 
   protected:
-    std::map<Vertex, int> winning_regions_;
+    using WinningRegions = DenseVertexMap<Vertex, int, PlayerSlot>;
+    WinningRegions winning_regions_;
 
   public:
     RSolution() = default;
 
-    bool is_won_by_player0(Vertex vertex) const {
-        const auto it = winning_regions_.find(vertex);
-        return it != winning_regions_.end() && it->second == 0;
+    bool is_won_by_player0(Vertex vertex) const { return get_winning_player(vertex) == 0; }
+    bool is_won_by_player1(Vertex vertex) const { return get_winning_player(vertex) == 1; }
+    int get_winning_player(Vertex vertex) const { return winning_regions_.get(vertex, -1); }
+    void set_winning_player(Vertex vertex, int player) { winning_regions_.set(vertex, player); }
+    const WinningRegions &get_winning_regions() const { return winning_regions_; }
+
+    void write_json_member(utils::OutputSink &out) const {
+        detail::write_map_json(out, "winning_regions", winning_regions_, [](utils::OutputSink &out, int player) { out.integer(player); });
     }
-    bool is_won_by_player1(Vertex vertex) const {
-        const auto it = winning_regions_.find(vertex);
-        return it != winning_regions_.end() && it->second == 1;
+    void write_json(utils::OutputSink &out) const {
+        out.put('{');
+        write_json_member(out);
+        out.put('}');
     }
-    int get_winning_player(Vertex vertex) const {
-        const auto it = winning_regions_.find(vertex);
-        return it != winning_regions_.end() ? it->second : -1;
+    void write_text(utils::OutputSink &out) const {
+        detail::write_map_text(out, "Winning regions", winning_regions_, [](utils::OutputSink &out, int player) { out.integer(player); });
     }
-    void set_winning_player(Vertex vertex, int player) { winning_regions_[vertex] = player; }
-    const std::map<Vertex, int> &get_winning_regions() const { return winning_regions_; }
 
     std::string to_json() const {
-        auto member = detail::map_member_json<Vertex>("winning_regions", winning_regions_, [](int player) { return std::to_string(player); });
-        return detail::merge_json_members({member});
+        return detail::write_to_string([this](utils::OutputSink &out) { write_json(out); });
     }
 
     friend std::ostream &operator<<(std::ostream &os, const RSolution<GraphType> &sol) {
-        return detail::stream_map_label(os, "Winning regions", sol.winning_regions_, [](std::ostream &os, int player) -> std::ostream & { os << player; return os; });
+        utils::OutputSink out(os);
+        sol.write_text(out);
+        return os;
     }
 };
 
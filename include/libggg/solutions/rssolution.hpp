@@ -22,18 +22,26 @@ class RSSolution : public RSolution<GraphType>, public SSolution<GraphType, Stra
   public:
     RSSolution() = default;
 
+    void write_json(utils::OutputSink &out) const {
+        out.put('{');
+        RSolution<GraphType>::write_json_member(out);
+        out.put(',');
+        SSolution<GraphType, StrategyType>::write_json_member(out);
+        out.put('}');
+    }
+    void write_text(utils::OutputSink &out) const {
+        RSolution<GraphType>::write_text(out);
+        out.put('\n');
+        SSolution<GraphType, StrategyType>::write_text(out);
+    }
+
     std::string to_json() const {
-        auto regions_member = detail::map_member_json<typename RSolution<GraphType>::Vertex>(
-            "winning_regions", this->get_winning_regions(), [](int player) { return std::to_string(player); });
-        auto strategy_member = detail::map_member_json<typename SSolution<GraphType, StrategyType>::Vertex>(
-            "strategy", this->get_strategies(), [this](const StrategyType &s) { return ggg::strategy::to_json<GraphType>(s); });
-        return detail::merge_json_members({regions_member, strategy_member});
+        return detail::write_to_string([this](utils::OutputSink &out) { write_json(out); });
     }
 
     friend std::ostream &operator<<(std::ostream &os, const RSSolution<GraphType, StrategyType> &sol) {
-        detail::stream_map_label(os, "Winning regions", sol.get_winning_regions(), [](std::ostream &os, int player) -> std::ostream & { os << player; return os; });
-        os << '\n';
-        detail::stream_map_label(os, "Strategy", sol.get_strategies(), [&](std::ostream &os2, const StrategyType &s) -> std::ostream & { return ggg::strategy::to_stream<GraphType>(os2, s); });
+        utils::OutputSink out(os);
+        sol.write_text(out);
         return os;
     }
 };
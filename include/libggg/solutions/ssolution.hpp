@@ -1,12 +1,13 @@
 #pragma once
 
+#include "libggg/solutions/dense_vertex_map.hpp"
 #include "libggg/solutions/formatting_utils.hpp"
 #include "libggg/solutions/isolution.hpp"
 #include "libggg/strategy/deterministic.hpp"
 #include "libggg/strategy/finite_memory.hpp"
 #include "libggg/strategy/mixing.hpp"
 #include <boost/graph/graph_traits.hpp>
-#include <map>
+#include <type_traits>
 
 namespace ggg {
 namespace solutions {
@@ -19,6 +20,7 @@ namespace solutions {
  *
  * SSolution provides accessors to set, query and retrieve strategies for vertices.
  * It emits strategy information in JSON/text form using the project's strategy helpers.
+ * Deterministic strategies are kept as 32-bit successor indices, one per vertex.
  */
 template <typename GraphType, typename StrategyType = ggg::strategy::DeterministicStrategy<GraphType>>
 class SSolution : public virtual ISolution {
@@ -27,33 +29,45 @@ class SSolution : public virtual ISolution {
     using Strategy = StrategyType;
 
   protected:
-    std::map<Vertex, StrategyType> strategy_;
+    using Strategies = DenseVertexMap<Vertex, StrategyType,
+                                      std::conditional_t<std::is_same_v<StrategyType, ggg::strategy::DeterministicStrategy<GraphType>>,
+                                                         VertexSlot<GraphType>, DenseSlot<StrategyType>>>;
+    Strategies strategy_;
 
   public:
     SSolution() = default;
 
     StrategyType get_strategy(Vertex vertex) const {
-        const auto it = strategy_.find(vertex);
-        if (it != strategy_.end()) {
-            return it->second;
-        }
         if constexpr (std::is_same_v<StrategyType, ggg::strategy::DeterministicStrategy<GraphType>>) {
-            return boost::graph_traits<GraphType>::null_vertex();
+            return strategy_.get(vertex, boost::graph_traits<GraphType>::null_vertex());
         } else {
-            return StrategyType{};
+            return strategy_.get(vertex, StrategyType{});
         }
     }
-    bool has_strategy(Vertex vertex) const { return strategy_.find(vertex) != strategy_.end(); }
-    void set_strategy(Vertex vertex, const StrategyType &strategy) { strategy_[vertex] = strategy; }
-    const std::map<Vertex, StrategyType> &get_strategies() const { return strategy_; }
+    bool has_strategy(Vertex vertex) const { return strategy_.contains(vertex); }
+    void set_strategy(Vertex vertex, const StrategyType &strategy) { strategy_.set(vertex, strategy); }
+    const Strategies &get_strategies() const { return strategy_; }
+
+    void write_json_member(utils::OutputSink &out) const {
+        detail::write_map_json(out, "strategy", strategy_, [](utils::OutputSink &out, const StrategyType &s) { ggg::strategy::write_json<GraphType>(out, s); });
+    }
+    void write_json(utils::OutputSink &out) const {
+        out.put('{');
+        write_json_member(out);
+        out.put('}');
+    }
+    void write_text(utils::OutputSink &out) const {
+        detail::write_map_text(out, "Strategy", strategy_, [](utils::OutputSink &out, const StrategyType &s) { ggg::strategy::write_text<GraphType>(out, s); });
+    }
 
     std::string to_json() const {
-        auto member = detail::map_member_json<Vertex>("strategy", strategy_, [](const StrategyType &s) { return ggg::strategy::to_json<GraphType>(s); });
-        return detail::merge_json_members({member});
+        return detail::write_to_string([this](utils::OutputSink &out) { write_json(out); });
     }
 
     friend std::ostream &operator<<(std::ostream &os, const SSolution<GraphType, StrategyType> &sol) {
-        return detail::stream_map_label(os, "Strategy", sol.strategy_, [](std::ostream &os, const StrategyType &s) -> std::ostream & { return ggg::strategy::to_stream<GraphType>(os, s); });
+        utils::OutputSink out(os);
+        sol.write_text(out);
+        return os;
     }
 };
 
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "libggg/graphs/csr_utilities.hpp"
+#include "libggg/utils/parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <boost/graph/graph_traits.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace ggg {
+namespace solutions {
+
+/**
+ * @brief Outcome of checking a solution certificate
+ */
+struct Verification {
+    bool valid = true;
+    std::string reason; ///< Why the solution was rejected; empty if it is valid
+
+    explicit operator bool() const { return valid; }
+
+    static Verification failure(std::string reason) { return {false, std::move(reason)}; }
+};
+
+/**
+ * @brief One-player games left by fixing the winners' strategies
+ *
+ * Vertex @c v keeps one edge, to its strategy successor, if its owner wins
+ * it, and all its edges otherwise.  After check_closure() has passed, no edge
+ * leaves a winning region, so each region with its edges is the game its
+ * opponent plays against the fixed strategy, and the solution is correct iff
+ * the opponent wins no cycle in it.
+ */
+struct InducedGame {
+    graphs::csr_utilities::CompressedAdjacency edges;
+    std::vector<std::int8_t> winner; ///< Winner of every vertex (0 or 1)
+    std::vector<std::size_t> region[2]; ///< Vertices won by each player, in increasing order
+};
+
+namespace detail {
+
+// Lowest-vertex failure across concurrently checked blocks, so messages do
+// not depend on the thread schedule.
+class FirstFailure {
+  public:
+    void record(std::size_t key, std::string reason) {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        if (key < key_) {
+            key_ = key;
+            reason_ = std::move(reason);
+        }
+    }
+    bool failed() const { return key_ != std::numeric_limits<std::size_t>::max(); }
+    Verification result() const { return failed() ? Verification::failure(reason_) : Verification{}; }
+
+  private:
+    std::mutex mutex_;
+    std::size_t key_ = std::numeric_limits<std::size_t>::max();
+    std::string reason_;
+};
+
+} // namespace detail
+
+/**
+ * @brief Check that every vertex has a winner and the winners' strategies keep play in their regions
+ *
+ * Checks, for every vertex v won by player p: p owns v and v's strategy is
+ * an edge into p's region, or the opponent owns v and all of v's edges stay
+ * in p's region.  On success fills @p game.
+ *
+ * @param solution Anything with get_winning_player, has_strategy and get_strategy
+ * @param threads Worker threads, 0 for ggg::utils::thread_count()
+ */
+template <typename GraphType, typename SolutionType>
+Verification check_closure(const GraphType &graph, const SolutionType &solution, InducedGame &game, unsigned threads = 0) {
+    const std::size_t n = boost::num_vertices(graph);
+    const auto successors = graphs::csr_utilities::make_successors(graph);
+    const auto name = [&](std::size_t v) { return "'" + graph[v].name + "'"; };
+    game.winner.assign(n, -1);
+    for (std::size_t v = 0; v < n; ++v) {
+        const int player = solution.get_winning_player(v);
+        if (player != 0 && player != 1) {
+            return Verification::failure("vertex " + name(v) + " has no winner");
+        }
+        game.winner[v] = static_cast<std::int8_t>(player);
+    }
+
+    // Per vertex: the edges it keeps in the induced game (0 marks a failure).
+    std::vector<std::size_t> degree(n, 0);
+    std::vector<std::size_t> choice(n, 0);
+    detail::FirstFailure failure;
+    utils::parallel_for(n, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t v = begin; v < end; ++v) {
+            const int p = game.winner[v];
+            const auto out = successors.neighbours(v);
+            if (graph[v].player == p) {
+                if (!solution.has_strategy(v)) {
+                    failure.record(v, "player " + std::to_string(p) + " has no strategy at " + name(v) + ", which it wins");
+                    return;
+                }
+                const std::size_t u = static_cast<std::size_t>(solution.get_strategy(v));
+                if (std::find(out.begin(), out.end(), u) == out.end()) {
+                    failure.record(v, "the strategy at " + name(v) + " does not follow an edge");
+                    return;
+                }
+                if (game.winner[u] != p) {
+                    failure.record(v, "the strategy at " + name(v) + " leaves the winning region of player " + std::to_string(p));
+                    return;
+                }
+                degree[v] = 1;
+                choice[v] = u;
+            } else {
+                for (const std::size_t u : out) {
+                    if (game.winner[u] != p) {
+                        failure.record(v, "player " + std::to_string(1 - p) + " can leave the winning region of player " +
+                                              std::to_string(p) + " from " + name(v) + " to " + name(u));
+                        return;
+                    }
+                }
+                degree[v] = out.size();
+            }
+        }
+    }, threads, 4096);
+    if (failure.failed()) {
+        return failure.result();
+    }
+
+    game.edges.offsets.assign(n + 1, 0);
+    for (std::size_t v = 0; v < n; ++v) {
+        game.edges.offsets[v + 1] = game.edges.offsets[v] + degree[v];
+    }
+    game.edges.targets.resize(game.edges.offsets[n]);
+    for (std::size_t v = 0; v < n; ++v) {
+        if (graph[v].player == game.winner[v]) {
+            game.edges.targets[game.edges.offsets[v]] = choice[v];
+        } else {
+            const auto out = successors.neighbours(v);
+            std::copy(out.begin(), out.end(), game.edges.targets.begin() + static_cast<std::ptrdiff_t>(game.edges.offsets[v]));
+        }
+    }
+    game.region[0].clear();
+    game.region[1].clear();
+    for (std::size_t v = 0; v < n; ++v) {
+        game.region[game.winner[v]].push_back(v);
+    }
+    return {};
+}
+
+/**
+ * @brief Run @p check on every cyclic strongly connected component of a winning region, in parallel
+ *
+ * Components are handed out to the worker threads one at a time, largest
+ * first.  The reported failure is that of the first component in Tarjan
+ * order, whatever the schedule.
+ *
+ * @param check Called as `check(const CompressedAdjacency &local, std::span<const std::size_t> members)`
+ *        with the component's subgraph, vertex @c i of @c local being
+ *        @c members[i] (sorted); returns std::optional<std::string>, a reason
+ *        to reject the solution
+ * @param threads Worker threads, 0 for ggg::utils::thread_count()
+ */
+template <typename Check>
+Verification check_cyclic_components(const InducedGame &game, int player, Check &&check, unsigned threads = 0) {
+    std::vector<std::vector<std::size_t>> components;
+    {
+        graphs::csr_utilities::StrongComponents scc(game.edges);
+        const std::span<const std::size_t> region(game.region[player]);
+        scc.run(region, [&](std::size_t v) { return game.winner[v] == player; },
+                [&](std::span<const std::size_t> members, bool cyclic) {
+                    if (cyclic) {
+                        components.emplace_back(members.begin(), members.end());
+                        std::sort(components.back().begin(), components.back().end());
+                    }
+                });
+    }
+    std::vector<std::size_t> order(components.size());
+    for (std::size_t k = 0; k < order.size(); ++k) {
+        order[k] = k;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return components[a].size() > components[b].size(); });
+
+    detail::FirstFailure failure;
+    std::atomic<std::size_t> next{0};
+    const std::size_t workers = std::min<std::size_t>(utils::thread_count(threads), std::max<std::size_t>(1, components.size()));
+    utils::parallel_for(workers, [&](std::size_t, std::size_t) {
+        for (std::size_t i = next++; i < order.size(); i = next++) {
+            const auto &members = components[order[i]];
+            const auto local = graphs::csr_utilities::make_subgraph(game.edges, members);
+            if (auto reason = check(local, std::span<const std::size_t>(members))) {
+                failure.record(order[i], std::move(*reason));
+            }
+        }
+    }, static_cast<unsigned>(workers));
+    return failure.result();
+}
+
+} // namespace solutions
+} // namespace ggg
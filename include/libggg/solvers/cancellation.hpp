@@ -0,0 +1,161 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace ggg {
+namespace solvers {
+
+/**
+ * @brief Thrown out of a solver's solve() when its run was cancelled
+ */
+class Cancelled : public std::runtime_error {
+  public:
+    Cancelled() : std::runtime_error("solver run cancelled") {}
+};
+
+/**
+ * @brief Request to stop a solver run, set from another thread
+ *
+ * Cancellation is cooperative: solvers call throw_if_cancelled() in their
+ * main loops, and a run observes the token installed for its thread by a
+ * CancellationScope.  Checks are made by the thread that called solve();
+ * solvers that fan work out with ggg::utils::parallel_for check between
+ * parallel phases, so a run stops at the end of the current phase.
+ * Deadlines are turned into cancel() calls by a DeadlineWatchdog, so a
+ * check never reads the clock.
+ */
+class CancellationToken {
+  public:
+    void cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+    bool cancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+
+  private:
+    std::atomic<bool> cancelled_{false};
+};
+
+namespace detail {
+
+inline thread_local const CancellationToken *current_token = nullptr;
+
+} // namespace detail
+
+/**
+ * @brief Install @p token for solver runs on this thread, for the scope's lifetime
+ */
+class CancellationScope {
+  public:
+    explicit CancellationScope(const CancellationToken &token) : previous_(detail::current_token) {
+        detail::current_token = &token;
+    }
+    ~CancellationScope() { detail::current_token = previous_; }
+
+    CancellationScope(const CancellationScope &) = delete;
+    CancellationScope &operator=(const CancellationScope &) = delete;
+
+  private:
+    const CancellationToken *previous_;
+};
+
+/**
+ * @brief Whether the run on this thread has been cancelled
+ *
+ * A thread-local load and, with a token installed, a relaxed atomic load, so
+ * solvers can call it once per iteration of their work loops.
+ */
+inline bool cancellation_requested() {
+    const CancellationToken *token = detail::current_token;
+    return token && token->cancelled();
+}
+
+/**
+ * @brief Throw Cancelled if the run on this thread has been cancelled
+ */
+inline void throw_if_cancelled() {
+    if (cancellation_requested()) {
+        throw Cancelled();
+    }
+}
+
+/**
+ * @brief Background thread cancelling tokens when their deadlines pass
+ *
+ * The thread is started by the first watch() and stopped by the destructor.
+ */
+class DeadlineWatchdog {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    DeadlineWatchdog() = default;
+    DeadlineWatchdog(const DeadlineWatchdog &) = delete;
+    DeadlineWatchdog &operator=(const DeadlineWatchdog &) = delete;
+
+    ~DeadlineWatchdog() {
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_one();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    /**
+     * @brief Cancel @p token at @p deadline unless unwatch() is called first
+     */
+    void watch(CancellationToken &token, Clock::time_point deadline) {
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            deadlines_.emplace(deadline, &token);
+            if (!thread_.joinable()) {
+                thread_ = std::thread([this] { loop(); });
+            }
+        }
+        wake_.notify_one();
+    }
+
+    void unwatch(const CancellationToken &token) {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        for (auto it = deadlines_.begin(); it != deadlines_.end(); ++it) {
+            if (it->second == &token) {
+                deadlines_.erase(it);
+                return;
+            }
+        }
+    }
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::multimap<Clock::time_point, CancellationToken *> deadlines_;
+    std::thread thread_;
+    bool stop_ = false;
+
+    void loop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stop_) {
+            if (deadlines_.empty()) {
+                wake_.wait(lock);
+                continue;
+            }
+            const auto next = deadlines_.begin()->first;
+            if (Clock::now() < next) {
+                wake_.wait_until(lock, next);
+                continue;
+            }
+            while (!deadlines_.empty() && deadlines_.begin()->first <= Clock::now()) {
+                deadlines_.begin()->second->cancel();
+                deadlines_.erase(deadlines_.begin());
+            }
+        }
+    }
+};
+
+} // namespace solvers
+} // namespace ggg
@@ -0,0 +1,223 @@
+#pragma once
+
+#include "libggg/solvers/cancellation.hpp"
+#include "libggg/solvers/solver.hpp"
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ggg {
+namespace solvers {
+
+/**
+ * @brief Races several solvers on one graph and returns the first solution
+ *
+ * Every member solves the graph on a thread of its own; the graph is only
+ * read, so it is shared.  The first member to return wins and the others
+ * are cancelled through their CancellationToken, so they stop at their next
+ * throw_if_cancelled(); solve() returns once all of them have, since they
+ * still read the graph until then.  A member that throws drops out of the
+ * race, as does one whose solution the check set by check_with() rejects;
+ * only if every member fails is the first failure rethrown.
+ * Cancelling the portfolio's own run, through a token installed on the
+ * thread calling solve(), cancels all members.
+ *
+ * Members that fan work out with ggg::utils::parallel_for each start their
+ * own workers, so GGG_THREADS may be worth lowering for a portfolio.
+ *
+ * @tparam GraphType The graph type (e.g. parity::graph::Graph)
+ * @tparam SolutionType The solution type returned; every member's solution must convert to it
+ */
+template <typename GraphType, typename SolutionType>
+class PortfolioSolver : public Solver<GraphType, SolutionType> {
+  public:
+    /**
+     * @brief One solver run of a member, started on its racing thread
+     */
+    using Run = std::function<SolutionType(const GraphType &)>;
+
+    /**
+     * @brief Check of a member's solution, run on its racing thread; throws to reject it
+     */
+    using Check = std::function<void(const GraphType &, const SolutionType &)>;
+
+    /**
+     * @brief Add a member running a new SolverType(@p args...) in every race
+     *
+     * A new solver per race keeps runs apart for solvers with per-run state.
+     */
+    template <typename SolverType, typename... Args>
+    PortfolioSolver &add(Args... args) {
+        return add(SolverType(args...).get_name(), make_run<SolverType>(args...));
+    }
+
+    /**
+     * @brief Add a member called @p name that solves by calling @p run
+     */
+    PortfolioSolver &add(std::string name, Run run) {
+        members_.push_back({std::move(name), std::move(run)});
+        return *this;
+    }
+
+    /**
+     * @brief Accept a member's solution only once @p check returns for it
+     *
+     * A rejected member drops out as if it had thrown, so the race goes on
+     * until a member's solution passes or every member has failed.
+     */
+    PortfolioSolver &check_with(Check check) {
+        check_ = std::move(check);
+        return *this;
+    }
+
+    /**
+     * @brief A run constructing SolverType(@p args...) and solving with it, for add(name, run)
+     */
+    template <typename SolverType, typename... Args>
+    static Run make_run(Args... args) {
+        using MemberSolution = decltype(std::declval<SolverType &>().solve(std::declval<const GraphType &>()));
+        static_assert(std::constructible_from<SolutionType, MemberSolution>,
+                      "the member's solution must convert to the portfolio's");
+        return [args...](const GraphType &graph) {
+            SolverType solver(args...);
+            return SolutionType(solver.solve(graph));
+        };
+    }
+
+    /**
+     * @brief Race the members on @p graph
+     *
+     * @throws std::logic_error if the portfolio has no members
+     * @throws Cancelled if the run was cancelled before any member finished
+     */
+    SolutionType solve(const GraphType &graph) override {
+        if (members_.empty()) {
+            throw std::logic_error("portfolio solver without solvers");
+        }
+        winner_.clear();
+        Race race(members_.size());
+        std::vector<std::thread> threads;
+        threads.reserve(members_.size());
+        try {
+            for (std::size_t i = 0; i < members_.size(); ++i) {
+                threads.emplace_back([this, &graph, &race, i] { run_member(i, graph, race); });
+            }
+        } catch (...) {
+            finish(race, threads);
+            throw;
+        }
+
+        bool cancelled = false;
+        {
+            std::unique_lock<std::mutex> lock(race.mutex);
+            const auto decided = [&] { return race.winner < members_.size() || race.finished == members_.size(); };
+            // The members observe their own tokens only, so the caller's is polled here.
+            while (!race.changed.wait_for(lock, poll_interval, decided)) {
+                if (cancellation_requested()) {
+                    cancelled = true;
+                    break;
+                }
+            }
+        }
+        finish(race, threads);
+
+        if (race.solution) {
+            winner_ = members_[race.winner].name;
+            return std::move(*race.solution);
+        }
+        if (race.error && !cancelled) {
+            std::rethrow_exception(race.error);
+        }
+        throw Cancelled();
+    }
+
+    std::string get_name() const override {
+        std::string name = "Portfolio (";
+        for (std::size_t i = 0; i < members_.size(); ++i) {
+            name += (i > 0 ? ", " : "") + members_[i].name;
+        }
+        return name + ")";
+    }
+
+    std::size_t size() const { return members_.size(); }
+
+    /**
+     * @brief Name of the member whose solution the last solve() returned (empty if none)
+     */
+    const std::string &winner() const { return winner_; }
+
+  private:
+    struct Member {
+        std::string name;
+        Run run;
+    };
+
+    // State shared by the racing threads of one solve()
+    struct Race {
+        explicit Race(std::size_t members) : tokens(members), winner(members) {}
+
+        std::vector<CancellationToken> tokens;
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::size_t finished = 0;
+        std::size_t winner; // the number of members until one has returned
+        std::optional<SolutionType> solution;
+        std::exception_ptr error; // the first failure other than a cancellation
+    };
+
+    static constexpr std::chrono::milliseconds poll_interval{10};
+
+    std::vector<Member> members_;
+    Check check_;
+    std::string winner_;
+
+    void run_member(std::size_t i, const GraphType &graph, Race &race) const {
+        std::optional<SolutionType> solution;
+        std::exception_ptr error;
+        try {
+            const CancellationScope scope(race.tokens[i]);
+            SolutionType result = members_[i].run(graph);
+            if (check_) {
+                check_(graph, result);
+            }
+            solution.emplace(std::move(result));
+        } catch (const Cancelled &) {
+        } catch (...) {
+            error = std::current_exception();
+        }
+        {
+            const std::lock_guard<std::mutex> lock(race.mutex);
+            ++race.finished;
+            if (solution && !race.solution) {
+                race.solution = std::move(solution);
+                race.winner = i;
+            } else if (error && !race.error) {
+                race.error = error;
+            }
+        }
+        race.changed.notify_one();
+    }
+
+    // Cancel whatever still runs and wait for it to stop
+    static void finish(Race &race, std::vector<std::thread> &threads) {
+        for (auto &token : race.tokens) {
+            token.cancel();
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+};
+
+} // namespace solvers
+} // namespace ggg
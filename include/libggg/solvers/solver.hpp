@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 
+#include "libggg/solvers/cancellation.hpp"
 #include "libggg/solutions/concepts.hpp"
 #include "libggg/solutions/isolution.hpp"
 #include "libggg/solutions/qsolution.hpp"
@@ -33,6 +34,10 @@ namespace solvers {
 
 /**
  * @brief Generic solver interface for game graphs
+ *
+ * Solvers call throw_if_cancelled() (see cancellation.hpp) in their main
+ * loops, so a run can be stopped from another thread or at a deadline.
+ *
  * @tparam GraphType The graph type (e.g. mean_payoff::graph::Graph)
  * @tparam SolutionType The solution type returned by the solver
  */
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "libggg/stochastic_discounted/graph.hpp"
+#include "libggg/stochastic_discounted/numeric.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ggg {
+namespace stochastic_discounted {
+
+/**
+ * @brief Compiled transition structure of a stochastic discounted game
+ *
+ * Every edge leaving a player vertex is a choice.  Each choice is stored as
+ * one sparse row in compressed sparse row (CSR) form.  The row holds the
+ * player vertices reached through the probabilistic vertices behind the
+ * edge, each with coefficient probability × discount, plus the edge weight
+ * as the choice's reward.  The value of a choice under a valuation x is then
+ * `reward[c] + Σ coefficients[k] · x[columns[k]]`.
+ *
+ * The choices of vertex @c v are `[choice_offsets[v], choice_offsets[v + 1])`,
+ * in `boost::out_edges` order; probabilistic vertices have none.  Columns of a
+ * row are distinct and increasing.
+ *
+ * Solvers build this once per game instead of repeating the probabilistic
+ * closure (graph::get_reachable_through_probabilistic) in their inner loops.
+ *
+ * @tparam T Value type of rewards and coefficients (see NumericPolicy); row
+ *         values are summed in its accumulator type
+ */
+template <typename T>
+struct BasicChoiceMatrix {
+    std::vector<int> player;                 ///< Owner of every vertex, -1 if probabilistic
+    std::vector<std::size_t> choice_offsets; ///< Size num_vertices + 1
+    std::vector<std::size_t> successor;      ///< Edge target of each choice
+    std::vector<T> reward;                   ///< Edge weight of each choice
+    std::vector<std::size_t> row_offsets;    ///< Size num_choices + 1
+    std::vector<std::size_t> columns;        ///< Player vertices reached
+    std::vector<T> coefficients;             ///< Probability × discount
+
+    std::size_t num_vertices() const { return choice_offsets.empty() ? 0 : choice_offsets.size() - 1; }
+    std::size_t num_choices() const { return successor.size(); }
+    std::size_t first_choice(std::size_t v) const { return choice_offsets[v]; }
+    std::size_t end_choice(std::size_t v) const { return choice_offsets[v + 1]; }
+
+    /**
+     * @brief Player vertices reached by choice @p c
+     */
+    std::span<const std::size_t> row_columns(std::size_t c) const {
+        return {columns.data() + row_offsets[c], columns.data() + row_offsets[c + 1]};
+    }
+
+    /**
+     * @brief Coefficients of choice @p c, aligned with row_columns()
+     */
+    std::span<const T> row_coefficients(std::size_t c) const {
+        return {coefficients.data() + row_offsets[c], coefficients.data() + row_offsets[c + 1]};
+    }
+
+    /**
+     * @brief Value of choice @p c under the valuation @p values (indexed by vertex)
+     */
+    T value(std::size_t c, const std::vector<T> &values) const {
+        using Accumulator = typename NumericPolicy<T>::accumulator_type;
+        Accumulator result = reward[c];
+        for (std::size_t k = row_offsets[c]; k < row_offsets[c + 1]; ++k) {
+            result += Accumulator(coefficients[k]) * Accumulator(values[columns[k]]);
+        }
+        return T(result);
+    }
+};
+
+using ChoiceMatrix = BasicChoiceMatrix<double>;
+
+/**
+ * @brief Compile a stochastic discounted game into a ChoiceMatrix
+ *
+ * The probabilistic closure behind each edge is expanded exactly as in
+ * graph::get_reachable_through_probabilistic, with dense scratch arrays
+ * instead of per-call sets and maps.  Probabilities, discounts and weights
+ * are converted to @p T before the closure is multiplied out, so a Rational
+ * matrix holds the exact products of the game's (binary) numbers.
+ *
+ * @tparam T Value type of the matrix
+ * @param graph Stochastic discounted game
+ * @return Choice rows of every player vertex
+ */
+template <typename T = double>
+BasicChoiceMatrix<T> make_choice_matrix(const graph::Graph &graph) {
+    const std::size_t n = boost::num_vertices(graph);
+    BasicChoiceMatrix<T> matrix;
+    matrix.player.resize(n);
+    matrix.choice_offsets.assign(n + 1, 0);
+    matrix.row_offsets.push_back(0);
+
+    // Scratch arrays are reset lazily by comparing against the current stamp.
+    std::vector<T> mass(n, T(0));
+    std::vector<std::size_t> listed(n, 0);
+    std::vector<std::size_t> visited(n, 0);
+    std::vector<std::size_t> reached;
+    std::vector<std::pair<std::size_t, T>> queue;
+    std::size_t stamp = 0;
+    const auto reach = [&](std::size_t target, const T &probability) {
+        if (listed[target] != stamp) {
+            listed[target] = stamp;
+            mass[target] = T(0);
+            reached.push_back(target);
+        }
+        mass[target] += probability;
+    };
+
+    for (std::size_t v = 0; v < n; ++v) {
+        matrix.player[v] = graph[v].player;
+        if (graph[v].player != -1) {
+            const auto [out_begin, out_end] = boost::out_edges(v, graph);
+            for (auto it = out_begin; it != out_end; ++it) {
+                const std::size_t successor = boost::target(*it, graph);
+                const T discount(graph[*it].discount);
+                ++stamp;
+                reached.clear();
+
+                if (graph[successor].player == -1) {
+                    queue.assign(1, {successor, T(1)});
+                } else {
+                    queue.clear();
+                    reach(successor, T(1));
+                }
+                for (std::size_t head = 0; head < queue.size(); ++head) {
+                    const auto [current, probability] = queue[head];
+                    if (visited[current] == stamp) {
+                        continue;
+                    }
+                    visited[current] = stamp;
+                    const auto [prob_begin, prob_end] = boost::out_edges(current, graph);
+                    for (auto pit = prob_begin; pit != prob_end; ++pit) {
+                        const std::size_t target = boost::target(*pit, graph);
+                        const T total = probability * T(graph[*pit].probability);
+                        if (graph[target].player == -1) {
+                            if (visited[target] != stamp) {
+                                queue.emplace_back(target, total);
+                            }
+                        } else {
+                            reach(target, total);
+                        }
+                    }
+                }
+
+                std::sort(reached.begin(), reached.end());
+                for (const std::size_t target : reached) {
+                    matrix.columns.push_back(target);
+                    matrix.coefficients.push_back(mass[target] * discount);
+                }
+                matrix.successor.push_back(successor);
+                matrix.reward.push_back(T(graph[*it].weight));
+                matrix.row_offsets.push_back(matrix.columns.size());
+            }
+        }
+        matrix.choice_offsets[v + 1] = matrix.successor.size();
+    }
+    return matrix;
+}
+
+} // namespace stochastic_discounted
+} // namespace ggg
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "libggg/solvers/cancellation.hpp"
+#include "libggg/stochastic_discounted/choice_matrix.hpp"
+#include "libggg/stochastic_discounted/value_iteration.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace ggg {
+namespace stochastic_discounted {
+
+/**
+ * @brief State of an IntervalValueIteration run after a sweep
+ */
+template <typename T>
+struct BasicIntervalProgress {
+    std::size_t sweeps;           ///< Sweeps done so far
+    T width;                      ///< Largest upper - lower gap of any player vertex
+    const std::vector<T> &lower;  ///< Lower bound of every vertex
+    const std::vector<T> &upper;  ///< Upper bound of every vertex
+};
+
+/**
+ * @brief Called after every sweep; returning false stops the run early
+ */
+template <typename T>
+using BasicIntervalCallback = std::function<bool(const BasicIntervalProgress<T> &)>;
+
+using IntervalProgress = BasicIntervalProgress<double>;
+using IntervalCallback = BasicIntervalCallback<double>;
+
+/**
+ * @brief Sound value iteration with a lower and an upper bound per vertex
+ *
+ * With rewards in [r_min, r_max] and contraction factor γ, every value lies in
+ * [min(0, r_min) / (1 - γ), max(0, r_max) / (1 - γ)].  Starting one valuation
+ * at each end, the Bellman operator moves the lower one up and the upper one
+ * down while keeping the game's values between them, since it is monotone
+ * and both ends are a sub- and a super-solution.  The gap is therefore a
+ * certificate at every sweep, not only at convergence, and a run cut short
+ * by the callback still reports valid intervals.
+ *
+ * @tparam T Value type (see NumericPolicy)
+ */
+template <typename T>
+class BasicIntervalValueIteration {
+  public:
+    /**
+     * @param matrix Compiled game; must outlive this object
+     */
+    explicit BasicIntervalValueIteration(const BasicChoiceMatrix<T> &matrix)
+        : matrix_(matrix), gamma_(contraction_factor(matrix)), choice_(matrix.num_vertices(), 0) {
+        for (std::size_t v = 0; v < matrix.num_vertices(); ++v) {
+            if (matrix.player[v] != -1) {
+                vertices_.push_back(v);
+                choice_[v] = matrix.first_choice(v);
+            }
+        }
+    }
+
+    /**
+     * @brief Tighten the bounds until every gap is at most 2 · @p precision
+     *
+     * @param values Receives the midpoint of every player vertex's interval,
+     *        which is within half the gap of the game's value; entries of
+     *        probabilistic vertices are left untouched
+     * @param precision Required bound on the distance to the game's values
+     * @param progress Optional callback after every sweep
+     * @return Number of sweeps
+     * @throws std::invalid_argument if @p precision is not positive or the
+     *         game is not discounted (γ >= 1)
+     */
+    std::size_t run(std::vector<T> &values, const T &precision, const BasicIntervalCallback<T> &progress = {}) {
+        if (!(precision > 0)) {
+            throw std::invalid_argument("value iteration precision must be positive");
+        }
+        if (gamma_ >= 1) {
+            throw std::invalid_argument("value iteration requires all discounts below 1");
+        }
+        initialise();
+        std::size_t sweeps = 0;
+        converged_ = width_ <= 2 * precision;
+        while (!converged_) {
+            ggg::solvers::throw_if_cancelled();
+            width_ = sweep();
+            ++sweeps;
+            converged_ = width_ <= 2 * precision;
+            if (progress && !progress(BasicIntervalProgress<T>{sweeps, width_, lower_, upper_})) {
+                break;
+            }
+        }
+        for (const std::size_t v : vertices_) {
+            values[v] = (lower_[v] + upper_[v]) / 2;
+        }
+        for (const std::size_t v : vertices_) {
+            bellman_backup(matrix_, v, values, choice_[v]);
+        }
+        return sweeps;
+    }
+
+    const std::vector<T> &lower() const { return lower_; }
+    const std::vector<T> &upper() const { return upper_; }
+
+    /**
+     * @brief Best choice of every player vertex for the reported values
+     */
+    const std::vector<std::size_t> &choices() const { return choice_; }
+
+    /**
+     * @brief Guaranteed distance of the reported values to the game's values
+     */
+    T error_bound() const { return width_ / 2; }
+
+    /**
+     * @brief Whether the last run reached its precision (false if it was stopped)
+     */
+    bool converged() const { return converged_; }
+
+    T gamma() const { return gamma_; }
+
+  private:
+    const BasicChoiceMatrix<T> &matrix_;
+    T gamma_;
+    T width_ = std::numeric_limits<T>::infinity();
+    bool converged_ = false;
+    std::vector<std::size_t> vertices_;
+    std::vector<std::size_t> choice_;
+    std::vector<T> lower_;
+    std::vector<T> upper_;
+
+    void initialise() {
+        T low(0);
+        T high(0);
+        for (std::size_t c = 0; c < matrix_.num_choices(); ++c) {
+            low = std::min(low, matrix_.reward[c]);
+            high = std::max(high, matrix_.reward[c]);
+        }
+        lower_.assign(matrix_.num_vertices(), T(0));
+        upper_.assign(matrix_.num_vertices(), T(0));
+        for (const std::size_t v : vertices_) {
+            lower_[v] = low / (1 - gamma_);
+            upper_[v] = high / (1 - gamma_);
+        }
+        width_ = vertices_.empty() ? T(0) : T((high - low) / (1 - gamma_));
+    }
+
+    // Gauss-Seidel sweep of both bounds; returns the largest gap.
+    T sweep() {
+        T width(0);
+        std::size_t choice;
+        for (const std::size_t v : vertices_) {
+            lower_[v] = bellman_backup(matrix_, v, lower_, choice);
+            upper_[v] = bellman_backup(matrix_, v, upper_, choice);
+            width = std::max<T>(width, upper_[v] - lower_[v]);
+        }
+        return width;
+    }
+};
+
+using IntervalValueIteration = BasicIntervalValueIteration<double>;
+
+} // namespace stochastic_discounted
+} // namespace ggg
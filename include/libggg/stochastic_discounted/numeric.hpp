@@ -0,0 +1,93 @@
+#pragma once
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <limits>
+
+namespace ggg {
+namespace stochastic_discounted {
+
+/**
+ * @brief Exact rational number with unbounded numerator and denominator
+ */
+using Rational = boost::multiprecision::cpp_rational;
+
+/**
+ * @brief Arithmetic and tolerances of the stochastic discounted solvers for one value type
+ *
+ * Specialised for float, double, long double and Rational; the solvers and
+ * their engines take the value type as a template argument and read every
+ * tolerance from here instead of hard-coding it for double.
+ *
+ * - accumulator_type: type in which row values and dot products are summed
+ * - exact: whether arithmetic is exact; exact types compare values without
+ *   tolerance and solve cyclic linear systems by elimination
+ * - unit_roundoff(): relative error of one backup, 0 for exact types
+ * - improvement_tolerance(): gain a player 0 switch must exceed
+ * - response_tolerance(): gain a player 1 best-response switch must exceed
+ * - evaluation_tolerance(): accuracy of iterative strategy evaluation
+ * - convergence_tolerance(): largest change in a sweep at which worklist
+ *   value iteration stops
+ * - objective_tolerance(): objective and tie threshold of objective
+ *   improvement
+ */
+template <typename T>
+struct NumericPolicy;
+
+template <>
+struct NumericPolicy<float> {
+    using value_type = float;
+    using accumulator_type = double;
+    static constexpr bool exact = false;
+    static constexpr const char *name = "float";
+    static float unit_roundoff() { return 16 * std::numeric_limits<float>::epsilon(); }
+    static float improvement_tolerance() { return 1e-2f; }
+    static float response_tolerance() { return 5e-3f; }
+    static float evaluation_tolerance() { return 1e-3f; }
+    static float convergence_tolerance() { return 1e-3f; }
+    static float objective_tolerance() { return 1e-2f; }
+};
+
+template <>
+struct NumericPolicy<double> {
+    using value_type = double;
+    using accumulator_type = double;
+    static constexpr bool exact = false;
+    static constexpr const char *name = "double";
+    static double unit_roundoff() { return 16 * std::numeric_limits<double>::epsilon(); }
+    static double improvement_tolerance() { return 1e-6; }
+    static double response_tolerance() { return 1e-9; }
+    static double evaluation_tolerance() { return 1e-11; }
+    static double convergence_tolerance() { return 1e-10; }
+    static double objective_tolerance() { return 1e-8; }
+};
+
+template <>
+struct NumericPolicy<long double> {
+    using value_type = long double;
+    using accumulator_type = long double;
+    static constexpr bool exact = false;
+    static constexpr const char *name = "long double";
+    static long double unit_roundoff() { return 16 * std::numeric_limits<long double>::epsilon(); }
+    static long double improvement_tolerance() { return 1e-9L; }
+    static long double response_tolerance() { return 1e-12L; }
+    static long double evaluation_tolerance() { return 1e-14L; }
+    static long double convergence_tolerance() { return 1e-13L; }
+    static long double objective_tolerance() { return 1e-11L; }
+};
+
+template <>
+struct NumericPolicy<Rational> {
+    using value_type = Rational;
+    using accumulator_type = Rational;
+    static constexpr bool exact = true;
+    static constexpr const char *name = "rational";
+    static Rational unit_roundoff() { return 0; }
+    static Rational improvement_tolerance() { return 0; }
+    static Rational response_tolerance() { return 0; }
+    static Rational evaluation_tolerance() { return 0; }
+    static Rational convergence_tolerance() { return 0; }
+    static Rational objective_tolerance() { return 0; }
+};
+
+} // namespace stochastic_discounted
+} // namespace ggg
@@ -0,0 +1,378 @@
+#pragma once
+
+#include "libggg/stochastic_discounted/choice_matrix.hpp"
+#include "libggg/stochastic_discounted/numeric.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace ggg {
+namespace stochastic_discounted {
+
+/**
+ * @brief Method used by PolicyEvaluation for one linear system
+ *
+ * - Direct: back substitution in reverse topological order; only used when
+ *   the chosen rows form an acyclic system (self loops allowed).
+ * - GaussSeidel: in-place sweeps until the contraction bound certifies the
+ *   tolerance.
+ * - BiCGSTAB: Jacobi-preconditioned BiCGSTAB; falls back to Gauss-Seidel if
+ *   it breaks down or stalls.
+ * - Elimination: dense Gaussian elimination; used instead of the iterative
+ *   methods for exact value types, whose values it computes exactly.
+ */
+enum class LinearSolver { Direct, GaussSeidel, BiCGSTAB, Elimination };
+
+/**
+ * @brief Values of a fixed strategy profile of a stochastic discounted game
+ *
+ * Fixing one choice per player vertex turns the game into the linear system
+ * (I - γP)x = r over the player vertices, where row v is the ChoiceMatrix row
+ * of v's choice.  Every row's coefficients sum to at most the discount γ < 1,
+ * so ‖(I - γP)^-1‖∞ <= 1 / (1 - γ): a residual below tolerance · (1 - γ)
+ * certifies the requested accuracy, and Gauss-Seidel is a γ-contraction.
+ *
+ * @tparam T Value type (see NumericPolicy); cyclic systems of exact types
+ *         are always solved by elimination
+ */
+template <typename T>
+class BasicPolicyEvaluation {
+  public:
+    /**
+     * @param matrix Compiled game; must outlive this object
+     * @param solver Method for cyclic systems (Direct is treated as BiCGSTAB)
+     */
+    explicit BasicPolicyEvaluation(const BasicChoiceMatrix<T> &matrix, LinearSolver solver = LinearSolver::BiCGSTAB)
+        : matrix_(matrix), solver_(solver == LinearSolver::Direct ? LinearSolver::BiCGSTAB : solver), index_(matrix.num_vertices(), kNone) {
+        for (std::size_t v = 0; v < matrix.num_vertices(); ++v) {
+            if (matrix.player[v] != -1) {
+                index_[v] = vertices_.size();
+                vertices_.push_back(v);
+            }
+        }
+    }
+
+    /**
+     * @brief Solve for the values of @p profile
+     *
+     * @param profile Choice of every player vertex (indexed by vertex)
+     * @param values Valuation indexed by vertex; its player entries are the
+     *        starting point of iterative methods and receive the solution
+     * @param tolerance Required bound on the distance to the exact values
+     *        (ignored by Direct and Elimination)
+     * @return Method that produced the values
+     */
+    LinearSolver evaluate(const std::vector<std::size_t> &profile, std::vector<T> &values,
+                          const T &tolerance = NumericPolicy<T>::evaluation_tolerance()) {
+        build(profile);
+        iterations_ = 0;
+        std::vector<std::size_t> order;
+        if (topological_order(order)) {
+            solve_direct(order);
+            last_ = LinearSolver::Direct;
+        } else if constexpr (NumericPolicy<T>::exact) {
+            solve_elimination();
+            last_ = LinearSolver::Elimination;
+        } else if (solver_ == LinearSolver::Elimination) {
+            solve_elimination();
+            last_ = LinearSolver::Elimination;
+        } else if (solver_ == LinearSolver::BiCGSTAB && solve_bicgstab(values, tolerance)) {
+            last_ = LinearSolver::BiCGSTAB;
+        } else {
+            solve_gauss_seidel(values, tolerance);
+            last_ = LinearSolver::GaussSeidel;
+        }
+        for (std::size_t i = 0; i < vertices_.size(); ++i) {
+            values[vertices_[i]] = x_[i];
+        }
+        return last_;
+    }
+
+    /**
+     * @brief Sweeps (Gauss-Seidel) or iterations (BiCGSTAB) of the last evaluate()
+     */
+    std::size_t iterations() const { return iterations_; }
+
+    LinearSolver last_solver() const { return last_; }
+
+  private:
+    using Accumulator = typename NumericPolicy<T>::accumulator_type;
+
+    static constexpr std::size_t kNone = std::numeric_limits<std::size_t>::max();
+    static constexpr std::size_t kMaxKrylovIterations = 1000;
+    static constexpr std::size_t kMaxSweeps = 1000000;
+
+    const BasicChoiceMatrix<T> &matrix_;
+    LinearSolver solver_;
+    LinearSolver last_ = LinearSolver::Direct;
+    std::size_t iterations_ = 0;
+    std::vector<std::size_t> index_;    ///< Compressed index of every player vertex
+    std::vector<std::size_t> vertices_; ///< Player vertex of every compressed index
+
+    // Off-diagonal part of the system in compressed indices: x_i = (b_i + Σ c x_j) / d_i
+    std::vector<std::size_t> start_;
+    std::vector<std::size_t> column_;
+    std::vector<T> coefficient_;
+    std::vector<T> diagonal_;
+    std::vector<T> rhs_;
+    T gamma_ = 0;
+    std::vector<T> x_;
+
+    void build(const std::vector<std::size_t> &profile) {
+        const std::size_t n = vertices_.size();
+        start_.assign(1, 0);
+        column_.clear();
+        coefficient_.clear();
+        diagonal_.assign(n, T(1));
+        rhs_.resize(n);
+        gamma_ = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::size_t v = vertices_[i];
+            const std::size_t c = profile[v];
+            const auto columns = matrix_.row_columns(c);
+            const auto coefficients = matrix_.row_coefficients(c);
+            T sum(0);
+            for (std::size_t k = 0; k < columns.size(); ++k) {
+                sum += coefficients[k];
+                if (columns[k] == v) {
+                    diagonal_[i] -= coefficients[k];
+                } else {
+                    column_.push_back(index_[columns[k]]);
+                    coefficient_.push_back(coefficients[k]);
+                }
+            }
+            gamma_ = std::max(gamma_, sum);
+            rhs_[i] = matrix_.reward[c];
+            start_.push_back(column_.size());
+        }
+    }
+
+    // Order in which every vertex comes after the vertices its row reads;
+    // false if the rows contain a cycle other than self loops.
+    bool topological_order(std::vector<std::size_t> &order) const {
+        const std::size_t n = vertices_.size();
+        std::vector<std::size_t> pending(n);
+        std::vector<std::size_t> reader_start(n + 1, 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            pending[i] = start_[i + 1] - start_[i];
+            for (std::size_t k = start_[i]; k < start_[i + 1]; ++k) {
+                ++reader_start[column_[k] + 1];
+            }
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            reader_start[i + 1] += reader_start[i];
+        }
+        std::vector<std::size_t> readers(column_.size());
+        std::vector<std::size_t> next(reader_start.begin(), reader_start.end() - 1);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t k = start_[i]; k < start_[i + 1]; ++k) {
+                readers[next[column_[k]]++] = i;
+            }
+        }
+        order.clear();
+        for (std::size_t i = 0; i < n; ++i) {
+            if (pending[i] == 0) {
+                order.push_back(i);
+            }
+        }
+        for (std::size_t head = 0; head < order.size(); ++head) {
+            const std::size_t j = order[head];
+            for (std::size_t k = reader_start[j]; k < reader_start[j + 1]; ++k) {
+                if (--pending[readers[k]] == 0) {
+                    order.push_back(readers[k]);
+                }
+            }
+        }
+        return order.size() == n;
+    }
+
+    T row_value(std::size_t i, const std::vector<T> &x) const {
+        Accumulator s = rhs_[i];
+        for (std::size_t k = start_[i]; k < start_[i + 1]; ++k) {
+            s += Accumulator(coefficient_[k]) * Accumulator(x[column_[k]]);
+        }
+        return T(s / Accumulator(diagonal_[i]));
+    }
+
+    // y = (I - C) x with the diagonal folded in: y_i = d_i x_i - Σ c x_j
+    void multiply(const std::vector<T> &x, std::vector<T> &y) const {
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            Accumulator s = Accumulator(diagonal_[i]) * Accumulator(x[i]);
+            for (std::size_t k = start_[i]; k < start_[i + 1]; ++k) {
+                s -= Accumulator(coefficient_[k]) * Accumulator(x[column_[k]]);
+            }
+            y[i] = T(s);
+        }
+    }
+
+    void solve_direct(const std::vector<std::size_t> &order) {
+        x_.assign(vertices_.size(), T(0));
+        for (const std::size_t i : order) {
+            x_[i] = row_value(i, x_);
+        }
+    }
+
+    // Dense Gaussian elimination.  (I - C) is strictly diagonally dominant
+    // (every row's coefficients sum to less than 1), so every pivot is
+    // nonzero without row exchanges.
+    void solve_elimination() {
+        const std::size_t n = vertices_.size();
+        std::vector<std::vector<T>> a(n, std::vector<T>(n, T(0)));
+        x_ = rhs_;
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i][i] = diagonal_[i];
+            for (std::size_t k = start_[i]; k < start_[i + 1]; ++k) {
+                a[i][column_[k]] = -coefficient_[k];
+            }
+        }
+        for (std::size_t p = 0; p < n; ++p) {
+            for (std::size_t i = p + 1; i < n; ++i) {
+                if (a[i][p] == 0) {
+                    continue;
+                }
+                const T factor = a[i][p] / a[p][p];
+                for (std::size_t j = p + 1; j < n; ++j) {
+                    if (a[p][j] != 0) {
+                        a[i][j] -= factor * a[p][j];
+                    }
+                }
+                x_[i] -= factor * x_[p];
+            }
+        }
+        for (std::size_t i = n; i-- > 0;) {
+            for (std::size_t j = i + 1; j < n; ++j) {
+                if (a[i][j] != 0) {
+                    x_[i] -= a[i][j] * x_[j];
+                }
+            }
+            x_[i] /= a[i][i];
+        }
+    }
+
+    void load_start(const std::vector<T> &values) {
+        x_.resize(vertices_.size());
+        for (std::size_t i = 0; i < vertices_.size(); ++i) {
+            x_[i] = values[vertices_[i]];
+        }
+    }
+
+    void solve_gauss_seidel(const std::vector<T> &values, const T &tolerance) {
+        using std::abs;
+        if (last_ != LinearSolver::BiCGSTAB || x_.size() != vertices_.size()) {
+            load_start(values);
+        }
+        const T scale = gamma_ / (1 - gamma_);
+        for (std::size_t sweep = 0; sweep < kMaxSweeps; ++sweep) {
+            T change(0);
+            for (std::size_t i = 0; i < x_.size(); ++i) {
+                const T value = row_value(i, x_);
+                change = std::max<T>(change, abs(value - x_[i]));
+                x_[i] = value;
+            }
+            ++iterations_;
+            if (scale * change <= tolerance) {
+                break;
+            }
+        }
+    }
+
+    static T dot(const std::vector<T> &a, const std::vector<T> &b) {
+        Accumulator s(0);
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            s += Accumulator(a[i]) * Accumulator(b[i]);
+        }
+        return T(s);
+    }
+
+    static T norm(const std::vector<T> &a) {
+        using std::abs;
+        T s(0);
+        for (const T &v : a) {
+            s = std::max<T>(s, abs(v));
+        }
+        return s;
+    }
+
+    // Returns false (leaving its best iterate in x_) on breakdown or stall.
+    bool solve_bicgstab(const std::vector<T> &values, const T &tolerance) {
+        const std::size_t n = vertices_.size();
+        load_start(values);
+        const T target = tolerance * (1 - gamma_);
+        std::vector<T> r(n), r_hat(n), p(n, T(0)), v(n, T(0)), p_hat(n), s(n), s_hat(n), t(n);
+        multiply(x_, r);
+        for (std::size_t i = 0; i < n; ++i) {
+            r[i] = rhs_[i] - r[i];
+        }
+        if (norm(r) <= target) {
+            return true;
+        }
+        r_hat = r;
+        T rho(1);
+        T alpha(1);
+        T omega(1);
+        for (std::size_t iteration = 0; iteration < kMaxKrylovIterations; ++iteration) {
+            ++iterations_;
+            const T rho_next = dot(r_hat, r);
+            if (rho_next == 0 || omega == 0) {
+                return false;
+            }
+            const T beta = (rho_next / rho) * (alpha / omega);
+            rho = rho_next;
+            for (std::size_t i = 0; i < n; ++i) {
+                p[i] = r[i] + beta * (p[i] - omega * v[i]);
+                p_hat[i] = p[i] / diagonal_[i];
+            }
+            multiply(p_hat, v);
+            const T denominator = dot(r_hat, v);
+            if (denominator == 0) {
+                return false;
+            }
+            alpha = rho / denominator;
+            for (std::size_t i = 0; i < n; ++i) {
+                s[i] = r[i] - alpha * v[i];
+            }
+            if (norm(s) <= target) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    x_[i] += alpha * p_hat[i];
+                }
+                return verify(target);
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                s_hat[i] = s[i] / diagonal_[i];
+            }
+            multiply(s_hat, t);
+            const T tt = dot(t, t);
+            if (tt == 0) {
+                return false;
+            }
+            omega = dot(t, s) / tt;
+            for (std::size_t i = 0; i < n; ++i) {
+                x_[i] += alpha * p_hat[i] + omega * s_hat[i];
+                r[i] = s[i] - omega * t[i];
+            }
+            if (norm(r) <= target) {
+                return verify(target);
+            }
+        }
+        return false;
+    }
+
+    // The recurrence residual drifts from the true one; confirm on the latter.
+    bool verify(const T &target) const {
+        using std::abs;
+        std::vector<T> y(x_.size());
+        multiply(x_, y);
+        T residual(0);
+        for (std::size_t i = 0; i < y.size(); ++i) {
+            residual = std::max<T>(residual, abs(rhs_[i] - y[i]));
+        }
+        return residual <= target;
+    }
+};
+
+using PolicyEvaluation = BasicPolicyEvaluation<double>;
+
+} // namespace stochastic_discounted
+} // namespace ggg
@@ -1,9 +1,12 @@
 #pragma once
 
 #include "libggg/solvers/solver.hpp"
+#include "libggg/stochastic_discounted/choice_matrix.hpp"
 #include "libggg/stochastic_discounted/graph.hpp"
-#include "libggg/utils/simplex.hpp"
-#include <map>
+#include "libggg/stochastic_discounted/numeric.hpp"
+#include "libggg/utils/revised_simplex.hpp"
+#include <cstdint>
+#include <vector>
 
 namespace ggg {
 namespace stochastic_discounted {
@@ -16,38 +19,48 @@ using ObjectiveSolutionType = ggg::solutions::RSQSolution<graph::Graph>;
  * Implementation of the novel objective improvement approach described in
  * @cite DBLP:journals/corr/DellErbaDS24. This algorithm builds constraint systems using
  * every edge to define inequations and updates the objective function by
- * considering strategy edges for both players.
+ * considering strategy edges for both players.  Constraint rows, objective
+ * coefficients and switch values are read from the game's ChoiceMatrix.
+ * The constraint system never changes, so every LP after the first is
+ * warm-started from the previous optimal basis.
+ *
+ * When no switch improves the objective, a random non-empty subset of the
+ * vertices with tied alternatives switches to one of them.  The choices are
+ * drawn from a generator seeded with the constructor's seed at the start of
+ * every solve, so equal seeds give identical runs.
  */
 class StochasticDiscountedObjectiveSolver : public ggg::solvers::Solver<graph::Graph, ObjectiveSolutionType> {
   public:
+    /**
+     * @param seed Seed of the generator that breaks stalls
+     */
+    explicit StochasticDiscountedObjectiveSolver(std::uint64_t seed = 0) : seed_(seed) {}
+
     auto solve(const graph::Graph &graph) -> ObjectiveSolutionType override;
     std::string get_name() const override { return "Objective improvement Stochastic Discounted Game Solver"; }
 
   private:
     bool switch_str(const graph::Graph &graph);
-    int setup_matrix_rows(const graph::Graph &graph,
-                          std::vector<std::vector<double>> &matrix_coeff,
-                          std::vector<double> &obj_coeff_up,
-                          std::vector<double> &obj_coeff_low,
-                          std::vector<double> &var_up,
-                          std::vector<double> &var_low);
+    void setup_matrix_rows(const graph::Graph &graph, utils::RevisedSimplex &lp);
 
     void calculate_obj_coefficients(const graph::Graph &graph,
                                     std::vector<double> &obj_coeff);
 
-    void solve_simplex(Simplex &solver,
+    void solve_simplex(utils::RevisedSimplex &lp,
                        std::vector<double> &sol,
                        double &obj);
 
+    std::uint64_t seed_;
     uint switches;
     uint iterations;
     uint lpiter;
     uint stales;
     int num_real_vertices;
-    std::map<graph::Vertex, size_t> matrixMap;
-    std::map<int, graph::Vertex> reverseMap;
-    std::map<graph::Vertex, int> strategy;
-    std::map<graph::Vertex, double> sol;
+    ChoiceMatrix choices;
+    std::vector<std::size_t> matrixMap;
+    std::vector<graph::Vertex> reverseMap;
+    std::vector<std::size_t> strategy; ///< Current choice of every player vertex
+    std::vector<double> sol;
     std::vector<double> obj_coeff;
     double cff;
 };
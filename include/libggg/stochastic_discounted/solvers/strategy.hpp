@@ -1,61 +1,113 @@
 #pragma once
 
 #include "libggg/solvers/solver.hpp"
+#include "libggg/stochastic_discounted/choice_matrix.hpp"
 #include "libggg/stochastic_discounted/graph.hpp"
-#include <map>
+#include "libggg/stochastic_discounted/numeric.hpp"
+#include "libggg/stochastic_discounted/policy_evaluation.hpp"
+#include "libggg/utils/revised_simplex.hpp"
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 namespace ggg {
 namespace stochastic_discounted {
 
-using StrategySolutionType = ggg::solutions::RSQSolution<graph::Graph>;
+template <typename T>
+using BasicStrategySolutionType = ggg::solutions::RSQSolution<graph::Graph, ggg::strategy::DeterministicStrategy<graph::Graph>, T>;
+using StrategySolutionType = BasicStrategySolutionType<double>;
+
+/**
+ * @brief How StochasticDiscountedStrategySolver evaluates a player 0 strategy
+ *
+ * LinearProgram solves one LP whose player 1 rows bound the value by every
+ * choice, so the LP optimum is player 1's best response.  GaussSeidel and
+ * BiCGSTAB instead find the best response by policy iteration for player 1,
+ * evaluating each strategy profile with PolicyEvaluation using that linear
+ * solver (acyclic profiles are always solved directly).
+ */
+enum class StrategyEvaluation { LinearProgram, GaussSeidel, BiCGSTAB };
 
 /**
  * @brief Strategy Improvement solver for stochastic discounted games
  *
  * Implementation of the strategy iteration algorithm for solving stochastic
  * discounted games based on @cite DBLP:journals/or/Howard60 and @cite DBLP:journals/corr/DellErbaDS24.
- * Uses linear programming to solve the value equations at each iteration.
+ * Each player 0 strategy is evaluated against player 1's best response,
+ * either with a sparse linear solve per player 1 improvement step or with a
+ * linear program; rows and switch values are read from the game's
+ * ChoiceMatrix.  In the LP variant only the rows of switched vertices change
+ * between iterations, so each LP is warm-started from the previous optimal
+ * basis.
+ *
+ * The values are computed in @p T and switches compare them with the
+ * tolerances of NumericPolicy<T>.  The solver is instantiated for float,
+ * double, long double and Rational; with Rational, cyclic strategy profiles
+ * are solved by exact elimination and switches need a strict gain, so the
+ * values and strategies are the exact solution of the game as stored in
+ * doubles.  The LinearProgram evaluation is only available for double.
  */
-class StochasticDiscountedStrategySolver : public ggg::solvers::Solver<graph::Graph, StrategySolutionType> {
+template <typename T>
+class BasicStochasticDiscountedStrategySolver : public ggg::solvers::Solver<graph::Graph, BasicStrategySolutionType<T>> {
   public:
-    auto solve(const graph::Graph &graph) -> StrategySolutionType override;
-    [[nodiscard]] auto get_name() const -> std::string override { return "Strategy Improvement Stochastic Discounted Game Solver"; }
+    using SolutionType = BasicStrategySolutionType<T>;
+
+    /**
+     * @param evaluation Evaluation of the current player 0 strategy
+     * @throws std::invalid_argument for LinearProgram with a value type other than double
+     */
+    explicit BasicStochasticDiscountedStrategySolver(StrategyEvaluation evaluation = StrategyEvaluation::BiCGSTAB)
+        : evaluation_(evaluation) {
+        if (!std::is_same_v<T, double> && evaluation == StrategyEvaluation::LinearProgram) {
+            throw std::invalid_argument("LP strategy evaluation requires double values");
+        }
+    }
+
+    auto solve(const graph::Graph &graph) -> SolutionType override;
+    [[nodiscard]] auto get_name() const -> std::string override {
+        std::string name = "Strategy Improvement Stochastic Discounted Game Solver";
+        if constexpr (!std::is_same_v<T, double>) {
+            name += std::string(" (") + NumericPolicy<T>::name + ")";
+        }
+        return name;
+    }
 
   private:
     void switch_str(const graph::Graph &graph);
-    int setup_matrix_rows(const graph::Graph &graph,
-                          std::vector<std::vector<double>> &matrix_coeff,
-                          std::vector<double> &obj_coeff_up,
-                          std::vector<double> &obj_coeff_low);
-
-    void calculate_obj_coefficients(const graph::Graph &graph,
-                                    std::vector<double> &obj_coeff,
-                                    std::vector<double> &var_up,
-                                    std::vector<double> &var_low);
-
-    void solve_simplex(const std::vector<std::vector<double>> &matrix_coeff,
-                       const std::vector<double> &obj_coeff_low,
-                       const std::vector<double> &obj_coeff_up,
-                       const std::vector<double> &var_low,
-                       const std::vector<double> &var_up,
-                       const std::vector<double> &n_obj_coeff,
+    void set_matrix_row(graph::Vertex vertex, std::size_t choice, std::vector<utils::RevisedSimplex::Entry> &row) const;
+    void setup_matrix_rows(const graph::Graph &graph, utils::RevisedSimplex &lp);
+    void update_matrix_rows(utils::RevisedSimplex &lp);
+
+    void solve_simplex(utils::RevisedSimplex &lp,
                        std::vector<double> &sol,
                        double &obj);
+    void solve_lp(const graph::Graph &graph);
+    void solve_linear(const graph::Graph &graph);
+    bool improve_opponent(const graph::Graph &graph);
 
-    int count_player_edges(const graph::Graph &graph);
-
+    StrategyEvaluation evaluation_;
     uint switches;
     uint iterations;
     uint lpiter;
+    uint evaluations; ///< Linear systems solved (linear evaluation)
+    uint solveriter;  ///< Sweeps or Krylov iterations over all evaluations
     int num_real_vertices;
-    std::map<graph::Vertex, size_t> matrixMap;
-    std::map<int, graph::Vertex> reverseMap;
-    const graph::Graph *graph_;
-    std::map<graph::Vertex, int> strategy;
-    std::map<graph::Vertex, double> sol;
-    double oldcost;
-    std::vector<double> obj_coeff;
+    BasicChoiceMatrix<T> choices;
+    std::vector<std::size_t> matrixMap;
+    std::vector<graph::Vertex> reverseMap;
+    std::vector<std::size_t> strategy;   ///< Current choice of every vertex (player 1 only used by linear evaluation)
+    std::vector<std::size_t> playerRow;  ///< LP row of every player 0 vertex
+    std::vector<graph::Vertex> switched; ///< Player 0 vertices switched in the last iteration
+    std::vector<T> sol;
 };
 
+extern template class BasicStochasticDiscountedStrategySolver<float>;
+extern template class BasicStochasticDiscountedStrategySolver<double>;
+extern template class BasicStochasticDiscountedStrategySolver<long double>;
+extern template class BasicStochasticDiscountedStrategySolver<Rational>;
+
+using StochasticDiscountedStrategySolver = BasicStochasticDiscountedStrategySolver<double>;
+
 } // namespace stochastic_discounted
 } // namespace ggg
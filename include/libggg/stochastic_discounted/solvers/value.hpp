@@ -2,14 +2,37 @@
 
 #include "libggg/solvers/solver.hpp"
 #include "libggg/stochastic_discounted/graph.hpp"
+#include "libggg/stochastic_discounted/interval_value_iteration.hpp"
+#include "libggg/stochastic_discounted/numeric.hpp"
+#include "libggg/stochastic_discounted/topological_value_iteration.hpp"
+#include "libggg/stochastic_discounted/value_iteration.hpp"
 #include "libggg/utils/uintqueue.hpp"
 #include <boost/dynamic_bitset.hpp>
-#include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace ggg {
 namespace stochastic_discounted {
 
-using ValueSolutionType = ggg::solutions::RSQSolution<graph::Graph>;
+template <typename T>
+using BasicValueSolutionType = ggg::solutions::RSQSolution<graph::Graph, ggg::strategy::DeterministicStrategy<graph::Graph>, T>;
+using ValueSolutionType = BasicValueSolutionType<double>;
+
+/**
+ * @brief Iteration scheme of StochasticDiscountedValueSolver
+ *
+ * Worklist is the original scheme: vertices are re-evaluated until no value
+ * changes by more than NumericPolicy::convergence_tolerance() (1e-10 for
+ * double) in a sweep.  Jacobi, GaussSeidel and RedBlack
+ * run ValueIteration with the corresponding SweepOrder; Topological runs
+ * TopologicalValueIteration, solving one strongly connected component at a
+ * time; Interval runs IntervalValueIteration, which keeps a certified lower
+ * and upper bound for every vertex.  All but Worklist stop once the values
+ * are provably within the requested precision of the game's values.
+ */
+enum class ValueIterationMethod { Worklist, Jacobi, GaussSeidel, RedBlack, Topological, Interval };
 
 /**
  * @brief Value iteration algorithm for stochastic discounted games
@@ -17,23 +40,78 @@ using ValueSolutionType = ggg::solutions::RSQSolution<graph::Graph>;
  * Implementation of the classical value iteration method for solving stochastic
  * discounted games based on @cite DBLP:journals/pnas/Shapley53 and @cite DBLP:books/wi/Puterman94.
  * The algorithm iteratively updates value estimates until convergence using
- * Bellman equations with discounting factors.
+ * Bellman equations with discounting factors.  Each sweep evaluates the
+ * choices of every player vertex on the game's ChoiceMatrix.
+ *
+ * The values are computed in @p T; tolerances come from NumericPolicy<T>.
+ * A requested precision below attainable_precision() of the game in @p T is
+ * raised to it.  The solver is instantiated for float, double and long
+ * double: float halves the memory traffic of the values and coefficients
+ * of large games, long double tightens the attainable precision.
  */
-class StochasticDiscountedValueSolver : public ggg::solvers::Solver<graph::Graph, ValueSolutionType> {
+template <typename T>
+class BasicStochasticDiscountedValueSolver : public ggg::solvers::Solver<graph::Graph, BasicValueSolutionType<T>> {
   public:
-    auto solve(const graph::Graph &graph) -> ValueSolutionType override;
-    [[nodiscard]] auto get_name() const -> std::string override { return "Value Iteration Stochastic Discounted Game Solver"; }
+    using SolutionType = BasicValueSolutionType<T>;
+
+    /**
+     * @param method Iteration scheme
+     * @param precision Guaranteed maximal error of the values (all schemes but Worklist)
+     * @param threads Worker threads for Jacobi, RedBlack and Topological, 0 for ggg::utils::thread_count()
+     */
+    explicit BasicStochasticDiscountedValueSolver(ValueIterationMethod method = ValueIterationMethod::Worklist,
+                                                  double precision = 1e-9,
+                                                  unsigned threads = 0)
+        : method_(method), precision_(precision), threads_(threads) {}
+
+    auto solve(const graph::Graph &graph) -> SolutionType override;
+    [[nodiscard]] auto get_name() const -> std::string override {
+        std::string name = "Value Iteration Stochastic Discounted Game Solver";
+        if constexpr (!std::is_same_v<T, double>) {
+            name += std::string(" (") + NumericPolicy<T>::name + ")";
+        }
+        return name;
+    }
+
+    /**
+     * @brief Observe (and optionally stop) the Interval method after every sweep
+     *
+     * If the callback returns false the solver stops and reports the
+     * midpoints of the current intervals.
+     */
+    void set_progress_callback(BasicIntervalCallback<T> callback) { progress_ = std::move(callback); }
+
+    /**
+     * @brief Certified bounds of the last Interval solve, indexed by vertex
+     */
+    const std::vector<T> &lower_bounds() const { return lower_; }
+    const std::vector<T> &upper_bounds() const { return upper_; }
 
   private:
+    void solve_worklist(const graph::Graph &graph, const BasicChoiceMatrix<T> &matrix);
+    void solve_sweeps(const BasicChoiceMatrix<T> &matrix, const T &precision);
+    void solve_topological(const BasicChoiceMatrix<T> &matrix, const T &precision);
+    void solve_interval(const BasicChoiceMatrix<T> &matrix, const T &precision);
+
+    ValueIterationMethod method_;
+    double precision_;
+    unsigned threads_;
+    BasicIntervalCallback<T> progress_;
+    std::vector<T> lower_;
+    std::vector<T> upper_;
     uint lifts;
     uint iterations;
-    const graph::Graph *graph_;
     Uintqueue TAtr;
     boost::dynamic_bitset<> BAtr;
-    double oldcost;
-    std::map<graph::Vertex, int> strategy;
-    std::map<graph::Vertex, double> sol;
+    std::vector<int> strategy;
+    std::vector<T> sol;
 };
 
+extern template class BasicStochasticDiscountedValueSolver<float>;
+extern template class BasicStochasticDiscountedValueSolver<double>;
+extern template class BasicStochasticDiscountedValueSolver<long double>;
+
+using StochasticDiscountedValueSolver = BasicStochasticDiscountedValueSolver<double>;
+
 } // namespace stochastic_discounted
 } // namespace ggg
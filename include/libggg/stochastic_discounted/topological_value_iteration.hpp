@@ -0,0 +1,322 @@
+#pragma once
+
+#include "libggg/solvers/cancellation.hpp"
+#include "libggg/stochastic_discounted/choice_matrix.hpp"
+#include "libggg/stochastic_discounted/value_iteration.hpp"
+#include "libggg/utils/parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace ggg {
+namespace stochastic_discounted {
+
+/**
+ * @brief Value iteration one strongly connected component at a time
+ *
+ * The player vertices are split into the strongly connected components of
+ * the "reads the value of" relation of the ChoiceMatrix and solved in reverse
+ * topological order, so every component only reads final values outside
+ * itself.  A single-vertex component is solved exactly: for each choice the
+ * self loop is folded into the row, (r + Σ c·x) / (1 - c_self), and the best
+ * choice is kept.  A larger component runs Gauss-Seidel value iteration on
+ * its own rows only.
+ *
+ * Components of equal depth (longest path to a sink component) do not read
+ * each other and are solved on separate threads.
+ *
+ * Error bound: if the values read outside a component are within e of the
+ * game's values, the fixed point of the component's rows is within γ·e, since
+ * every row's coefficients sum to at most γ.  A component therefore stops
+ * once its own iteration bound is at most precision - γ·e, which keeps every
+ * vertex within the requested precision.
+ *
+ * @tparam T Value type (see NumericPolicy)
+ */
+template <typename T>
+class BasicTopologicalValueIteration {
+  public:
+    /**
+     * @param matrix Compiled game; must outlive this object
+     * @param threads Worker threads across independent components, 0 for ggg::utils::thread_count()
+     */
+    explicit BasicTopologicalValueIteration(const BasicChoiceMatrix<T> &matrix, unsigned threads = 0)
+        : matrix_(matrix), threads_(threads), choice_(matrix.num_vertices(), 0) {
+        for (std::size_t v = 0; v < matrix.num_vertices(); ++v) {
+            if (matrix.player[v] != -1) {
+                choice_[v] = matrix.first_choice(v);
+            }
+        }
+        decompose();
+    }
+
+    /**
+     * @brief Solve every component, sinks first
+     *
+     * @param values Valuation indexed by vertex, updated in place; entries of
+     *        vertices in cyclic components are the starting point of their
+     *        iteration, probabilistic entries are left untouched
+     * @param precision Required bound on the distance to the game's values
+     * @return Number of vertex backups
+     * @throws std::invalid_argument if @p precision is not positive or the
+     *         game is not discounted (γ >= 1)
+     */
+    std::size_t run(std::vector<T> &values, const T &precision) {
+        if (!(precision > 0)) {
+            throw std::invalid_argument("value iteration precision must be positive");
+        }
+        if (contraction_factor(matrix_) >= 1) {
+            throw std::invalid_argument("value iteration requires all discounts below 1");
+        }
+        error_.assign(num_components(), T(0));
+        std::atomic<std::size_t> backups{0};
+        for (std::size_t level = 0; level + 1 < level_start_.size(); ++level) {
+            ggg::solvers::throw_if_cancelled();
+            const std::size_t first = level_start_[level];
+            const std::size_t count = level_start_[level + 1] - first;
+            const auto solve_block = [&](std::size_t begin, std::size_t end) {
+                std::size_t local = 0;
+                for (std::size_t i = begin; i < end; ++i) {
+                    local += solve_component(by_level_[first + i], values, precision);
+                }
+                backups += local;
+            };
+            if (level_rows_[level] < kMinParallelRows) {
+                solve_block(0, count);
+            } else {
+                utils::parallel_for(count, solve_block, threads_);
+            }
+        }
+        error_bound_ = error_.empty() ? T(0) : *std::max_element(error_.begin(), error_.end());
+        return backups;
+    }
+
+    /**
+     * @brief Best choice of every player vertex after run()
+     */
+    const std::vector<std::size_t> &choices() const { return choice_; }
+
+    /**
+     * @brief Guaranteed distance of the last run's values to the game's values
+     */
+    T error_bound() const { return error_bound_; }
+
+    std::size_t num_components() const { return component_start_.size() - 1; }
+
+    /**
+     * @brief Components of more than one vertex, solved by iteration
+     */
+    std::size_t num_cyclic_components() const {
+        std::size_t result = 0;
+        for (std::size_t k = 0; k < num_components(); ++k) {
+            result += component_start_[k + 1] - component_start_[k] > 1;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Number of batches of mutually independent components
+     */
+    std::size_t num_levels() const { return level_start_.size() - 1; }
+
+  private:
+    static constexpr std::size_t kNone = std::numeric_limits<std::size_t>::max();
+    // Choice rows per level; below this the level is solved on the calling thread.
+    static constexpr std::size_t kMinParallelRows = 4096;
+
+    const BasicChoiceMatrix<T> &matrix_;
+    unsigned threads_;
+    std::vector<std::size_t> choice_;
+    std::vector<std::size_t> component_;       ///< Component of every player vertex
+    std::vector<std::size_t> component_start_; ///< Offsets of each component's vertices in members_
+    std::vector<std::size_t> members_;         ///< Player vertices grouped by component
+    std::vector<std::size_t> level_start_;     ///< Offsets of each level's components in by_level_
+    std::vector<std::size_t> by_level_;        ///< Components grouped by level
+    std::vector<std::size_t> level_rows_;      ///< Choice rows of every level
+    std::vector<T> error_;                     ///< Error bound of every solved component
+    T error_bound_ = std::numeric_limits<T>::infinity();
+
+    // Iterative Tarjan; components are numbered in the order they complete,
+    // so every component only reads lower-numbered ones.
+    void decompose() {
+        const std::size_t n = matrix_.num_vertices();
+        component_.assign(n, kNone);
+        component_start_.assign(1, 0);
+        members_.clear();
+        std::vector<std::size_t> index(n, kNone);
+        std::vector<std::size_t> low(n, 0);
+        std::vector<std::size_t> stack;
+        struct Frame {
+            std::size_t vertex;
+            std::size_t choice;
+            std::size_t column;
+        };
+        std::vector<Frame> frames;
+        std::size_t counter = 0;
+
+        for (std::size_t root = 0; root < n; ++root) {
+            if (matrix_.player[root] == -1 || index[root] != kNone) {
+                continue;
+            }
+            index[root] = low[root] = counter++;
+            stack.push_back(root);
+            frames.push_back({root, matrix_.first_choice(root), 0});
+            while (!frames.empty()) {
+                Frame &frame = frames.back();
+                const std::size_t v = frame.vertex;
+                if (frame.choice < matrix_.end_choice(v)) {
+                    const auto columns = matrix_.row_columns(frame.choice);
+                    if (frame.column == columns.size()) {
+                        ++frame.choice;
+                        frame.column = 0;
+                        continue;
+                    }
+                    const std::size_t u = columns[frame.column++];
+                    if (index[u] == kNone) {
+                        index[u] = low[u] = counter++;
+                        stack.push_back(u);
+                        frames.push_back({u, matrix_.first_choice(u), 0});
+                    } else if (component_[u] == kNone) {
+                        low[v] = std::min(low[v], index[u]);
+                    }
+                    continue;
+                }
+                if (low[v] == index[v]) {
+                    const std::size_t id = component_start_.size() - 1;
+                    std::size_t u;
+                    do {
+                        u = stack.back();
+                        stack.pop_back();
+                        component_[u] = id;
+                        members_.push_back(u);
+                    } while (u != v);
+                    component_start_.push_back(members_.size());
+                }
+                frames.pop_back();
+                if (!frames.empty()) {
+                    const std::size_t parent = frames.back().vertex;
+                    low[parent] = std::min(low[parent], low[v]);
+                }
+            }
+        }
+
+        // Level of a component: longest path to a sink component.
+        const std::size_t components = num_components();
+        std::vector<std::size_t> level(components, 0);
+        std::size_t levels = 0;
+        for (std::size_t k = 0; k < components; ++k) {
+            for (std::size_t i = component_start_[k]; i < component_start_[k + 1]; ++i) {
+                const std::size_t v = members_[i];
+                for (std::size_t c = matrix_.first_choice(v); c < matrix_.end_choice(v); ++c) {
+                    for (const std::size_t u : matrix_.row_columns(c)) {
+                        if (component_[u] != k) {
+                            level[k] = std::max(level[k], level[component_[u]] + 1);
+                        }
+                    }
+                }
+            }
+            levels = std::max(levels, level[k] + 1);
+        }
+        level_start_.assign(levels + 1, 0);
+        level_rows_.assign(levels, 0);
+        for (std::size_t k = 0; k < components; ++k) {
+            ++level_start_[level[k] + 1];
+            for (std::size_t i = component_start_[k]; i < component_start_[k + 1]; ++i) {
+                level_rows_[level[k]] += matrix_.end_choice(members_[i]) - matrix_.first_choice(members_[i]);
+            }
+        }
+        for (std::size_t l = 0; l < levels; ++l) {
+            level_start_[l + 1] += level_start_[l];
+        }
+        by_level_.resize(components);
+        std::vector<std::size_t> next(level_start_.begin(), level_start_.end() - 1);
+        for (std::size_t k = 0; k < components; ++k) {
+            by_level_[next[level[k]]++] = k;
+        }
+    }
+
+    // Returns the number of backups; records the component's error bound.
+    std::size_t solve_component(std::size_t k, std::vector<T> &values, const T &precision) {
+        using std::abs;
+        const std::size_t begin = component_start_[k];
+        const std::size_t end = component_start_[k + 1];
+
+        // Largest error read from other components, and the component's γ.
+        T inherited(0);
+        T gamma(0);
+        for (std::size_t i = begin; i < end; ++i) {
+            const std::size_t v = members_[i];
+            for (std::size_t c = matrix_.first_choice(v); c < matrix_.end_choice(v); ++c) {
+                const auto columns = matrix_.row_columns(c);
+                const auto coefficients = matrix_.row_coefficients(c);
+                T sum(0);
+                for (std::size_t j = 0; j < columns.size(); ++j) {
+                    sum += coefficients[j];
+                    if (component_[columns[j]] != k) {
+                        inherited = std::max(inherited, error_[component_[columns[j]]]);
+                    }
+                }
+                gamma = std::max(gamma, sum);
+            }
+        }
+
+        if (end - begin == 1) {
+            const std::size_t v = members_[begin];
+            values[v] = exact_backup(v, values);
+            error_[k] = gamma * inherited;
+            return 1;
+        }
+
+        const T scale = gamma / (1 - gamma);
+        const T target = precision - gamma * inherited;
+        std::size_t backups = 0;
+        T residual;
+        do {
+            residual = 0;
+            for (std::size_t i = begin; i < end; ++i) {
+                const std::size_t v = members_[i];
+                const T value = bellman_backup(matrix_, v, values, choice_[v]);
+                residual = std::max<T>(residual, abs(value - values[v]));
+                values[v] = value;
+            }
+            backups += end - begin;
+        } while (scale * residual > target);
+        error_[k] = gamma * inherited + scale * residual;
+        return backups;
+    }
+
+    // Value of a vertex whose only dependency inside its component is itself.
+    T exact_backup(std::size_t v, const std::vector<T> &values) {
+        using Accumulator = typename NumericPolicy<T>::accumulator_type;
+        const bool maximise = matrix_.player[v] == 0;
+        T best(0);
+        for (std::size_t c = matrix_.first_choice(v); c < matrix_.end_choice(v); ++c) {
+            const auto columns = matrix_.row_columns(c);
+            const auto coefficients = matrix_.row_coefficients(c);
+            Accumulator sum = matrix_.reward[c];
+            Accumulator diagonal(1);
+            for (std::size_t j = 0; j < columns.size(); ++j) {
+                if (columns[j] == v) {
+                    diagonal -= coefficients[j];
+                } else {
+                    sum += Accumulator(coefficients[j]) * Accumulator(values[columns[j]]);
+                }
+            }
+            const T value = T(sum / diagonal);
+            if (c == matrix_.first_choice(v) || (maximise ? value > best : value < best)) {
+                best = value;
+                choice_[v] = c;
+            }
+        }
+        return best;
+    }
+};
+
+using TopologicalValueIteration = BasicTopologicalValueIteration<double>;
+
+} // namespace stochastic_discounted
+} // namespace ggg
@@ -0,0 +1,262 @@
+#pragma once
+
+#include "libggg/solvers/cancellation.hpp"
+#include "libggg/stochastic_discounted/choice_matrix.hpp"
+#include "libggg/utils/parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace ggg {
+namespace stochastic_discounted {
+
+/**
+ * @brief Order in which a value iteration sweep updates the player vertices
+ *
+ * - Jacobi: every backup reads the previous sweep's values; rows are split
+ *   into blocks updated on separate threads.
+ * - GaussSeidel: vertices are updated in place in index order, so each backup
+ *   sees the values already updated in this sweep; single-threaded.
+ * - RedBlack: vertices are split into two colours by the parity of their
+ *   breadth-first depth in the dependency graph.  Each colour is updated as a
+ *   threaded Jacobi half-sweep that reads the other colour's fresh values.
+ */
+enum class SweepOrder { Jacobi, GaussSeidel, RedBlack };
+
+/**
+ * @brief Contraction factor of the Bellman operator of a compiled game
+ *
+ * The largest coefficient sum of any choice row, i.e. the largest discount
+ * (times the probability mass reached).  The Bellman operator, and every
+ * sweep order above, is a contraction with this factor in the maximum norm.
+ */
+template <typename T>
+T contraction_factor(const BasicChoiceMatrix<T> &matrix) {
+    T result(0);
+    for (std::size_t c = 0; c < matrix.num_choices(); ++c) {
+        T sum(0);
+        for (const T &coefficient : matrix.row_coefficients(c)) {
+            sum += coefficient;
+        }
+        result = std::max(result, sum);
+    }
+    return result;
+}
+
+/**
+ * @brief Bellman backup of a player vertex
+ *
+ * @param matrix Compiled game
+ * @param vertex Player vertex to back up
+ * @param values Current valuation, indexed by vertex
+ * @param choice Receives the first best choice (maximal for player 0,
+ *        minimal for player 1)
+ * @return Value of that choice
+ */
+template <typename T>
+T bellman_backup(const BasicChoiceMatrix<T> &matrix, std::size_t vertex, const std::vector<T> &values, std::size_t &choice) {
+    const bool maximise = matrix.player[vertex] == 0;
+    choice = matrix.first_choice(vertex);
+    T best = matrix.value(choice, values);
+    for (std::size_t c = choice + 1; c < matrix.end_choice(vertex); ++c) {
+        const T value = matrix.value(c, values);
+        if (maximise ? value > best : value < best) {
+            best = value;
+            choice = c;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Smallest precision value iteration can certify in the value type T
+ *
+ * Rounding perturbs every backup by up to unit_roundoff · |x|, so on values
+ * of magnitude max|reward| / (1 - γ) the change of a sweep stalls near that
+ * amount and the error bound γ/(1-γ) times the change stops falling.  Solvers
+ * raise a requested precision below this to it.  0 for exact types.
+ */
+template <typename T>
+T attainable_precision(const BasicChoiceMatrix<T> &matrix) {
+    using std::abs;
+    const T gamma = contraction_factor(matrix);
+    if (NumericPolicy<T>::exact || !(gamma < T(1))) {
+        return T(0);
+    }
+    T magnitude(0);
+    for (const T &reward : matrix.reward) {
+        magnitude = std::max<T>(magnitude, abs(reward));
+    }
+    return gamma / (1 - gamma) * magnitude / (1 - gamma) * NumericPolicy<T>::unit_roundoff();
+}
+
+/**
+ * @brief Value iteration on a ChoiceMatrix with a guaranteed error bound
+ *
+ * With contraction factor γ, the values x_k after a sweep that changed no
+ * value by more than r satisfy |x_k - x*| <= γ/(1-γ) · r.  run() iterates
+ * until this bound is at most the requested precision, so the reported
+ * values are within that distance of the game's values in every vertex.
+ *
+ * @tparam T Value type (see NumericPolicy)
+ */
+template <typename T>
+class BasicValueIteration {
+  public:
+    /**
+     * @param matrix Compiled game; must outlive this object
+     * @param order Sweep order
+     * @param threads Worker threads for Jacobi and RedBlack sweeps, 0 for ggg::utils::thread_count()
+     */
+    BasicValueIteration(const BasicChoiceMatrix<T> &matrix, SweepOrder order, unsigned threads = 0)
+        : matrix_(matrix),
+          order_(order),
+          threads_(threads),
+          gamma_(contraction_factor(matrix)),
+          choice_(matrix.num_vertices(), 0) {
+        for (std::size_t v = 0; v < matrix.num_vertices(); ++v) {
+            if (matrix.player[v] != -1) {
+                vertices_.push_back(v);
+                choice_[v] = matrix.first_choice(v);
+            }
+        }
+        if (order_ == SweepOrder::RedBlack) {
+            split_colours();
+        }
+    }
+
+    /**
+     * @brief Iterate from @p values until the error bound reaches @p precision
+     *
+     * @param values Initial valuation (indexed by vertex), updated in place;
+     *        entries of probabilistic vertices are left untouched
+     * @param precision Required bound on the distance to the game's values
+     * @return Number of sweeps
+     * @throws std::invalid_argument if @p precision is not positive or the
+     *         game is not discounted (γ >= 1)
+     */
+    std::size_t run(std::vector<T> &values, const T &precision) {
+        if (!(precision > 0)) {
+            throw std::invalid_argument("value iteration precision must be positive");
+        }
+        if (gamma_ >= 1) {
+            throw std::invalid_argument("value iteration requires all discounts below 1");
+        }
+        const T scale = gamma_ / (1 - gamma_);
+        std::size_t sweeps = 0;
+        do {
+            ggg::solvers::throw_if_cancelled();
+            residual_ = sweep(values);
+            ++sweeps;
+        } while (scale * residual_ > precision);
+        error_bound_ = scale * residual_;
+        return sweeps;
+    }
+
+    /**
+     * @brief Best choice of every player vertex in the last sweep
+     */
+    const std::vector<std::size_t> &choices() const { return choice_; }
+
+    /**
+     * @brief Guaranteed distance of the last run's values to the game's values
+     */
+    T error_bound() const { return error_bound_; }
+
+    T gamma() const { return gamma_; }
+
+  private:
+    const BasicChoiceMatrix<T> &matrix_;
+    SweepOrder order_;
+    unsigned threads_;
+    T gamma_;
+    T residual_ = std::numeric_limits<T>::infinity();
+    T error_bound_ = std::numeric_limits<T>::infinity();
+    std::vector<std::size_t> vertices_;
+    std::vector<std::size_t> colours_[2];
+    std::vector<std::size_t> choice_;
+    std::vector<T> next_;
+
+    // Rows per block; below this a block is not worth a thread.
+    static constexpr std::size_t kMinBlock = 256;
+
+    T sweep(std::vector<T> &values) {
+        using std::abs;
+        switch (order_) {
+        case SweepOrder::GaussSeidel: {
+            T residual(0);
+            for (const std::size_t v : vertices_) {
+                const T value = bellman_backup(matrix_, v, values, choice_[v]);
+                residual = std::max<T>(residual, abs(value - values[v]));
+                values[v] = value;
+            }
+            return residual;
+        }
+        case SweepOrder::RedBlack:
+            return std::max(jacobi(colours_[0], values), jacobi(colours_[1], values));
+        case SweepOrder::Jacobi:
+        default:
+            return jacobi(vertices_, values);
+        }
+    }
+
+    // Back up @p rows from the current values, then publish the new values.
+    T jacobi(const std::vector<std::size_t> &rows, std::vector<T> &values) {
+        using std::abs;
+        next_.resize(rows.size());
+        T residual(0);
+        std::mutex residual_mutex;
+        utils::parallel_for(rows.size(), [&](std::size_t begin, std::size_t end) {
+            T local(0);
+            for (std::size_t i = begin; i < end; ++i) {
+                const std::size_t v = rows[i];
+                next_[i] = bellman_backup(matrix_, v, values, choice_[v]);
+                local = std::max<T>(local, abs(next_[i] - values[v]));
+            }
+            const std::lock_guard<std::mutex> lock(residual_mutex);
+            residual = std::max<T>(residual, local);
+        }, threads_, kMinBlock);
+        for (std::size_t i = 0; i < rows.size(); ++i) {
+            values[rows[i]] = next_[i];
+        }
+        return residual;
+    }
+
+    // Colour vertices by the parity of their breadth-first depth over the
+    // "reads the value of" relation, so that most dependencies cross colours.
+    void split_colours() {
+        const std::size_t n = matrix_.num_vertices();
+        std::vector<std::size_t> depth(n, n);
+        std::vector<std::size_t> queue;
+        for (const std::size_t root : vertices_) {
+            if (depth[root] != n) {
+                continue;
+            }
+            depth[root] = 0;
+            queue.assign(1, root);
+            for (std::size_t head = 0; head < queue.size(); ++head) {
+                const std::size_t v = queue[head];
+                for (std::size_t c = matrix_.first_choice(v); c < matrix_.end_choice(v); ++c) {
+                    for (const std::size_t u : matrix_.row_columns(c)) {
+                        if (depth[u] == n) {
+                            depth[u] = depth[v] + 1;
+                            queue.push_back(u);
+                        }
+                    }
+                }
+            }
+        }
+        for (const std::size_t v : vertices_) {
+            colours_[depth[v] % 2].push_back(v);
+        }
+    }
+};
+
+using ValueIteration = BasicValueIteration<double>;
+
+} // namespace stochastic_discounted
+} // namespace ggg
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "libggg/utils/output_sink.hpp"
 #include <boost/graph/graph_traits.hpp>
 #include <ostream>
 #include <string>
@@ -26,5 +27,18 @@ inline std::ostream &to_stream(std::ostream &os, const DeterministicStrategy<Gra
     return os;
 }
 
+template <typename GraphType>
+inline void write_json(utils::OutputSink &out, const DeterministicStrategy<GraphType> &s) {
+    if (s == boost::graph_traits<GraphType>::null_vertex())
+        out.write("null");
+    else
+        out.integer(static_cast<std::size_t>(s));
+}
+
+template <typename GraphType>
+inline void write_text(utils::OutputSink &out, const DeterministicStrategy<GraphType> &s) {
+    write_json<GraphType>(out, s);
+}
+
 } // namespace strategy
 } // namespace ggg
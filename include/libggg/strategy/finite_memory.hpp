@@ -1,5 +1,6 @@
 #pragma once
 
+#include "libggg/utils/output_sink.hpp"
 #include <boost/graph/graph_traits.hpp>
 #include <ostream>
 #include <sstream>
@@ -25,5 +26,15 @@ inline std::ostream &to_stream(std::ostream &os, const FiniteMemoryStrategy<Grap
     return os;
 }
 
+template <typename GraphType>
+inline void write_json(utils::OutputSink &out, const FiniteMemoryStrategy<GraphType> &fm) {
+    out.write("{\"move\":").integer(static_cast<std::size_t>(fm.first)).write(",\"memory\":").integer(fm.second).put('}');
+}
+
+template <typename GraphType>
+inline void write_text(utils::OutputSink &out, const FiniteMemoryStrategy<GraphType> &fm) {
+    out.put('(').integer(static_cast<std::size_t>(fm.first)).put(',').integer(fm.second).put(')');
+}
+
 } // namespace strategy
 } // namespace ggg
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "libggg/utils/output_sink.hpp"
 #include <boost/graph/graph_traits.hpp>
 #include <ostream>
 #include <sstream>
@@ -42,5 +43,31 @@ inline std::ostream &to_stream(std::ostream &os, const MixingStrategy<GraphType>
     return os;
 }
 
+template <typename GraphType>
+inline void write_json(utils::OutputSink &out, const MixingStrategy<GraphType> &m) {
+    out.put('[');
+    bool first = true;
+    for (const auto &pr : m) {
+        if (!first)
+            out.put(',');
+        first = false;
+        out.write("{\"succ\":").integer(static_cast<std::size_t>(pr.first)).write(",\"prob\":").general(pr.second, 6).put('}');
+    }
+    out.put(']');
+}
+
+template <typename GraphType>
+inline void write_text(utils::OutputSink &out, const MixingStrategy<GraphType> &m) {
+    out.put('[');
+    bool first = true;
+    for (const auto &pr : m) {
+        if (!first)
+            out.put(',');
+        first = false;
+        out.put('(').integer(static_cast<std::size_t>(pr.first)).put('@').general(pr.second).put(')');
+    }
+    out.put(']');
+}
+
 } // namespace strategy
 } // namespace ggg
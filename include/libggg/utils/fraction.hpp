@@ -0,0 +1,133 @@
+#pragma once
+
+#include <boost/rational.hpp>
+#include <tuple>
+#include <utility>
+
+namespace ggg {
+namespace utils {
+
+/**
+ * @brief Exact fraction with 128-bit numerator and positive denominator
+ *
+ * Used by solvers that recover exact rational values (e.g. mean-payoff
+ * values, whose denominators are bounded by the number of vertices) from
+ * integer bounds.  128-bit components leave room for the cross products of
+ * 64-bit quantities.  Fractions are not kept in lowest terms unless produced
+ * by @ref simplest_between.
+ */
+struct Fraction {
+    __int128 num;
+    __int128 den;
+
+    friend bool operator<(const Fraction &a, const Fraction &b) { return a.num * b.den < b.num * a.den; }
+    friend bool operator<=(const Fraction &a, const Fraction &b) { return a.num * b.den <= b.num * a.den; }
+    friend bool operator==(const Fraction &a, const Fraction &b) { return a.num * b.den == b.num * a.den; }
+
+    /**
+     * @brief Convert to a 64-bit boost::rational (components must fit)
+     */
+    boost::rational<long long> to_rational() const {
+        return {static_cast<long long>(num), static_cast<long long>(den)};
+    }
+};
+
+namespace detail {
+
+inline __int128 floor_div(__int128 a, __int128 b) {
+    const __int128 q = a / b;
+    return (a % b != 0 && ((a < 0) != (b < 0))) ? q - 1 : q;
+}
+
+// Inverse of a modulo m (m > 1, gcd(a, m) = 1) by the extended Euclidean algorithm.
+inline long long mod_inverse(long long a, long long m) {
+    long long old_r = ((a % m) + m) % m, r = m;
+    long long old_s = 1, s = 0;
+    while (r != 0) {
+        const long long q = old_r / r;
+        old_r -= q * r;
+        std::swap(old_r, r);
+        old_s -= q * s;
+        std::swap(old_s, s);
+    }
+    return ((old_s % m) + m) % m;
+}
+
+} // namespace detail
+
+/**
+ * @brief Fraction with the smallest denominator in the closed interval [lo, hi]
+ *
+ * Descends the Stern–Brocot tree through the continued fraction expansions
+ * of the bounds.  The result is in lowest terms.
+ *
+ * @pre lo <= hi
+ */
+inline Fraction simplest_between(const Fraction &lo, const Fraction &hi) {
+    const __int128 whole = detail::floor_div(lo.num, lo.den);
+    if (whole * lo.den == lo.num) {
+        return {whole, 1};
+    }
+    if ((whole + 1) * hi.den <= hi.num) {
+        return {whole + 1, 1};
+    }
+    // whole < lo <= hi < whole + 1: recurse on the reciprocals of the fractional parts.
+    const Fraction inner = simplest_between({hi.den, hi.num - whole * hi.den}, {lo.den, lo.num - whole * lo.den});
+    return {whole * inner.num + inner.den, inner.num};
+}
+
+/**
+ * @brief Neighbours of a fraction in the Farey sequence of order @p order
+ *
+ * @param value Fraction in lowest terms with denominator <= order
+ * @param order Order of the Farey sequence (largest allowed denominator)
+ * @return {left, right}: the closest fractions with denominator <= order
+ *         strictly below and above @p value
+ */
+inline std::pair<Fraction, Fraction> farey_neighbours(const Fraction &value, long long order) {
+    const long long p = static_cast<long long>(value.num);
+    const long long q = static_cast<long long>(value.den);
+    if (q == 1) {
+        return {{__int128(p) * order - 1, order}, {__int128(p) * order + 1, order}};
+    }
+    // Left neighbour a/b: p·b − a·q = 1; right neighbour c/d: c·q − d·p = 1.
+    const long long inv = detail::mod_inverse(p, q);
+    const long long b = inv + q * ((order - inv) / q);
+    const long long d0 = q - inv;
+    const long long d = d0 + q * ((order - d0) / q);
+    return {{(__int128(p) * b - 1) / q, b}, {(__int128(p) * d + 1) / q, d}};
+}
+
+/**
+ * @brief The only fraction with denominator <= order in an interval, if unique
+ *
+ * @param lo Lower bound (inclusive)
+ * @param hi Upper bound, inclusive unless @p hi_open
+ * @param order Largest allowed denominator
+ * @param hi_open Whether @p hi itself is excluded from the interval
+ * @param[out] result The unique fraction, in lowest terms, when found
+ * @return true iff the interval contains exactly one fraction of the order
+ */
+inline bool unique_of_order(const Fraction &lo, const Fraction &hi, long long order, bool hi_open, Fraction &result) {
+    Fraction candidate = simplest_between(lo, hi);
+    if (candidate.den > order) {
+        return false;
+    }
+    auto [left, right] = farey_neighbours(candidate, order);
+    if (hi_open && candidate == hi) {
+        // Excluded bound: the only candidate left is its lower neighbour.
+        candidate = left;
+        if (candidate < lo) {
+            return false;
+        }
+        std::tie(left, right) = farey_neighbours(candidate, order);
+    }
+    if (!(left < lo) || (hi_open ? right < hi : right <= hi)) {
+        return false;
+    }
+    result = candidate;
+    return true;
+}
+
+} // namespace utils
+} // namespace ggg
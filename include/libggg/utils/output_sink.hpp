@@ -0,0 +1,186 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <ostream>
+#include <sstream>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace ggg {
+namespace utils {
+
+/**
+ * @brief Fixed-size output buffer in front of an std::ostream
+ *
+ * Solutions write their JSON and plain-text forms through a sink instead of
+ * building strings, so emitting a solution takes the buffer's memory and no
+ * more, however large the game.  Numbers are formatted with std::to_chars
+ * straight into the buffer; the formats reproduce the printf conversions
+ * the string-building helpers used (std::to_string and default ostream
+ * output), so the bytes written are unchanged.
+ *
+ * The buffer is handed to the stream whenever it fills and on flush() or
+ * destruction.  With @c flush_bytes set, the stream itself is also flushed
+ * each time that many bytes have passed through, so a consumer reading a
+ * pipe sees the output in chunks instead of all at the end.
+ */
+class OutputSink {
+  public:
+    static constexpr std::size_t default_capacity = std::size_t(1) << 16;
+
+    /**
+     * @param os Destination; must outlive the sink
+     * @param flush_bytes Flush @p os after every this many bytes (0: only
+     *        when the caller flushes it)
+     * @param capacity Buffer size in bytes (at least 8 KiB, enough for any
+     *        formatted number)
+     */
+    explicit OutputSink(std::ostream &os, std::size_t flush_bytes = 0, std::size_t capacity = default_capacity)
+        : os_(os), buffer_(std::max<std::size_t>(capacity, 8192)), flush_bytes_(flush_bytes),
+          precision_(static_cast<int>(os.precision())) {}
+
+    OutputSink(const OutputSink &) = delete;
+    OutputSink &operator=(const OutputSink &) = delete;
+
+    ~OutputSink() { flush_buffer(); }
+
+    OutputSink &put(char c) {
+        if (size_ == buffer_.size()) {
+            flush_buffer();
+        }
+        buffer_[size_++] = c;
+        return *this;
+    }
+
+    OutputSink &write(std::string_view text) {
+        while (!text.empty()) {
+            if (size_ == buffer_.size()) {
+                flush_buffer();
+            }
+            const std::size_t n = std::min(text.size(), buffer_.size() - size_);
+            std::copy_n(text.data(), n, buffer_.data() + size_);
+            size_ += n;
+            text.remove_prefix(n);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief @p text as a quoted JSON string, escaping quotes, backslashes and control characters
+     */
+    OutputSink &json_string(std::string_view text) {
+        static constexpr char hex[] = "0123456789abcdef";
+        put('"');
+        for (const char c : text) {
+            if (c == '"' || c == '\\') {
+                put('\\').put(c);
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                write("\\u00").put(hex[(c >> 4) & 0xf]).put(hex[c & 0xf]);
+            } else {
+                put(c);
+            }
+        }
+        return put('"');
+    }
+
+    /**
+     * @brief Integer in decimal
+     */
+    template <typename T>
+        requires std::is_integral_v<T>
+    OutputSink &integer(T value) {
+        return format([&](char *first, char *last) { return std::to_chars(first, last, value); });
+    }
+
+    /**
+     * @brief Floating-point number as printf's %f with @p precision digits, like std::to_string
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    OutputSink &fixed(T value, int precision = 6) {
+        return format([&](char *first, char *last) { return std::to_chars(first, last, value, std::chars_format::fixed, precision); });
+    }
+
+    /**
+     * @brief Floating-point number as printf's %g, like default ostream output
+     *
+     * @param precision Significant digits; negative takes the destination
+     *        stream's precision
+     */
+    template <typename T>
+        requires std::is_floating_point_v<T>
+    OutputSink &general(T value, int precision = -1) {
+        const int digits = precision < 0 ? precision_ : precision;
+        return format([&](char *first, char *last) { return std::to_chars(first, last, value, std::chars_format::general, digits); });
+    }
+
+    /**
+     * @brief Any value with operator<<, formatted as the destination stream would
+     *
+     * For values without a to_chars form, such as exact rationals.  Integers
+     * and floating-point values take the to_chars paths above.
+     */
+    template <typename T>
+    OutputSink &streamed(const T &value) {
+        if constexpr (std::is_same_v<T, bool>) {
+            return integer(static_cast<int>(value));
+        } else if constexpr (std::is_integral_v<T>) {
+            return integer(value);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return general(value);
+        } else {
+            std::ostringstream oss;
+            oss.precision(precision_);
+            oss << value;
+            return write(oss.view());
+        }
+    }
+
+    /**
+     * @brief Hand the buffer to the stream and flush the stream
+     */
+    void flush() {
+        flush_buffer();
+        os_.flush();
+        unflushed_ = 0;
+    }
+
+  private:
+    std::ostream &os_;
+    std::vector<char> buffer_;
+    std::size_t size_ = 0;
+    std::size_t flush_bytes_;
+    std::size_t unflushed_ = 0;
+    int precision_;
+
+    template <typename Format>
+    OutputSink &format(Format to_chars) {
+        auto result = to_chars(buffer_.data() + size_, buffer_.data() + buffer_.size());
+        if (result.ec != std::errc()) {
+            flush_buffer();
+            result = to_chars(buffer_.data(), buffer_.data() + buffer_.size());
+        }
+        size_ = static_cast<std::size_t>(result.ptr - buffer_.data());
+        return *this;
+    }
+
+    void flush_buffer() {
+        if (size_ == 0) {
+            return;
+        }
+        os_.write(buffer_.data(), static_cast<std::streamsize>(size_));
+        unflushed_ += size_;
+        size_ = 0;
+        if (flush_bytes_ != 0 && unflushed_ >= flush_bytes_) {
+            os_.flush();
+            unflushed_ = 0;
+        }
+    }
+};
+
+} // namespace utils
+} // namespace ggg
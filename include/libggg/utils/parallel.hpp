@@ -0,0 +1,99 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ggg {
+namespace utils {
+
+/**
+ * @brief Resolve the number of worker threads to use
+ *
+ * Resolution order: an explicit positive @p requested value, then the
+ * `GGG_THREADS` environment variable, then `std::thread::hardware_concurrency()`.
+ * The result is always at least 1.
+ *
+ * @param requested Explicit thread count, or 0 for automatic
+ * @return Number of threads to use
+ */
+inline unsigned thread_count(unsigned requested = 0) {
+    if (requested > 0) {
+        return requested;
+    }
+    if (const char *env = std::getenv("GGG_THREADS")) {
+        try {
+            const int value = std::stoi(env);
+            if (value > 0) {
+                return static_cast<unsigned>(value);
+            }
+        } catch (const std::exception &) {
+            // Ignore malformed values and fall back to the hardware default.
+        }
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/**
+ * @brief Run a block-wise loop over [0, count) on several threads
+ *
+ * The range is split into at most @p threads contiguous blocks of at least
+ * @p min_block elements; `fn(begin, end)` is called once per block.  The
+ * calling thread processes the first block itself, so a single block runs
+ * without spawning any thread.  The first exception thrown by any block is
+ * rethrown after all blocks have finished.
+ *
+ * @tparam Fn Callable with signature void(std::size_t begin, std::size_t end)
+ * @param count Number of loop iterations
+ * @param fn Block body; must be safe to call concurrently on disjoint blocks
+ * @param threads Maximum number of threads, 0 for @ref thread_count()
+ * @param min_block Minimum number of iterations per block
+ */
+template <typename Fn>
+inline void parallel_for(std::size_t count, Fn &&fn, unsigned threads = 0, std::size_t min_block = 1) {
+    if (count == 0) {
+        return;
+    }
+    const std::size_t max_blocks = std::max<std::size_t>(1, count / std::max<std::size_t>(1, min_block));
+    const std::size_t blocks = std::min<std::size_t>(thread_count(threads), max_blocks);
+    if (blocks == 1) {
+        fn(std::size_t{0}, count);
+        return;
+    }
+
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    const auto run_block = [&](std::size_t block) {
+        const std::size_t begin = count * block / blocks;
+        const std::size_t end = count * (block + 1) / blocks;
+        try {
+            fn(begin, end);
+        } catch (...) {
+            const std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(blocks - 1);
+    for (std::size_t block = 1; block < blocks; ++block) {
+        workers.emplace_back(run_block, block);
+    }
+    run_block(0);
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace utils
+} // namespace ggg
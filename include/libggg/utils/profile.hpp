@@ -0,0 +1,275 @@
+#pragma once
+
+#include "libggg/utils/output_sink.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <utility>
+#include <vector>
+#ifdef __linux__
+#include <sched.h>
+#endif
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+namespace ggg {
+namespace utils {
+
+/**
+ * @brief CPU time consumed so far by all threads of the process, in seconds
+ */
+inline double process_cpu_seconds() {
+    timespec now{};
+    ::clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+    return static_cast<double>(now.tv_sec) + static_cast<double>(now.tv_nsec) * 1e-9;
+}
+
+/**
+ * @brief Peak resident set size of the process so far, in KiB (0 if unknown)
+ */
+inline long peak_rss_kib() {
+    rusage usage{};
+    if (::getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024; // bytes on macOS, KiB elsewhere
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+/**
+ * @brief Restrict the calling thread, and the threads it starts later, to CPU @p cpu
+ *
+ * @throws std::runtime_error if the CPU cannot be used or pinning is not
+ *         supported on this platform
+ */
+inline void pin_to_cpu(unsigned cpu) {
+#ifdef __linux__
+    if (cpu >= CPU_SETSIZE) {
+        throw std::runtime_error("cannot pin to CPU " + std::to_string(cpu) + ": no such CPU");
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (::sched_setaffinity(0, sizeof(set), &set) != 0) {
+        throw std::runtime_error("cannot pin to CPU " + std::to_string(cpu) + ": " + std::strerror(errno));
+    }
+#else
+    throw std::runtime_error("pinning to a CPU is not supported on this platform");
+#endif
+}
+
+/**
+ * @brief Lock the pages mapped so far into RAM
+ *
+ * Only current mappings are locked: memory mapped later, e.g. by a solve,
+ * stays pageable until this is called again.
+ *
+ * @return false if the memory lock limit does not allow it
+ */
+inline bool lock_memory() { return ::mlockall(MCL_CURRENT) == 0; }
+
+/**
+ * @brief Keep memory, once faulted in, mapped for the rest of the process
+ *
+ * Large allocations are otherwise mapped and unmapped by every run that
+ * makes them, and freed heap is returned to the system, so each run pays
+ * the page faults again; with this, the pages a warm-up run touched are
+ * reused by the timed runs.  The current mappings are also locked into RAM
+ * where the memory lock limit allows (see lock_memory(), to be called again
+ * after the warm-up).
+ *
+ * @return false if the memory could not be locked (the rest still applies)
+ */
+inline bool prefault_memory() {
+#ifdef __GLIBC__
+    ::mallopt(M_MMAP_MAX, 0); // every allocation from the heap, none mapped on its own
+    ::mallopt(M_TRIM_THRESHOLD, -1);
+#endif
+    return lock_memory();
+}
+
+/**
+ * @brief Summary statistics of repeated time measurements
+ *
+ * The median of an even number of runs is the mean of the middle two; p95
+ * is the nearest-rank 95th percentile and stddev the sample standard
+ * deviation (0 for a single run).
+ */
+struct TimingSummary {
+    std::size_t runs = 0;
+    std::size_t warmup = 0;
+    double min = 0;
+    double median = 0;
+    double mean = 0;
+    double stddev = 0;
+    double p95 = 0;
+
+    static TimingSummary of(std::vector<double> times, std::size_t warmup = 0) {
+        TimingSummary summary;
+        summary.runs = times.size();
+        summary.warmup = warmup;
+        if (times.empty()) {
+            return summary;
+        }
+        std::sort(times.begin(), times.end());
+        const std::size_t n = times.size();
+        summary.min = times.front();
+        summary.median = n % 2 == 1 ? times[n / 2] : (times[n / 2 - 1] + times[n / 2]) / 2;
+        summary.mean = std::accumulate(times.begin(), times.end(), 0.0) / static_cast<double>(n);
+        if (n > 1) {
+            double squares = 0;
+            for (const double time : times) {
+                squares += (time - summary.mean) * (time - summary.mean);
+            }
+            summary.stddev = std::sqrt(squares / static_cast<double>(n - 1));
+        }
+        const auto rank = static_cast<std::size_t>(std::ceil(0.95 * static_cast<double>(n)));
+        summary.p95 = times[std::max<std::size_t>(rank, 1) - 1];
+        return summary;
+    }
+
+    void write_json(OutputSink &out) const {
+        out.write("{\"runs\": ").integer(runs).write(", \"warmup\": ").integer(warmup);
+        out.write(", \"min\": ").general(min).write(", \"median\": ").general(median);
+        out.write(", \"mean\": ").general(mean).write(", \"stddev\": ").general(stddev);
+        out.write(", \"p95\": ").general(p95).put('}');
+    }
+
+    void write_text(OutputSink &out, std::string_view unit) const {
+        out.write("Timed runs: ").integer(runs).write(" (after ").integer(warmup).write(" warm-up): min ");
+        out.general(min).write(", median ").general(median).write(", mean ").general(mean);
+        out.write(", stddev ").general(stddev).write(", p95 ").general(p95).put(' ').write(unit).put('\n');
+    }
+};
+
+/**
+ * @brief Wall-clock and CPU time of one phase of a run, in seconds
+ *
+ * CPU time is the whole process's, so a phase running on several threads
+ * takes more CPU than wall-clock time.
+ */
+struct PhaseTime {
+    std::string name;
+    double wall = 0;
+    double cpu = 0;
+};
+
+/**
+ * @brief Splits a run into consecutive phases and times each of them
+ *
+ * The first phase starts when the profiler is constructed; every mark()
+ * ends the current phase and starts the next.
+ */
+class PhaseProfiler {
+  public:
+    PhaseProfiler() : wall_(Clock::now()), cpu_(process_cpu_seconds()) {}
+
+    /**
+     * @brief End the current phase, calling it @p name, and start the next
+     */
+    void mark(std::string name) {
+        const auto wall = Clock::now();
+        const double cpu = process_cpu_seconds();
+        phases_.push_back({std::move(name), std::chrono::duration<double>(wall - wall_).count(), cpu - cpu_});
+        wall_ = wall;
+        cpu_ = cpu;
+    }
+
+    const std::vector<PhaseTime> &phases() const { return phases_; }
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    std::vector<PhaseTime> phases_;
+    Clock::time_point wall_;
+    double cpu_;
+};
+
+/**
+ * @brief Everything --profile reports about one solver run
+ *
+ * The JSON form is a record with the fields benchmark.sh writes (solver,
+ * game, status, time in seconds, vertices, edges), so arrays of them can be
+ * plotted with extra/scripts/plot_*.py, plus the phase breakdown, the peak
+ * resident set size and the solver's statistics.
+ */
+struct RunProfile {
+    std::string solver;
+    std::string game;
+    bool success = true;
+    std::optional<double> time; // seconds per solve; the solve phase's wall-clock time if unset
+    std::size_t vertices = 0;
+    std::size_t edges = 0;
+    std::vector<PhaseTime> phases;
+    long peak_rss_kib = 0;
+    std::map<std::string, std::string> statistics;
+
+    /**
+     * @brief Wall-clock seconds of the phase @p name (0 if there is none)
+     */
+    double wall(std::string_view name) const {
+        const auto phase = std::find_if(phases.begin(), phases.end(), [&](const PhaseTime &p) { return p.name == name; });
+        return phase == phases.end() ? 0 : phase->wall;
+    }
+
+    void write_json(OutputSink &out) const {
+        out.write("{\"solver\": ").json_string(solver);
+        out.write(", \"game\": ").json_string(game);
+        out.write(", \"status\": ").write(success ? "\"success\"" : "\"failed\"");
+        out.write(", \"time\": ").general(time ? *time : wall("solve"));
+        out.write(", \"vertices\": ").integer(vertices);
+        out.write(", \"edges\": ").integer(edges);
+        out.write(", \"peak_rss_kb\": ").integer(peak_rss_kib);
+        out.write(", \"phases\": {");
+        const char *separator = "";
+        for (const auto &phase : phases) {
+            out.write(separator).json_string(phase.name);
+            out.write(": {\"wall\": ").general(phase.wall).write(", \"cpu\": ").general(phase.cpu).put('}');
+            separator = ", ";
+        }
+        out.write("}, \"statistics\": {");
+        separator = "";
+        for (const auto &[key, value] : statistics) {
+            out.write(separator).json_string(key).write(": ").json_string(value);
+            separator = ", ";
+        }
+        out.write("}}");
+    }
+
+    void write_text(OutputSink &out) const {
+        out.write("Profile (").integer(vertices).write(" vertices, ").integer(edges).write(" edges):\n");
+        double wall_total = 0;
+        double cpu_total = 0;
+        for (const auto &phase : phases) {
+            out.write("  ").write(phase.name).write(": ").general(phase.wall * 1000).write(" ms wall, ");
+            out.general(phase.cpu * 1000).write(" ms cpu\n");
+            wall_total += phase.wall;
+            cpu_total += phase.cpu;
+        }
+        out.write("  total: ").general(wall_total * 1000).write(" ms wall, ").general(cpu_total * 1000).write(" ms cpu\n");
+        out.write("  peak RSS: ").integer(peak_rss_kib).write(" KiB\n");
+        for (const auto &[key, value] : statistics) {
+            out.write("  ").write(key).write(": ").write(value).put('\n');
+        }
+    }
+};
+
+} // namespace utils
+} // namespace ggg
@@ -0,0 +1,960 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ggg {
+namespace utils {
+
+/**
+ * @brief Sparse LU factorization of a simplex basis with product-form updates
+ *
+ * The basis matrix B (m x m, given column by column) is reduced to upper
+ * triangular form by Gaussian elimination with Markowitz pivot selection and
+ * threshold partial pivoting, so the sparsity of game constraint matrices is
+ * preserved.  Basis changes are applied as eta matrices (product form); the
+ * owner refactorizes once num_updates() grows too large.
+ *
+ * Vectors passed to ftran() are indexed by row of B and results by basis
+ * position (column of B); btran() works the other way around.
+ */
+class BasisFactor {
+  public:
+    struct Entry {
+        std::size_t index;
+        double value;
+    };
+
+    /**
+     * @brief Factorize the m x m matrix with the given columns
+     *
+     * @param columns Sparse column of every basis position
+     * @param dropped Receives the positions whose columns are (numerically)
+     *        linearly dependent on the others
+     * @param unpivoted Receives as many rows that were left without a pivot;
+     *        the basis is nonsingular iff both lists are empty
+     */
+    void factorize(const std::vector<std::vector<Entry>> &columns,
+                   std::vector<std::size_t> &dropped,
+                   std::vector<std::size_t> &unpivoted) {
+        const std::size_t m = columns.size();
+        clear(m);
+        dropped.clear();
+        unpivoted.clear();
+
+        std::vector<std::vector<Entry>> rows(m);
+        std::vector<std::vector<std::size_t>> column_rows(m);
+        std::vector<std::size_t> column_count(m, 0);
+        std::vector<bool> row_active(m, true);
+        std::vector<bool> column_active(m, true);
+        std::size_t active_nnz = 0;
+        std::size_t active_rows = m;
+        std::size_t active_columns = m;
+        for (std::size_t c = 0; c < m; ++c) {
+            for (const Entry &entry : columns[c]) {
+                rows[entry.index].push_back({c, entry.value});
+                column_rows[c].push_back(entry.index);
+            }
+            column_count[c] = columns[c].size();
+            active_nnz += columns[c].size();
+        }
+
+        // Columns bucketed by active count; stale bucket entries are skipped lazily.
+        std::vector<std::vector<std::size_t>> buckets(m + 1);
+        for (std::size_t c = 0; c < m; ++c) {
+            buckets[column_count[c]].push_back(c);
+        }
+        const auto find = [&](std::size_t row, std::size_t column) -> std::size_t {
+            for (std::size_t k = 0; k < rows[row].size(); ++k) {
+                if (rows[row][k].index == column) {
+                    return k;
+                }
+            }
+            return kNone;
+        };
+        const auto drop_column = [&](std::size_t column) {
+            column_active[column] = false;
+            --active_columns;
+            dropped.push_back(column);
+            for (const std::size_t row : column_rows[column]) {
+                if (!row_active[row]) {
+                    continue;
+                }
+                const std::size_t k = find(row, column);
+                if (k != kNone) {
+                    rows[row][k] = rows[row].back();
+                    rows[row].pop_back();
+                    --active_nnz;
+                }
+            }
+        };
+
+        std::vector<std::size_t> where(m, kNone);
+        for (std::size_t step = 0; step < m; ++step) {
+            if (active_columns >= kDenseMinimum && active_nnz >= kDenseDensity * active_rows * active_columns) {
+                factorize_dense(rows, row_active, column_active, dropped);
+                break;
+            }
+            // Markowitz search over the sparsest columns.
+            std::size_t best_row = kNone;
+            std::size_t best_column = kNone;
+            std::size_t best_cost = std::numeric_limits<std::size_t>::max();
+            double best_abs = 0.0;
+            std::size_t examined = 0;
+            for (std::size_t count = 0; count <= m && best_cost > 0; ++count) {
+                if (best_column != kNone && examined >= kSearchColumns) {
+                    break;
+                }
+                auto &bucket = buckets[count];
+                for (std::size_t b = 0; b < bucket.size() && best_cost > 0;) {
+                    const std::size_t c = bucket[b];
+                    if (!column_active[c] || column_count[c] != count) {
+                        bucket[b] = bucket.back();
+                        bucket.pop_back();
+                        continue;
+                    }
+                    double column_max = 0.0;
+                    for (const std::size_t row : column_rows[c]) {
+                        if (row_active[row]) {
+                            const std::size_t k = find(row, c);
+                            if (k != kNone) {
+                                column_max = std::max(column_max, std::abs(rows[row][k].value));
+                            }
+                        }
+                    }
+                    if (column_max < kSingularTolerance) {
+                        drop_column(c);
+                        bucket[b] = bucket.back();
+                        bucket.pop_back();
+                        continue;
+                    }
+                    for (const std::size_t row : column_rows[c]) {
+                        if (!row_active[row]) {
+                            continue;
+                        }
+                        const std::size_t k = find(row, c);
+                        if (k == kNone) {
+                            continue;
+                        }
+                        const double magnitude = std::abs(rows[row][k].value);
+                        if (magnitude < kThreshold * column_max) {
+                            continue;
+                        }
+                        const std::size_t cost = (rows[row].size() - 1) * (count - 1);
+                        if (cost < best_cost || (cost == best_cost && magnitude > best_abs)) {
+                            best_cost = cost;
+                            best_abs = magnitude;
+                            best_row = row;
+                            best_column = c;
+                        }
+                    }
+                    ++examined;
+                    ++b;
+                    if (examined >= kSearchColumns) {
+                        break;
+                    }
+                }
+            }
+            if (best_column == kNone) {
+                break;
+            }
+
+            // Eliminate the pivot column from the other active rows.
+            const std::size_t r = best_row;
+            const std::size_t c = best_column;
+            const std::vector<Entry> pivot_row = rows[r];
+            const double pivot = pivot_row[find(r, c)].value;
+            for (const std::size_t row : column_rows[c]) {
+                if (row == r || !row_active[row]) {
+                    continue;
+                }
+                auto &entries = rows[row];
+                const std::size_t k = find(row, c);
+                if (k == kNone) {
+                    continue;
+                }
+                const double multiplier = entries[k].value / pivot;
+                entries[k] = entries.back();
+                entries.pop_back();
+                --active_nnz;
+                for (std::size_t e = 0; e < entries.size(); ++e) {
+                    where[entries[e].index] = e;
+                }
+                for (const Entry &entry : pivot_row) {
+                    if (entry.index == c) {
+                        continue;
+                    }
+                    if (where[entry.index] != kNone) {
+                        entries[where[entry.index]].value -= multiplier * entry.value;
+                    } else {
+                        entries.push_back({entry.index, -multiplier * entry.value});
+                        ++active_nnz;
+                        column_rows[entry.index].push_back(row);
+                        buckets[++column_count[entry.index]].push_back(entry.index);
+                    }
+                }
+                for (const Entry &entry : entries) {
+                    where[entry.index] = kNone;
+                }
+                l_index_.push_back(row);
+                l_value_.push_back(multiplier);
+            }
+            l_start_.push_back(l_index_.size());
+
+            for (const Entry &entry : pivot_row) {
+                if (entry.index == c) {
+                    continue;
+                }
+                u_index_.push_back(entry.index);
+                u_value_.push_back(entry.value);
+                buckets[--column_count[entry.index]].push_back(entry.index);
+            }
+            u_start_.push_back(u_index_.size());
+            pivot_row_.push_back(r);
+            pivot_column_.push_back(c);
+            pivot_value_.push_back(pivot);
+            row_active[r] = false;
+            column_active[c] = false;
+            active_nnz -= pivot_row.size();
+            --active_rows;
+            --active_columns;
+        }
+
+        for (std::size_t c = 0; c < m; ++c) {
+            if (column_active[c]) {
+                dropped.push_back(c);
+            }
+        }
+        for (std::size_t row = 0; row < m; ++row) {
+            if (row_active[row]) {
+                unpivoted.push_back(row);
+            }
+        }
+    }
+
+    /**
+     * @brief Solve B y = a
+     * @param rhs a, indexed by row; overwritten
+     * @param result y, indexed by basis position
+     */
+    void ftran(std::vector<double> &rhs, std::vector<double> &result) const {
+        const std::size_t steps = pivot_row_.size();
+        for (std::size_t k = 0; k < steps; ++k) {
+            const double t = rhs[pivot_row_[k]];
+            if (t != 0.0) {
+                for (std::size_t e = l_start_[k]; e < l_start_[k + 1]; ++e) {
+                    rhs[l_index_[e]] -= l_value_[e] * t;
+                }
+            }
+        }
+        result.assign(size_, 0.0);
+        for (std::size_t k = steps; k-- > 0;) {
+            double s = rhs[pivot_row_[k]];
+            for (std::size_t e = u_start_[k]; e < u_start_[k + 1]; ++e) {
+                s -= u_value_[e] * result[u_index_[e]];
+            }
+            result[pivot_column_[k]] = s / pivot_value_[k];
+        }
+        for (std::size_t k = 0; k < eta_position_.size(); ++k) {
+            const std::size_t p = eta_position_[k];
+            const double yp = result[p] / eta_pivot_[k];
+            result[p] = yp;
+            if (yp != 0.0) {
+                for (std::size_t e = eta_start_[k]; e < eta_start_[k + 1]; ++e) {
+                    result[eta_index_[e]] -= eta_value_[e] * yp;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Solve B^T z = c
+     * @param rhs c, indexed by basis position; overwritten
+     * @param result z, indexed by row
+     */
+    void btran(std::vector<double> &rhs, std::vector<double> &result) const {
+        for (std::size_t k = eta_position_.size(); k-- > 0;) {
+            const std::size_t p = eta_position_[k];
+            double s = rhs[p];
+            for (std::size_t e = eta_start_[k]; e < eta_start_[k + 1]; ++e) {
+                s -= eta_value_[e] * rhs[eta_index_[e]];
+            }
+            rhs[p] = s / eta_pivot_[k];
+        }
+        const std::size_t steps = pivot_row_.size();
+        result.assign(size_, 0.0);
+        for (std::size_t k = 0; k < steps; ++k) {
+            const double w = rhs[pivot_column_[k]] / pivot_value_[k];
+            result[pivot_row_[k]] = w;
+            if (w != 0.0) {
+                for (std::size_t e = u_start_[k]; e < u_start_[k + 1]; ++e) {
+                    rhs[u_index_[e]] -= u_value_[e] * w;
+                }
+            }
+        }
+        for (std::size_t k = steps; k-- > 0;) {
+            double s = 0.0;
+            for (std::size_t e = l_start_[k]; e < l_start_[k + 1]; ++e) {
+                s += l_value_[e] * result[l_index_[e]];
+            }
+            result[pivot_row_[k]] -= s;
+        }
+    }
+
+    /**
+     * @brief Replace the column at @p position by the column whose ftran is @p alpha
+     */
+    void update(std::size_t position, const std::vector<double> &alpha) {
+        eta_position_.push_back(position);
+        eta_pivot_.push_back(alpha[position]);
+        for (std::size_t i = 0; i < alpha.size(); ++i) {
+            if (i != position && alpha[i] != 0.0) {
+                eta_index_.push_back(i);
+                eta_value_.push_back(alpha[i]);
+            }
+        }
+        eta_start_.push_back(eta_index_.size());
+    }
+
+    std::size_t num_updates() const { return eta_position_.size(); }
+
+    /**
+     * @brief Whether solving with the updates costs more than refactorizing would
+     */
+    bool updates_outweigh_factors() const {
+        return eta_index_.size() > l_index_.size() + u_index_.size() + size_;
+    }
+
+  private:
+    static constexpr std::size_t kNone = std::numeric_limits<std::size_t>::max();
+    // Pivot candidates must reach this fraction of their column's largest entry.
+    static constexpr double kThreshold = 0.1;
+    static constexpr double kSingularTolerance = 1e-11;
+    // Columns examined per Markowitz search once a candidate is known.
+    static constexpr std::size_t kSearchColumns = 4;
+    // The remaining submatrix is eliminated densely once it is at least this
+    // large and this full; random game graphs fill in quickly.
+    static constexpr std::size_t kDenseMinimum = 32;
+    static constexpr double kDenseDensity = 0.25;
+
+    // Gaussian elimination with partial pivoting of the active submatrix,
+    // recorded in the same L/U format as the sparse steps.
+    void factorize_dense(const std::vector<std::vector<Entry>> &rows,
+                         std::vector<bool> &row_active,
+                         std::vector<bool> &column_active,
+                         std::vector<std::size_t> &dropped) {
+        std::vector<std::size_t> row_ids;
+        std::vector<std::size_t> column_ids;
+        std::vector<std::size_t> slot(column_active.size(), kNone);
+        for (std::size_t row = 0; row < row_active.size(); ++row) {
+            if (row_active[row]) {
+                row_ids.push_back(row);
+            }
+        }
+        for (std::size_t c = 0; c < column_active.size(); ++c) {
+            if (column_active[c]) {
+                slot[c] = column_ids.size();
+                column_ids.push_back(c);
+            }
+        }
+        const std::size_t num_rows = row_ids.size();
+        const std::size_t num_columns = column_ids.size();
+        std::vector<double> dense(num_rows * num_columns, 0.0);
+        for (std::size_t i = 0; i < num_rows; ++i) {
+            for (const Entry &entry : rows[row_ids[i]]) {
+                if (slot[entry.index] != kNone) {
+                    dense[i * num_columns + slot[entry.index]] = entry.value;
+                }
+            }
+        }
+
+        std::vector<bool> used(num_rows, false);
+        for (std::size_t k = 0; k < num_columns; ++k) {
+            std::size_t best = kNone;
+            double best_abs = kSingularTolerance;
+            for (std::size_t i = 0; i < num_rows; ++i) {
+                if (!used[i] && std::abs(dense[i * num_columns + k]) >= best_abs) {
+                    best_abs = std::abs(dense[i * num_columns + k]);
+                    best = i;
+                }
+            }
+            column_active[column_ids[k]] = false;
+            if (best == kNone) {
+                dropped.push_back(column_ids[k]);
+                continue;
+            }
+            used[best] = true;
+            const double *pivot_row = &dense[best * num_columns];
+            const double pivot = pivot_row[k];
+            for (std::size_t i = 0; i < num_rows; ++i) {
+                double *row = &dense[i * num_columns];
+                if (used[i] || row[k] == 0.0) {
+                    continue;
+                }
+                const double multiplier = row[k] / pivot;
+                for (std::size_t j = k + 1; j < num_columns; ++j) {
+                    row[j] -= multiplier * pivot_row[j];
+                }
+                l_index_.push_back(row_ids[i]);
+                l_value_.push_back(multiplier);
+            }
+            l_start_.push_back(l_index_.size());
+            for (std::size_t j = k + 1; j < num_columns; ++j) {
+                if (pivot_row[j] != 0.0) {
+                    u_index_.push_back(column_ids[j]);
+                    u_value_.push_back(pivot_row[j]);
+                }
+            }
+            u_start_.push_back(u_index_.size());
+            pivot_row_.push_back(row_ids[best]);
+            pivot_column_.push_back(column_ids[k]);
+            pivot_value_.push_back(pivot);
+            row_active[row_ids[best]] = false;
+        }
+    }
+
+    void clear(std::size_t size) {
+        size_ = size;
+        pivot_row_.clear();
+        pivot_column_.clear();
+        pivot_value_.clear();
+        l_start_.assign(1, 0);
+        l_index_.clear();
+        l_value_.clear();
+        u_start_.assign(1, 0);
+        u_index_.clear();
+        u_value_.clear();
+        eta_position_.clear();
+        eta_pivot_.clear();
+        eta_start_.assign(1, 0);
+        eta_index_.clear();
+        eta_value_.clear();
+    }
+
+    std::size_t size_ = 0;
+    std::vector<std::size_t> pivot_row_;
+    std::vector<std::size_t> pivot_column_;
+    std::vector<double> pivot_value_;
+    std::vector<std::size_t> l_start_{0};
+    std::vector<std::size_t> l_index_;
+    std::vector<double> l_value_;
+    std::vector<std::size_t> u_start_{0};
+    std::vector<std::size_t> u_index_;
+    std::vector<double> u_value_;
+    std::vector<std::size_t> eta_position_;
+    std::vector<double> eta_pivot_;
+    std::vector<std::size_t> eta_start_{0};
+    std::vector<std::size_t> eta_index_;
+    std::vector<double> eta_value_;
+};
+
+/**
+ * @brief Outcome of RevisedSimplex::solve()
+ */
+enum class LPStatus { Optimal, Infeasible, Unbounded };
+
+/**
+ * @brief Sparse bounded-variable revised simplex
+ *
+ * Maximises c·x subject to lower_i <= a_i·x <= upper_i for every row and
+ * bounds on every column; any bound may be infinite.  Each row i carries a
+ * logical variable s_i = a_i·x, so the basis always has one column per row
+ * and starts out as the logicals.  Phase one minimises the sum of bound
+ * violations of the basic variables, phase two the objective, both with
+ * Dantzig pricing, falling back to Bland's rule on long degenerate runs.
+ *
+ * The basis survives changes to the rows, bounds and objective, so a
+ * following solve() starts from the previous optimum: an objective change
+ * only needs phase two pivots, and a few changed rows only a short repair
+ * (a basis that became singular is patched with logicals).
+ */
+class RevisedSimplex {
+  public:
+    using Entry = BasisFactor::Entry;
+    static constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+    /**
+     * @param num_columns Number of structural variables; all start free with cost 0
+     */
+    explicit RevisedSimplex(std::size_t num_columns)
+        : n_(num_columns),
+          cost_(num_columns, 0.0),
+          lower_(num_columns, -kInfinity),
+          upper_(num_columns, kInfinity),
+          state_(num_columns, State::Zero),
+          x_(num_columns, 0.0) {}
+
+    /**
+     * @brief Append the row lower <= Σ entries <= upper
+     * @return Row index
+     */
+    std::size_t add_row(const std::vector<Entry> &entries, double lower, double upper) {
+        const std::size_t row = rows_.size();
+        rows_.push_back(entries);
+        lower_.push_back(bound(lower));
+        upper_.push_back(bound(upper));
+        state_.push_back(State::Basic);
+        x_.push_back(0.0);
+        basis_.push_back(n_ + row);
+        columns_dirty_ = true;
+        factor_dirty_ = true;
+        return row;
+    }
+
+    /**
+     * @brief Replace the coefficients and bounds of an existing row
+     */
+    void set_row(std::size_t row, const std::vector<Entry> &entries, double lower, double upper) {
+        rows_[row] = entries;
+        set_row_bounds(row, lower, upper);
+        columns_dirty_ = true;
+        factor_dirty_ = true;
+    }
+
+    void set_row_bounds(std::size_t row, double lower, double upper) {
+        lower_[n_ + row] = bound(lower);
+        upper_[n_ + row] = bound(upper);
+        primal_dirty_ = true;
+    }
+
+    void set_column_bounds(std::size_t column, double lower, double upper) {
+        lower_[column] = bound(lower);
+        upper_[column] = bound(upper);
+        primal_dirty_ = true;
+    }
+
+    /**
+     * @brief Set the objective to maximise (one coefficient per column)
+     */
+    void set_objective(const std::vector<double> &objective) {
+        std::copy(objective.begin(), objective.end(), cost_.begin());
+    }
+
+    /**
+     * @brief Perform one pivot or bound flip
+     * @return false once status() is final for the current data
+     */
+    bool iterate() {
+        prepare();
+        for (;;) {
+            const bool phase_one = compute_duals();
+            std::size_t entering = kNone;
+            double direction = 0.0;
+            price(entering, direction);
+            if (entering != kNone) {
+                return pivot(entering, direction, phase_one);
+            }
+            if (factor_.num_updates() > 0) {
+                // Confirm on a fresh factorization before reporting.
+                refactor();
+                compute_primal();
+                continue;
+            }
+            status_ = phase_one ? LPStatus::Infeasible : LPStatus::Optimal;
+            return false;
+        }
+    }
+
+    /**
+     * @brief Iterate to optimality, starting from the current basis
+     */
+    LPStatus solve() {
+        const std::size_t limit = iterations_ + 50 * (n_ + rows_.size()) + 1000;
+        while (iterate()) {
+            if (iterations_ > limit) {
+                throw std::runtime_error("revised simplex exceeded its iteration limit");
+            }
+        }
+        return status_;
+    }
+
+    LPStatus status() const { return status_; }
+
+    /**
+     * @brief Whether the basic solution violates a bound
+     */
+    bool is_infeasible() {
+        prepare();
+        return infeasibility() > kPrimalTolerance;
+    }
+
+    double value(std::size_t column) const { return x_[column]; }
+
+    std::vector<double> values() const { return std::vector<double>(x_.begin(), x_.begin() + n_); }
+
+    double row_activity(std::size_t row) const { return x_[n_ + row]; }
+
+    double objective() const {
+        double result = 0.0;
+        for (std::size_t j = 0; j < n_; ++j) {
+            result += cost_[j] * x_[j];
+        }
+        return result;
+    }
+
+    std::size_t num_rows() const { return rows_.size(); }
+    std::size_t num_columns() const { return n_; }
+
+    /**
+     * @brief Pivots and bound flips performed so far
+     */
+    std::size_t iterations() const { return iterations_; }
+
+  private:
+    enum class State : std::uint8_t { Basic, Lower, Upper, Zero };
+
+    static constexpr std::size_t kNone = std::numeric_limits<std::size_t>::max();
+    static constexpr double kPrimalTolerance = 1e-9;
+    static constexpr double kDualTolerance = 1e-9;
+    static constexpr double kPivotTolerance = 1e-9;
+    // Ratio test limits this close are ties, broken by pivot size.
+    static constexpr double kTieTolerance = 1e-12;
+    static constexpr double kHuge = 1e30;
+    // Eta updates between refactorizations: at least the minimum, then until
+    // the eta file outweighs the factors, but never more than the maximum.
+    static constexpr std::size_t kRefactorMinimum = 50;
+    static constexpr std::size_t kRefactorMaximum = 500;
+    // Consecutive degenerate pivots before switching to Bland's rule.
+    static constexpr std::size_t kDegenerateLimit = 50;
+
+    static double bound(double value) {
+        if (value >= kHuge) {
+            return kInfinity;
+        }
+        if (value <= -kHuge) {
+            return -kInfinity;
+        }
+        return value;
+    }
+
+    std::size_t n_;
+    std::vector<std::vector<Entry>> rows_;
+    std::vector<double> cost_;
+    std::vector<double> lower_;
+    std::vector<double> upper_;
+    std::vector<State> state_;
+    std::vector<double> x_;
+    std::vector<std::size_t> basis_;
+    BasisFactor factor_;
+    std::vector<std::size_t> column_start_;
+    std::vector<Entry> column_entries_;
+    bool columns_dirty_ = true;
+    bool factor_dirty_ = true;
+    bool primal_dirty_ = true;
+    LPStatus status_ = LPStatus::Optimal;
+    std::size_t iterations_ = 0;
+    std::size_t degenerate_ = 0;
+    std::vector<double> work_;
+    std::vector<double> pi_;
+    std::vector<double> reduced_;
+    std::vector<double> alpha_;
+
+    std::size_t num_variables() const { return x_.size(); }
+
+    void prepare() {
+        if (columns_dirty_) {
+            build_columns();
+        }
+        if (factor_dirty_) {
+            refactor();
+            primal_dirty_ = true;
+        }
+        if (primal_dirty_) {
+            compute_primal();
+        }
+    }
+
+    void build_columns() {
+        column_start_.assign(n_ + 1, 0);
+        for (const auto &row : rows_) {
+            for (const Entry &entry : row) {
+                ++column_start_[entry.index + 1];
+            }
+        }
+        for (std::size_t j = 0; j < n_; ++j) {
+            column_start_[j + 1] += column_start_[j];
+        }
+        column_entries_.resize(column_start_[n_]);
+        std::vector<std::size_t> next(column_start_.begin(), column_start_.end() - 1);
+        for (std::size_t i = 0; i < rows_.size(); ++i) {
+            for (const Entry &entry : rows_[i]) {
+                column_entries_[next[entry.index]++] = {i, entry.value};
+            }
+        }
+        columns_dirty_ = false;
+    }
+
+    // Sparse column of variable j in [A | -I].
+    void column(std::size_t j, std::vector<Entry> &out) const {
+        out.clear();
+        if (j < n_) {
+            out.assign(column_entries_.begin() + column_start_[j], column_entries_.begin() + column_start_[j + 1]);
+        } else {
+            out.push_back({j - n_, -1.0});
+        }
+    }
+
+    // Move nonbasic variables onto a bound valid for their current bounds.
+    void place_nonbasic(std::size_t j) {
+        if (state_[j] == State::Upper && std::isfinite(upper_[j])) {
+            x_[j] = upper_[j];
+        } else if (std::isfinite(lower_[j])) {
+            state_[j] = State::Lower;
+            x_[j] = lower_[j];
+        } else if (std::isfinite(upper_[j])) {
+            state_[j] = State::Upper;
+            x_[j] = upper_[j];
+        } else {
+            state_[j] = State::Zero;
+            x_[j] = 0.0;
+        }
+    }
+
+    void refactor() {
+        const std::size_t m = rows_.size();
+        std::vector<std::vector<Entry>> columns(m);
+        std::vector<std::size_t> dropped;
+        std::vector<std::size_t> unpivoted;
+        for (;;) {
+            for (std::size_t p = 0; p < m; ++p) {
+                column(basis_[p], columns[p]);
+            }
+            factor_.factorize(columns, dropped, unpivoted);
+            if (dropped.empty()) {
+                break;
+            }
+            // Replace dependent columns by the logicals of the uncovered rows.
+            for (std::size_t k = 0; k < dropped.size(); ++k) {
+                const std::size_t leaving = basis_[dropped[k]];
+                state_[leaving] = State::Lower;
+                place_nonbasic(leaving);
+                basis_[dropped[k]] = n_ + unpivoted[k];
+                state_[n_ + unpivoted[k]] = State::Basic;
+            }
+        }
+        factor_dirty_ = false;
+    }
+
+    void compute_primal() {
+        const std::size_t m = rows_.size();
+        work_.assign(m, 0.0);
+        for (std::size_t j = 0; j < num_variables(); ++j) {
+            if (state_[j] == State::Basic) {
+                continue;
+            }
+            place_nonbasic(j);
+            if (x_[j] == 0.0) {
+                continue;
+            }
+            if (j < n_) {
+                for (std::size_t e = column_start_[j]; e < column_start_[j + 1]; ++e) {
+                    work_[column_entries_[e].index] -= column_entries_[e].value * x_[j];
+                }
+            } else {
+                work_[j - n_] += x_[j];
+            }
+        }
+        factor_.ftran(work_, alpha_);
+        for (std::size_t p = 0; p < m; ++p) {
+            x_[basis_[p]] = alpha_[p];
+        }
+        primal_dirty_ = false;
+    }
+
+    double infeasibility() const {
+        double total = 0.0;
+        for (const std::size_t j : basis_) {
+            total += std::max(0.0, lower_[j] - x_[j]) + std::max(0.0, x_[j] - upper_[j]);
+        }
+        return total;
+    }
+
+    // Compute simplex multipliers and reduced costs of the current phase
+    // (minimisation form).  Returns whether this is phase one.
+    bool compute_duals() {
+        const std::size_t m = rows_.size();
+        bool phase_one = false;
+        work_.assign(m, 0.0);
+        for (std::size_t p = 0; p < m; ++p) {
+            const std::size_t j = basis_[p];
+            if (x_[j] < lower_[j] - kPrimalTolerance) {
+                work_[p] = -1.0;
+                phase_one = true;
+            } else if (x_[j] > upper_[j] + kPrimalTolerance) {
+                work_[p] = 1.0;
+                phase_one = true;
+            }
+        }
+        if (!phase_one) {
+            for (std::size_t p = 0; p < m; ++p) {
+                work_[p] = basis_[p] < n_ ? -cost_[basis_[p]] : 0.0;
+            }
+        }
+        factor_.btran(work_, pi_);
+
+        reduced_.assign(num_variables(), 0.0);
+        for (std::size_t j = 0; j < n_; ++j) {
+            reduced_[j] = phase_one ? 0.0 : -cost_[j];
+        }
+        for (std::size_t i = 0; i < m; ++i) {
+            const double y = pi_[i];
+            reduced_[n_ + i] = y;
+            if (y != 0.0) {
+                for (const Entry &entry : rows_[i]) {
+                    reduced_[entry.index] -= y * entry.value;
+                }
+            }
+        }
+        return phase_one;
+    }
+
+    void price(std::size_t &entering, double &direction) const {
+        const bool bland = degenerate_ >= kDegenerateLimit;
+        double best = kDualTolerance;
+        for (std::size_t j = 0; j < num_variables(); ++j) {
+            if (state_[j] == State::Basic || lower_[j] == upper_[j]) {
+                continue;
+            }
+            const double d = reduced_[j];
+            double gain = 0.0;
+            double dir = 0.0;
+            if (d < -kDualTolerance && state_[j] != State::Upper && x_[j] < upper_[j]) {
+                gain = -d;
+                dir = 1.0;
+            } else if (d > kDualTolerance && state_[j] != State::Lower && x_[j] > lower_[j]) {
+                gain = d;
+                dir = -1.0;
+            } else {
+                continue;
+            }
+            if (bland) {
+                entering = j;
+                direction = dir;
+                return;
+            }
+            if (gain > best) {
+                best = gain;
+                entering = j;
+                direction = dir;
+            }
+        }
+    }
+
+    bool pivot(std::size_t entering, double direction, bool phase_one) {
+        const std::size_t m = rows_.size();
+        std::vector<Entry> entering_column;
+        column(entering, entering_column);
+        work_.assign(m, 0.0);
+        for (const Entry &entry : entering_column) {
+            work_[entry.index] = entry.value;
+        }
+        factor_.ftran(work_, alpha_);
+
+        // Ratio test: basic variables move by -direction * t * alpha.
+        const bool bland = degenerate_ >= kDegenerateLimit;
+        double step = kInfinity;
+        if (std::isfinite(lower_[entering]) && std::isfinite(upper_[entering])) {
+            step = upper_[entering] - lower_[entering];
+        }
+        std::size_t leaving = kNone;
+        double leaving_bound = 0.0;
+        double leaving_alpha = 0.0;
+        for (std::size_t p = 0; p < m; ++p) {
+            const double a = alpha_[p];
+            if (std::abs(a) <= kPivotTolerance) {
+                continue;
+            }
+            const std::size_t j = basis_[p];
+            const double rate = -direction * a;
+            const double x = x_[j];
+            double target;
+            if (rate > 0.0) {
+                if (x < lower_[j] - kPrimalTolerance) {
+                    target = lower_[j];
+                } else if (x <= upper_[j] + kPrimalTolerance && std::isfinite(upper_[j])) {
+                    target = upper_[j];
+                } else {
+                    continue;
+                }
+            } else {
+                if (x > upper_[j] + kPrimalTolerance) {
+                    target = upper_[j];
+                } else if (x >= lower_[j] - kPrimalTolerance && std::isfinite(lower_[j])) {
+                    target = lower_[j];
+                } else {
+                    continue;
+                }
+            }
+            const double limit = std::max(0.0, (target - x) / rate);
+            bool take = limit < step - kTieTolerance;
+            if (!take && limit <= step + kTieTolerance) {
+                if (leaving == kNone) {
+                    take = true;
+                } else if (bland) {
+                    take = j < basis_[leaving];
+                } else {
+                    take = std::abs(a) > std::abs(leaving_alpha);
+                }
+            }
+            if (take) {
+                step = std::min(step, limit);
+                leaving = p;
+                leaving_bound = target;
+                leaving_alpha = a;
+            }
+        }
+
+        if (!std::isfinite(step)) {
+            if (phase_one) {
+                throw std::runtime_error("revised simplex: unbounded phase one ray");
+            }
+            status_ = LPStatus::Unbounded;
+            return false;
+        }
+
+        ++iterations_;
+        degenerate_ = step == 0.0 ? degenerate_ + 1 : 0;
+        x_[entering] += direction * step;
+        for (std::size_t p = 0; p < m; ++p) {
+            if (alpha_[p] != 0.0) {
+                x_[basis_[p]] -= direction * step * alpha_[p];
+            }
+        }
+
+        if (leaving == kNone) {
+            // Bound flip of the entering variable.
+            if (direction > 0.0) {
+                state_[entering] = State::Upper;
+                x_[entering] = upper_[entering];
+            } else {
+                state_[entering] = State::Lower;
+                x_[entering] = lower_[entering];
+            }
+            return true;
+        }
+
+        const std::size_t left = basis_[leaving];
+        x_[left] = leaving_bound;
+        state_[left] = leaving_bound == upper_[left] ? State::Upper : State::Lower;
+        state_[entering] = State::Basic;
+        basis_[leaving] = entering;
+        const std::size_t updates = factor_.num_updates();
+        if ((updates >= kRefactorMinimum && factor_.updates_outweigh_factors()) || updates >= kRefactorMaximum ||
+            std::abs(leaving_alpha) < 1e-7) {
+            refactor();
+            compute_primal();
+        } else {
+            factor_.update(leaving, alpha_);
+        }
+        return true;
+    }
+};
+
+} // namespace utils
+} // namespace ggg
@@ -2,16 +2,32 @@
 
 #include "libggg/graphs/graph_utilities.hpp"
 #include "libggg/graphs/validator.hpp"
+#include "libggg/solutions/binary_solution.hpp"
 #include "libggg/solutions/concepts.hpp"
+#include "libggg/solutions/verification.hpp"
 #include "libggg/solvers/solver.hpp"
 #include "libggg/utils/logging.hpp"
+#include "libggg/utils/output_sink.hpp"
+#include "libggg/utils/parallel.hpp"
+#include "libggg/utils/profile.hpp"
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/program_options.hpp>
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <concepts>
+#include <cstddef>
+#include <filesystem>
+#include <glob.h>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 namespace ggg {
@@ -29,16 +45,40 @@ concept HasStatistics = requires(const SolutionType &solution) {
     { solution.get_statistics() } -> std::convertible_to<std::map<std::string, std::string>>;
 };
 
+// C++20 concept to detect solutions that write themselves into an OutputSink
+template <typename SolutionType>
+concept HasSinkOutput = requires(const SolutionType &solution, OutputSink &out) {
+    solution.write_json(out);
+    solution.write_text(out);
+};
+
+// C++20 concept to detect solvers that declare their own command line options:
+// `add_options` registers them and the solver is then constructed from the
+// parsed variables map.
+template <typename SolverType>
+concept HasSolverOptions = requires(boost::program_options::options_description &desc,
+                                    const boost::program_options::variables_map &vm) {
+    SolverType::add_options(desc);
+    SolverType(vm);
+};
+
 /**
  * @brief Generic wrapper for game solvers
  * @tparam GraphType The graph type (ParityGraph, MeanPayoffGraph)
  * @tparam SolverType The solver class for the graph type
  * @tparam ParserFunc The parser function type
  * @tparam ValidatorFunc The validator function type
+ * @tparam VerifierFunc Certificate checker type, called as
+ *         `verifier(graph, solution)` returning solutions::Verification;
+ *         std::nullptr_t (the default) if the game has none, which leaves
+ *         out the --verify option
  */
-template <typename GraphType, typename SolverType, typename ParserFunc, typename ValidatorFunc>
+template <typename GraphType, typename SolverType, typename ParserFunc, typename ValidatorFunc,
+          typename VerifierFunc = std::nullptr_t>
 class GameSolverWrapper {
   private:
+    static constexpr bool has_verifier = !std::is_same_v<VerifierFunc, std::nullptr_t>;
+
     struct ParseResult {
         boost::program_options::variables_map vm;
         std::string input; // first positional token; "-" means stdin
@@ -49,10 +89,33 @@ class GameSolverWrapper {
     static ParseResult parse_command_line(int argc, char *argv[]) {
         boost::program_options::options_description desc("Solver Options");
         desc.add_options()("help,h", "Show help message");
-        // Output format flag: plain (default) or json
-        desc.add_options()("format,f", boost::program_options::value<std::string>()->default_value("plain"), "Output format: plain | json (default: plain)");
+        // Output format flag: plain (default), json or binary
+        desc.add_options()("format,f", boost::program_options::value<std::string>()->default_value("plain"),
+                           "Output format: plain | json | binary (default: plain)");
         desc.add_options()("time-only,t", "Only output time to solve (in milliseconds)");
+        desc.add_options()("flush-every", boost::program_options::value<std::size_t>()->default_value(0),
+                           "Flush the output after every this many bytes of the solution (0: once at the end)");
         desc.add_options()("solver-name", "Output solver name");
+        desc.add_options()("profile", "Report wall and CPU time of parsing, validation, solving and output, peak memory "
+                                      "and solver statistics");
+        if constexpr (has_verifier) {
+            desc.add_options()("verify", "Check the solution's strategies certify its winning regions (exit code 4 if not)");
+        }
+        desc.add_options()("repeat", boost::program_options::value<std::size_t>(),
+                           "Solve the game this many times, each with a new solver, and report time statistics");
+        desc.add_options()("warmup", boost::program_options::value<std::size_t>()->default_value(0),
+                           "Untimed solves before the timed ones");
+        desc.add_options()("pin-cpu", boost::program_options::value<unsigned>(), "Run on this CPU only");
+        desc.add_options()("prefault", "Keep memory faulted in by earlier solves mapped (and locked) for later ones");
+        desc.add_options()("batch", "Solve every game of <input>: a directory (its .dot and .gv files), a glob "
+                                    "pattern, or - for a list of paths on stdin; writes one JSON line per game");
+        desc.add_options()("jobs,j", boost::program_options::value<unsigned>()->default_value(0),
+                           "Games solved at once with --batch (0: GGG_THREADS or the hardware concurrency)");
+        desc.add_options()("timeout", boost::program_options::value<std::size_t>()->default_value(0),
+                           "Time limit per game in milliseconds with --batch (0: none)");
+        if constexpr (HasSolverOptions<SolverType>) {
+            SolverType::add_options(desc);
+        }
         // Do not declare a named --input; we'll treat the first non-option token as input.
 
 #ifdef ENABLE_LOGGING
@@ -195,8 +258,231 @@ class GameSolverWrapper {
         }
     }
 
+    static SolverType make_solver(const boost::program_options::variables_map &vm) {
+        if constexpr (HasSolverOptions<SolverType>) {
+            return SolverType(vm);
+        } else {
+            return SolverType();
+        }
+    }
+
+    /**
+     * @brief Write the members of a solution's JSON object, without the braces
+     */
+    template <typename SolutionType>
+    static void write_json_members(OutputSink &out, double time_to_solve, const std::optional<TimingSummary> &repeat,
+                                   const std::optional<solutions::Verification> &verification,
+                                   const SolutionType *solution) {
+        out.write("\"time\": ").general(time_to_solve);
+        if (repeat) {
+            out.write(", \"repeat\": ");
+            repeat->write_json(out);
+        }
+        if (verification) {
+            out.write(", \"verified\": ").write(verification->valid ? "true" : "false");
+            if (!verification->valid) {
+                out.write(", \"verification_error\": ");
+                out.json_string(verification->reason);
+            }
+        }
+        if (solution) {
+            out.write(", \"solution\": ");
+            if constexpr (HasSinkOutput<SolutionType>) {
+                solution->write_json(out);
+            } else {
+                out.write(solution->to_json());
+            }
+        }
+    }
+
+    /**
+     * @brief The --profile record of a run timed by @p profiler
+     *
+     * Solver and game are named as benchmark.sh names them: by the
+     * executable and the input file, without directories and extension.
+     */
+    template <typename SolutionType>
+    static RunProfile make_profile(const PhaseProfiler &profiler, const std::string &program, const std::string &input,
+                                   const GraphType &graph, const SolutionType &solution, bool success) {
+        RunProfile profile;
+        profile.solver = std::filesystem::path(program).filename().string();
+        profile.game = input == "-" ? "stdin" : std::filesystem::path(input).stem().string();
+        profile.success = success;
+        profile.vertices = boost::num_vertices(graph);
+        profile.edges = boost::num_edges(graph);
+        profile.phases = profiler.phases();
+        profile.peak_rss_kib = peak_rss_kib();
+        if constexpr (HasStatistics<SolutionType>) {
+            profile.statistics = solution.get_statistics();
+        }
+        return profile;
+    }
+
+    /**
+     * @brief Game files named by a --batch input, in the order they are solved
+     *
+     * A directory gives its .dot and .gv files, sorted; "-" reads one path
+     * per line from stdin; anything else is expanded as a glob pattern.
+     */
+    static std::vector<std::string> batch_inputs(const std::string &input) {
+        std::vector<std::string> paths;
+        if (input == "-") {
+            for (std::string line; std::getline(std::cin, line);) {
+                if (!line.empty() && line.back() == '\r') {
+                    line.pop_back();
+                }
+                if (!line.empty()) {
+                    paths.push_back(std::move(line));
+                }
+            }
+        } else if (std::filesystem::is_directory(input)) {
+            for (const auto &entry : std::filesystem::directory_iterator(input)) {
+                const auto extension = entry.path().extension();
+                if (entry.is_regular_file() && (extension == ".dot" || extension == ".gv")) {
+                    paths.push_back(entry.path().string());
+                }
+            }
+            std::sort(paths.begin(), paths.end());
+        } else {
+            glob_t matches;
+            const int status = ::glob(input.c_str(), 0, nullptr, &matches);
+            if (status == 0) {
+                paths.assign(matches.gl_pathv, matches.gl_pathv + matches.gl_pathc);
+            }
+            ::globfree(&matches);
+            if (status != 0 && status != GLOB_NOMATCH) {
+                throw std::runtime_error("cannot expand '" + input + "'");
+            }
+        }
+        return paths;
+    }
+
+    /**
+     * @brief Solve one game of a batch into its JSON line
+     *
+     * Failures are reported in the line rather than thrown; a run cancelled
+     * through @p token is reported as a timeout.
+     */
+    static std::string solve_batch_game(const boost::program_options::variables_map &vm, const std::string &program,
+                                        const std::string &path,
+                                        const solvers::CancellationToken &token, ParserFunc &parser_func,
+                                        ValidatorFunc &validator_func, VerifierFunc &verifier_func, bool &ok) {
+        std::ostringstream line;
+        OutputSink out(line);
+        out.write("{\"file\": ");
+        out.json_string(path);
+        const auto start = std::chrono::steady_clock::now();
+        const auto elapsed = [&start] {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        };
+        ok = false;
+        try {
+            const solvers::CancellationScope scope(token);
+            PhaseProfiler profiler;
+            std::shared_ptr<GraphType> graph = parser_func(path);
+            const double parse_time = elapsed();
+            profiler.mark("parse");
+            validator_func(*graph);
+            SolverType solver = make_solver(vm);
+            profiler.mark("validate");
+            const auto solve_start = std::chrono::steady_clock::now();
+            auto solution = solver.solve(*graph);
+            const double time_to_solve =
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - solve_start).count();
+            profiler.mark("solve");
+
+            std::optional<solutions::Verification> verification;
+            if constexpr (has_verifier) {
+                if (vm.count("verify")) {
+                    verification = verifier_func(*graph, solution);
+                    profiler.mark("verify");
+                }
+            }
+            ok = !verification || verification->valid;
+            out.write(", \"parse_time\": ").general(parse_time).write(", ");
+            write_json_members(out, time_to_solve, std::nullopt, verification, vm.count("time-only") ? nullptr : &solution);
+            if (vm.count("profile")) {
+                out.write(", \"profile\": ");
+                make_profile(profiler, program, path, *graph, solution, ok).write_json(out);
+            }
+        } catch (const solvers::Cancelled &) {
+            out.write(", \"timeout\": true, \"time\": ").general(elapsed());
+        } catch (const ggg::graphs::ParseError &e) {
+            out.write(", \"error\": ");
+            out.json_string(std::string("Parse error: ") + e.what());
+        } catch (const ggg::graphs::GraphValidationError &e) {
+            out.write(", \"error\": ");
+            out.json_string(std::string("Validation Error: ") + e.what());
+        } catch (const std::exception &e) {
+            out.write(", \"error\": ");
+            out.json_string(std::string("Error: ") + e.what());
+        }
+        out.write("}\n");
+        out.flush();
+        return std::move(line).str();
+    }
+
+    /**
+     * @brief --batch: solve many games on a pool of workers
+     *
+     * Every game gets its own parse, validation and solver instance.  Lines
+     * are written in input order as soon as all earlier games are done, so
+     * a slow game holds back the lines after it but not the work on them.
+     * The --timeout deadline starts when a worker picks the game up and is
+     * enforced cooperatively (see solvers::CancellationToken).
+     *
+     * @return 0 if every game was solved (and verified), 1 otherwise
+     */
+    static int run_batch(const boost::program_options::variables_map &vm, const std::string &program, const std::string &input,
+                         ParserFunc &parser_func, ValidatorFunc &validator_func, VerifierFunc &verifier_func) {
+        const std::vector<std::string> paths = batch_inputs(input);
+        if (paths.empty()) {
+            std::cerr << "Error: no games found for '" << input << "'" << std::endl;
+            return 1;
+        }
+        const auto timeout = std::chrono::milliseconds(vm["timeout"].template as<std::size_t>());
+        const unsigned workers =
+            static_cast<unsigned>(std::min<std::size_t>(thread_count(vm["jobs"].template as<unsigned>()), paths.size()));
+        LGG_INFO("Solving ", paths.size(), " games with ", workers, " workers");
+
+        solvers::DeadlineWatchdog watchdog;
+        std::atomic<std::size_t> next{0};
+        std::atomic<bool> all_ok{true};
+        std::mutex output_mutex;
+        std::vector<std::optional<std::string>> pending(paths.size());
+        std::size_t written = 0;
+
+        parallel_for(
+            workers,
+            [&](std::size_t, std::size_t) {
+                for (std::size_t i = next++; i < paths.size(); i = next++) {
+                    solvers::CancellationToken token;
+                    if (timeout.count() > 0) {
+                        watchdog.watch(token, std::chrono::steady_clock::now() + timeout);
+                    }
+                    bool ok;
+                    std::string line = solve_batch_game(vm, program, paths[i], token, parser_func, validator_func, verifier_func, ok);
+                    watchdog.unwatch(token);
+                    if (!ok) {
+                        all_ok = false;
+                    }
+
+                    const std::lock_guard<std::mutex> lock(output_mutex);
+                    pending[i] = std::move(line);
+                    for (; written < pending.size() && pending[written]; ++written) {
+                        std::cout << *pending[written];
+                        pending[written].reset();
+                    }
+                    std::cout.flush();
+                }
+            },
+            workers);
+        return all_ok ? 0 : 1;
+    }
+
   public:
-    static int run(int argc, char *argv[], ParserFunc parser_func, ValidatorFunc validator_func) {
+    static int run(int argc, char *argv[], ParserFunc parser_func, ValidatorFunc validator_func,
+                   VerifierFunc verifier_func = VerifierFunc()) {
         try {
             auto parsed = parse_command_line(argc, argv);
             auto &vm = parsed.vm;
@@ -204,14 +490,37 @@ class GameSolverWrapper {
             LGG_DEBUG("Starting GameSolverWrapper");
 
             if (vm.count("solver-name")) {
-                SolverType solver;
+                SolverType solver = make_solver(vm);
                 std::cout << solver.get_name() << std::endl;
                 return 0;
             }
 
+            if (vm.count("pin-cpu")) {
+                pin_to_cpu(vm["pin-cpu"].template as<unsigned>());
+            }
+            const bool prefault = vm.count("prefault") > 0;
+            const bool locked = prefault && prefault_memory();
+            if (prefault && !locked) {
+                LGG_WARN("Cannot lock memory; raise the memory lock limit (ulimit -l) to keep it resident");
+            }
+
+            const std::size_t warmup = vm["warmup"].template as<std::size_t>();
+            const bool repeating = vm.count("repeat") || warmup > 0;
+            if (vm.count("batch")) {
+                if (repeating) {
+                    throw std::invalid_argument("--repeat and --warmup cannot be combined with --batch");
+                }
+                if (vm["format"].template as<std::string>() != "json" && !vm["format"].defaulted()) {
+                    throw std::invalid_argument("--batch writes JSON lines; --format must be json");
+                }
+                return run_batch(vm, argv[0], parsed.input, parser_func, validator_func, verifier_func);
+            }
+
             // Parse input game
             std::string input_file = parsed.input;
             std::string output_format = vm["format"].template as<std::string>();
+            const bool profiling = vm.count("profile") > 0;
+            PhaseProfiler profiler;
             std::shared_ptr<GraphType> graph;
 
             LGG_INFO("Parsing input from: ", (input_file == "-" ? "stdin" : input_file));
@@ -223,6 +532,7 @@ class GameSolverWrapper {
             }
 
             LGG_INFO("Successfully parsed game with ", boost::num_vertices(*graph), " vertices");
+            profiler.mark("parse");
 
             // Validate graph
             LGG_DEBUG("Validating graph");
@@ -230,38 +540,158 @@ class GameSolverWrapper {
             LGG_DEBUG("Graph validation passed");
 
             // Create solver and measure time
-            SolverType solver;
+            SolverType solver = make_solver(vm);
             LGG_DEBUG("Starting solver: ", solver.get_name());
 
             static_assert(HasSolveMethod<SolverType, GraphType>,
                           "Solver must have solve() method");
+            profiler.mark("validate");
+
+            const auto elapsed_ms = [](auto start) {
+                const auto end = std::chrono::high_resolution_clock::now();
+                return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0;
+            };
+
+            // --warmup solves are not timed; of the --repeat timed solves,
+            // each with a new solver, the last one's solution is reported.
+            for (std::size_t i = 0; i < warmup; ++i) {
+                make_solver(vm).solve(*graph);
+            }
+            if (warmup > 0) {
+                // Lock what the warm-up faulted in (and the graph), no more
+                if (locked && !lock_memory()) {
+                    LGG_WARN("Cannot lock the memory of the warm-up solves; raise the memory lock limit (ulimit -l)");
+                }
+                profiler.mark("warmup");
+            }
+            std::vector<double> times;
+            const std::size_t repeat = vm.count("repeat") ? std::max<std::size_t>(vm["repeat"].template as<std::size_t>(), 1) : 1;
+            for (std::size_t i = 1; i < repeat; ++i) {
+                SolverType run = make_solver(vm);
+                const auto start = std::chrono::high_resolution_clock::now();
+                run.solve(*graph);
+                times.push_back(elapsed_ms(start));
+            }
 
             auto start = std::chrono::high_resolution_clock::now();
             auto solution = solver.solve(*graph);
-            auto end = std::chrono::high_resolution_clock::now();
+            double time_to_solve = elapsed_ms(start);
+            times.push_back(time_to_solve);
 
-            auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-            double time_to_solve = duration.count() / 1000.0;
+            std::optional<TimingSummary> summary;
+            if (repeating) {
+                summary = TimingSummary::of(std::move(times), warmup);
+                time_to_solve = summary->median;
+            }
 
             LGG_DEBUG("Solver completed in ", time_to_solve, " milliseconds");
+            profiler.mark("solve");
+
+            std::optional<solutions::Verification> verification;
+            if constexpr (has_verifier) {
+                if (vm.count("verify")) {
+                    verification = verifier_func(*graph, solution);
+                    LGG_INFO("Verification ", verification->valid ? "passed" : "failed: " + verification->reason);
+                    profiler.mark("verify");
+                }
+            }
 
             LGG_INFO("Solver completed; emitting results");
 
-            // Output results
-            if (vm.count("time-only")) {
+            // With --profile, the output is timed up to its last flush and
+            // the record follows it: as a JSON member, or as text (on stderr
+            // after a binary solution).
+            const auto profile = [&] {
+                profiler.mark("emit");
+                auto record = make_profile(profiler, argv[0], input_file, *graph, solution, !verification || verification->valid);
+                if (summary) {
+                    record.time = summary->median / 1000;
+                }
+                return record;
+            };
+
+            // Output results; with --repeat, the time reported is the median
+            if (vm.count("time-only") && output_format == "json") {
+                OutputSink out(std::cout);
+                out.put('{');
+                write_json_members<decltype(solution)>(out, time_to_solve, summary, verification, nullptr);
+                if (profiling) {
+                    out.flush();
+                    out.write(", \"profile\": ");
+                    profile().write_json(out);
+                }
+                out.write("}\n");
+                out.flush();
+            } else if (vm.count("time-only")) {
                 std::cout << "Time to solve: " << time_to_solve << " ms" << std::endl;
+                if (verification && !verification->valid) {
+                    std::cerr << "Verification failed: " << verification->reason << std::endl;
+                }
+                OutputSink out(std::cout);
+                if (summary) {
+                    summary->write_text(out, "ms");
+                }
+                if (profiling) {
+                    out.flush();
+                    profile().write_text(out);
+                }
             } else {
-                if (output_format == "json") {
+                // The solution is streamed through a fixed-size buffer, never
+                // built as a string, so output memory does not grow with the game.
+                OutputSink out(std::cout, vm["flush-every"].template as<std::size_t>());
+                if (output_format == "binary") {
+                    // Memory-mappable solution file, see solutions/binary_solution.hpp
+                    solutions::binary::write(out, *graph, solution, time_to_solve);
+                    if (verification && !verification->valid) {
+                        std::cerr << "Verification failed: " << verification->reason << std::endl;
+                    }
+                    out.flush();
+                    OutputSink err(std::cerr);
+                    if (summary) {
+                        summary->write_text(err, "ms");
+                    }
+                    if (profiling) {
+                        profile().write_text(err);
+                    }
+                } else if (output_format == "json") {
                     // One struct with time and solution JSON
-                    std::cout << "{\"time\": " << time_to_solve << ", \"solution\": " << solution.to_json() << "}" << std::endl;
+                    out.put('{');
+                    write_json_members(out, time_to_solve, summary, verification, &solution);
+                    if (profiling) {
+                        out.flush();
+                        out.write(", \"profile\": ");
+                        profile().write_json(out);
+                    }
+                    out.write("}\n");
                 } else {
-                    // plain: use operator<< on solution with formatted output
-                    std::cout << "Game solved in " << time_to_solve << " ms." << std::endl;
-                    std::cout << solution << std::endl;
+                    // plain: the solution's text form
+                    out.write("Game solved in ").general(time_to_solve).write(" ms.\n");
+                    if (summary) {
+                        summary->write_text(out, "ms");
+                    }
+                    if (verification) {
+                        if (verification->valid) {
+                            out.write("Verification: passed\n");
+                        } else {
+                            out.write("Verification failed: ").write(verification->reason).put('\n');
+                        }
+                    }
+                    if constexpr (HasSinkOutput<decltype(solution)>) {
+                        solution.write_text(out);
+                    } else {
+                        out.flush();
+                        std::cout << solution;
+                    }
+                    out.put('\n');
+                    if (profiling) {
+                        out.flush();
+                        profile().write_text(out);
+                    }
                 }
+                out.flush();
             }
 
-            return 0;
+            return verification && !verification->valid ? 4 : 0;
 
         } catch (const ggg::graphs::ParseError &e) {
             LGG_ERROR("ParseError caught: ", e.what());
@@ -295,5 +725,19 @@ class GameSolverWrapper {
             argc, argv, parser_func, validator_func);                                                                      \
     }
 
+/**
+ * @brief Like GGG_GAME_SOLVER_MAIN, with a --verify option checking the solution
+ * @param VerifyFunc The certificate checker (e.g., ggg::parity::verify)
+ */
+#define GGG_GAME_SOLVER_MAIN_VERIFIED(GraphType, ParserFunc, ValidatorType, SolverType, VerifyFunc)                      \
+    int main(int argc, char *argv[]) {                                                                                     \
+        auto parser_func = [](auto &&input) { return ParserFunc(input); };                                                 \
+        auto validator_func = [](const GraphType &graph) { ValidatorType::validate(graph); };                              \
+        auto verifier_func = [](const GraphType &graph, const auto &solution) { return VerifyFunc(graph, solution); };     \
+        return ggg::utils::GameSolverWrapper<GraphType, SolverType, decltype(parser_func), decltype(validator_func),       \
+                                             decltype(verifier_func)>::run(argc, argv, parser_func, validator_func,        \
+                                                                           verifier_func);                                 \
+    }
+
 } // namespace utils
 } // namespace ggg
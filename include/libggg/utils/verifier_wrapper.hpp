@@ -0,0 +1,148 @@
+#pragma once
+
+#include "libggg/graphs/graph_utilities.hpp"
+#include "libggg/graphs/validator.hpp"
+#include "libggg/solutions/binary_solution.hpp"
+#include "libggg/solutions/verification.hpp"
+#include "libggg/utils/logging.hpp"
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ggg {
+namespace utils {
+
+// C++20 concept to detect verifiers that declare their own command line
+// options, as HasSolverOptions does for solvers
+template <typename VerifierType>
+concept HasVerifierOptions = requires(boost::program_options::options_description &desc,
+                                      const boost::program_options::variables_map &vm) {
+    VerifierType::add_options(desc);
+    VerifierType(vm);
+};
+
+/**
+ * @brief Generic command line front end for solution certificate checkers
+ *
+ * Checks a binary solution file (as written by a solver's `--format binary`)
+ * against its game: `ggg_X_verify [options] <game> <solution>`, with `-` as
+ * the game reading it from stdin.  Exits with 0 if the solution is
+ * certified, 4 if not, and with the solver CLIs' codes for other errors.
+ *
+ * @tparam GraphType The graph type
+ * @tparam ParserFunc The parser function type
+ * @tparam ValidatorFunc The validator function type
+ * @tparam VerifierType Called as `verifier(graph, solution, threads)`
+ *         returning solutions::Verification; constructed from the parsed
+ *         options if it declares any (see HasVerifierOptions), default
+ *         constructed otherwise
+ */
+template <typename GraphType, typename ParserFunc, typename ValidatorFunc, typename VerifierType>
+class SolutionVerifierWrapper {
+    static VerifierType make_verifier(const boost::program_options::variables_map &vm) {
+        if constexpr (HasVerifierOptions<VerifierType>) {
+            return VerifierType(vm);
+        } else {
+            return VerifierType();
+        }
+    }
+
+  public:
+    static int run(int argc, char *argv[], ParserFunc parser_func, ValidatorFunc validator_func) {
+        namespace po = boost::program_options;
+        try {
+            po::options_description desc("Verifier Options");
+            desc.add_options()("help,h", "Show help message");
+            desc.add_options()("threads", po::value<unsigned>()->default_value(0),
+                               "Worker threads (0: GGG_THREADS or the hardware concurrency)");
+            desc.add_options()("quiet,q", "Only report through the exit code");
+            if constexpr (HasVerifierOptions<VerifierType>) {
+                VerifierType::add_options(desc);
+            }
+            po::options_description hidden;
+            hidden.add_options()("inputs", po::value<std::vector<std::string>>());
+            po::options_description all;
+            all.add(desc).add(hidden);
+            po::positional_options_description positional;
+            positional.add("inputs", -1);
+
+            po::variables_map vm;
+            po::store(po::command_line_parser(argc, argv).options(all).positional(positional).run(), vm);
+            po::notify(vm);
+
+            if (vm.count("help")) {
+                std::cout << "Usage: " << argv[0] << " [options] <game> <solution>\n\n";
+                std::cout << desc << std::endl;
+                return 0;
+            }
+            const auto inputs = vm.count("inputs") ? vm["inputs"].as<std::vector<std::string>>() : std::vector<std::string>();
+            if (inputs.size() != 2) {
+                std::cerr << "Error: expected a game and a binary solution file\n";
+                std::cerr << "Usage: " << argv[0] << " [options] <game> <solution>\n\n";
+                std::cerr << desc << std::endl;
+                return 2;
+            }
+
+            LGG_INFO("Parsing game from: ", (inputs[0] == "-" ? "stdin" : inputs[0]));
+            std::shared_ptr<GraphType> graph = inputs[0] == "-" ? parser_func(std::cin) : parser_func(inputs[0]);
+            validator_func(*graph);
+
+            const auto solution = solutions::binary::BinarySolution::open(inputs[1]);
+            if (solution.num_vertices() != boost::num_vertices(*graph)) {
+                std::cerr << "Error: the solution has " << solution.num_vertices() << " vertices, the game "
+                          << boost::num_vertices(*graph) << std::endl;
+                return 1;
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            const VerifierType verifier = make_verifier(vm);
+            const solutions::Verification result = verifier(*graph, solution, vm["threads"].as<unsigned>());
+            const auto end = std::chrono::steady_clock::now();
+            LGG_INFO("Checked in ", std::chrono::duration<double, std::milli>(end - start).count(), " ms");
+
+            if (!vm.count("quiet")) {
+                if (result) {
+                    std::cout << "Verification: passed" << std::endl;
+                } else {
+                    std::cout << "Verification failed: " << result.reason << std::endl;
+                }
+            }
+            return result ? 0 : 4;
+
+        } catch (const ggg::graphs::ParseError &e) {
+            std::cerr << "Parse error: " << e.what() << std::endl;
+            return 2;
+        } catch (const ggg::graphs::GraphValidationError &e) {
+            std::cerr << "Validation Error: " << e.what() << std::endl;
+            return 3;
+        } catch (const std::exception &e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+};
+
+/**
+ * @brief Macro to create main functions for solution verifiers
+ * @param GraphType The game graph type
+ * @param ParserFunc The parser function name
+ * @param ValidatorType The validator type
+ * @param VerifyFunc The certificate checker (e.g., ggg::parity::verify)
+ */
+#define GGG_SOLUTION_VERIFIER_MAIN(GraphType, ParserFunc, ValidatorType, VerifyFunc)                                    \
+    int main(int argc, char *argv[]) {                                                                                  \
+        auto parser_func = [](auto &&input) { return ParserFunc(input); };                                              \
+        auto validator_func = [](const GraphType &graph) { ValidatorType::validate(graph); };                           \
+        auto verifier_func = [](const GraphType &graph, const auto &solution, unsigned threads) {                       \
+            return VerifyFunc(graph, solution, threads);                                                                \
+        };                                                                                                              \
+        return ggg::utils::SolutionVerifierWrapper<GraphType, decltype(parser_func), decltype(validator_func),          \
+                                                   decltype(verifier_func)>::run(argc, argv, parser_func,               \
+                                                                                 validator_func);                       \
+    }
+
+} // namespace utils
+} // namespace ggg
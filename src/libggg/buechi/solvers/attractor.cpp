@@ -33,6 +33,7 @@ ggg::solutions::RSSolution<ggg::parity::graph::Graph> AttractorSolver::solve(con
     LGG_TRACE("Found ", target_vertices.size(), " Buechi accepting vertices (priority 1)");
 
     while (!current_active.empty()) {
+        ggg::solvers::throw_if_cancelled();
         iterations++;
         std::set<ggg::parity::graph::Vertex> p1_attractor = compute_attractor(graph, current_active, 1, target_vertices);
 
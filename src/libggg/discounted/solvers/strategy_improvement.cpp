@@ -0,0 +1,110 @@
+#include "libggg/discounted/solvers/strategy_improvement.hpp"
+#include "libggg/utils/logging.hpp"
+#include <stdexcept>
+#include <vector>
+
+namespace ggg {
+namespace discounted {
+
+namespace {
+
+// Switches must beat the current edge by more than rounding noise.
+constexpr double kImprovement = 1e-10;
+
+// Switch every vertex of @p player to a strictly better edge under @p values.
+std::size_t improve(const FlatGame &game, int player, const std::vector<double> &values, std::vector<std::size_t> &profile) {
+    std::size_t switches = 0;
+    for (std::size_t v = 0; v < game.num_vertices(); ++v) {
+        if (game.player[v] != player) {
+            continue;
+        }
+        std::size_t best = profile[v];
+        double best_value = game.value(best, values);
+        for (std::size_t e = game.first_edge(v); e < game.end_edge(v); ++e) {
+            const double value = game.value(e, values);
+            if (player == 0 ? value > best_value + kImprovement : value < best_value - kImprovement) {
+                best = e;
+                best_value = value;
+            }
+        }
+        if (best != profile[v]) {
+            profile[v] = best;
+            ++switches;
+        }
+    }
+    return switches;
+}
+
+} // namespace
+
+auto DiscountedStrategyImprovementSolver::solve(const graph::Graph &graph) -> SISolutionType {
+    LGG_INFO("Starting Strategy Improvement solver for discounted game");
+
+    SISolutionType solution;
+    if (boost::num_vertices(graph) == 0) {
+        LGG_WARN("Empty graph provided");
+        return solution;
+    }
+
+    const auto game = make_flat_game(graph);
+    const std::size_t n = game.num_vertices();
+    if (game.max_discount() >= 1.0) {
+        throw std::invalid_argument("strategy improvement requires all discounts below 1");
+    }
+
+    std::vector<std::size_t> profile(n);
+    for (std::size_t v = 0; v < n; ++v) {
+        profile[v] = game.first_edge(v);
+    }
+    std::vector<double> values(n, 0.0);
+
+    // Value iteration warm start: its greedy strategies are usually close
+    // to optimal long before the values converge.
+    std::size_t sweeps = 0;
+    while (sweeps < value_sweeps_) {
+        ggg::solvers::throw_if_cancelled();
+        ++sweeps;
+        bool changed = false;
+        for (std::size_t v = 0; v < n; ++v) {
+            std::size_t choice;
+            values[v] = best_edge(game, v, values, choice);
+            changed = changed || choice != profile[v];
+            profile[v] = choice;
+        }
+        if (!changed) {
+            break;
+        }
+    }
+
+    std::size_t iterations = 0;
+    std::size_t evaluations = 0;
+    std::size_t switches = 0;
+    std::size_t switched;
+    do {
+        ++iterations;
+        do {
+            ggg::solvers::throw_if_cancelled();
+            evaluate_profile(game, profile, values);
+            ++evaluations;
+            switched = improve(game, 1, values, profile);
+            switches += switched;
+        } while (switched > 0);
+        switched = improve(game, 0, values, profile);
+        switches += switched;
+    } while (switched > 0);
+
+    for (std::size_t v = 0; v < n; ++v) {
+        solution.set_winning_player(v, values[v] >= 0 ? 0 : 1);
+        solution.set_strategy(v, game.target[profile[v]]);
+        solution.set_value(v, values[v]);
+    }
+
+    LGG_TRACE("Solved with ", sweeps, " value iteration sweeps");
+    LGG_TRACE("Solved with ", iterations, " iterations");
+    LGG_TRACE("Solved with ", evaluations, " evaluations");
+    LGG_TRACE("Solved with ", switches, " switches");
+    return solution;
+}
+
+} // namespace discounted
+} // namespace ggg
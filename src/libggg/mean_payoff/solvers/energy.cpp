@@ -0,0 +1,75 @@
+#include "libggg/mean_payoff/solvers/energy.hpp"
+#include "libggg/graphs/csr_utilities.hpp"
+#include "libggg/mean_payoff/energy_measure.hpp"
+#include "libggg/utils/logging.hpp"
+#include <vector>
+
+namespace ggg {
+namespace mean_payoff {
+
+EnergySolutionType EnergySolver::solve(const graph::Graph &graph) {
+    LGG_DEBUG("Mean payoff energy solver starting with ", boost::num_vertices(graph), " vertices");
+
+    EnergySolutionType solution;
+
+    if (boost::num_vertices(graph) == 0) {
+        LGG_TRACE("Empty game - returning solved");
+        return solution;
+    }
+
+    const std::size_t n = boost::num_vertices(graph);
+    const auto successors = graphs::csr_utilities::make_successors(graph);
+    const auto predecessors = graphs::csr_utilities::make_predecessors(graph);
+
+    std::vector<long long> weight(n);
+    std::vector<char> is_player1(n);
+    for (std::size_t v = 0; v < n; ++v) {
+        weight[v] = graph[v].weight;
+        is_player1[v] = graph[v].player != 0;
+    }
+
+    // credit[v] in [0, top]; top stands for "no finite credit suffices".
+    const long long top = energy_top(weight);
+    std::vector<long long> credit(n, 0);
+    long long lifts = lift_energy_measure(successors, predecessors, weight, is_player1, top, credit);
+
+    // Player 0 wins where its credit is finite and no play it allows closes
+    // a cycle of weight 0.
+    std::vector<std::size_t> strategy;
+    const auto positive = positive_mean_payoff(successors, weight, is_player1, top, credit, strategy);
+
+    // Player 1 wins where ν <= 0, i.e. where it has a finite credit in the
+    // dual energy game: players swapped, weights negated.  A successor whose
+    // dual requirement its credit covers allows only cycles of weight <= 0.
+    std::vector<long long> dual_weight(n);
+    std::vector<char> is_dual_player1(n);
+    for (std::size_t v = 0; v < n; ++v) {
+        dual_weight[v] = -weight[v];
+        is_dual_player1[v] = !is_player1[v];
+    }
+    const long long dual_top = energy_top(dual_weight);
+    std::vector<long long> dual_credit(n, 0);
+    lifts += lift_energy_measure(successors, predecessors, dual_weight, is_dual_player1, dual_top, dual_credit);
+
+    for (std::size_t v = 0; v < n; ++v) {
+        solution.set_value(v, credit[v] < top ? credit[v] : infinite_credit);
+        solution.set_winning_player(v, positive[v] ? 0 : 1);
+        if (!is_player1[v] && positive[v]) {
+            solution.set_strategy(v, strategy[v]);
+        } else if (is_player1[v] && !positive[v]) {
+            for (const std::size_t u : successors.neighbours(v)) {
+                if (required_credit(dual_credit[u], dual_weight[v], dual_top) <= dual_credit[v]) {
+                    solution.set_strategy(v, u);
+                    break;
+                }
+            }
+        }
+    }
+
+    LGG_TRACE("Solved with ", lifts, " lifts");
+
+    return solution;
+}
+
+} // namespace mean_payoff
+} // namespace ggg
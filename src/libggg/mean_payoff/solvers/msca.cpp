@@ -1,17 +1,31 @@
 #include "libggg/mean_payoff/solvers/msca.hpp"
-#include "libggg/mean_payoff/graph.hpp"
+#include "libggg/mean_payoff/threshold_search.hpp"
 #include "libggg/utils/logging.hpp"
+#include "libggg/utils/parallel.hpp"
 #include <algorithm>
-#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <vector>
 
 namespace ggg {
 namespace mean_payoff {
 
-ggg::solutions::RSQSolution<graph::Graph, ggg::strategy::DeterministicStrategy<graph::Graph>, long long>
-MSCASolver::solve(const graph::Graph &graph) {
+namespace {
+
+constexpr long long kInfinity = std::numeric_limits<long long>::max();
+constexpr long long kMinusInfinity = std::numeric_limits<long long>::min() / 4;
+
+long long ceil_div(long long a, long long b) {
+    return a >= 0 ? (a + b - 1) / b : -((-a) / b);
+}
+
+} // namespace
+
+MSCASolutionType MSCASolver::solve(const graph::Graph &graph) {
     LGG_DEBUG("MSCA solver starting with ", boost::num_vertices(graph), " vertices");
 
-    ggg::solutions::RSQSolution<graph::Graph, ggg::strategy::DeterministicStrategy<graph::Graph>, long long> solution;
+    MSCASolutionType solution;
 
     if (boost::num_vertices(graph) == 0) {
         LGG_TRACE("Empty game - returning solved");
@@ -19,424 +33,453 @@ MSCASolver::solve(const graph::Graph &graph) {
         return solution;
     }
 
-    init(graph);
-
-    bool empty_fun = is_empty();
-
-    if (!empty_fun) {
-        compute_energy();
-
-        const auto [vertices_begin, vertices_end] = boost::vertices(graph);
-        for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
-            int idx = vertex_to_index_[vertex];
+    const Game game(graph);
+    Run run(game);
+    run.compute_energy();
 
-            if (msrfun_[idx] >= (nw_ / 2)) {
-                solution.set_winning_player(vertex, 1);
-            } else {
-                solution.set_winning_player(vertex, 0);
-                if (strategy_[idx] != boost::graph_traits<graph::Graph>::null_vertex()) {
-                    solution.set_strategy(vertex, strategy_[idx]);
-                }
-            }
+    // Values are the credits for w, -1 for ⊤.
+    for (std::size_t v = 0; v < game.n; ++v) {
+        solution.set_value(v, run.is_top(v) ? -1 : run.measure(v));
+    }
 
-            solution.set_value(vertex, msrfun_[idx]);
+    // Player 0 wins where ν > 0, i.e. where it has a finite credit for the
+    // weights n·w - 1.  n times the measure for w is a lower bound of it.
+    const long long n = static_cast<long long>(game.n);
+    run.rescale_measure(1, n);
+    run.set_threshold(1, n);
+    run.compute_energy_warm();
+
+    for (std::size_t v = 0; v < game.n; ++v) {
+        if (run.is_top(v)) {
+            solution.set_winning_player(v, 1);
+            continue;
         }
-    } else {
-        const auto [vertices_begin, vertices_end] = boost::vertices(graph);
-        for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
-            solution.set_winning_player(vertex, 0);
-            solution.set_value(vertex, 0);
-
-            if (graph[vertex].player == 0) {
-                const auto [out_edges_begin, out_edges_end] = boost::out_edges(vertex, graph);
-                if (out_edges_begin != out_edges_end) {
-                    solution.set_strategy(vertex, boost::target(*out_edges_begin, graph));
+
+        solution.set_winning_player(v, 0);
+        if (!game.is_player1[v]) {
+            for (const std::size_t u : game.successors.neighbours(v)) {
+                if (run.wf(v, u) >= 0) {
+                    solution.set_strategy(v, u);
+                    break;
                 }
             }
         }
     }
 
-    LGG_TRACE("MSCA solved with ", count_update_, " updates");
-    LGG_TRACE("               ", count_delta_, " delta lifts");
-    LGG_TRACE("               ", count_scaling_, " scaling operations");
-    LGG_TRACE("               ", count_update_ + count_delta_ + count_scaling_, " total operations");
-    LGG_TRACE("               ", count_iter_delta_, " delta iterations");
-    LGG_TRACE("               ", count_super_delta_, " effective deltas");
-    LGG_TRACE("               ", count_null_delta_, " null deltas");
-    LGG_TRACE("               ", max_delta_, " maximum delta");
+    run.log_statistics();
 
     return solution;
 }
 
-void MSCASolver::init(const graph::Graph &graph) {
-    graph_ = &graph;
-
-    scaling_val_ = 1;
-    delta_value_ = 0;
-    working_vertex_index_ = 0;
-
-    count_update_ = 0;
-    count_delta_ = 0;
-    count_iter_delta_ = 0;
-    count_super_delta_ = 0;
-    count_null_delta_ = 0;
-    count_scaling_ = 0;
-    max_delta_ = 0;
-
-    const auto [vertices_begin, vertices_end] = boost::vertices(graph);
-    int vertex_count = boost::num_vertices(graph);
-
-    vertex_to_index_.clear();
-    index_to_vertex_.resize(vertex_count);
-
-    int idx = 0;
-    for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
-        vertex_to_index_[vertex] = idx;
-        index_to_vertex_[idx] = vertex;
-        idx++;
+MSCASolver::Game::Game(const graph::Graph &graph)
+    : n(boost::num_vertices(graph)),
+      successors(graphs::csr_utilities::make_successors(graph)),
+      predecessors(graphs::csr_utilities::make_predecessors(graph)),
+      is_player1(n),
+      base_weight(n) {
+    for (std::size_t v = 0; v < n; ++v) {
+        is_player1[v] = graph[v].player != 0;
+        base_weight[v] = graph[v].weight;
     }
+}
 
-    weight_.resize(vertex_count);
-    msrfun_.resize(vertex_count);
-    count_.resize(vertex_count);
-    strategy_.resize(vertex_count);
-
-    rescaled_.resize(vertex_count);
-    setL_.resize(vertex_count);
-    setB_.resize(vertex_count);
+MSCASolver::Run::Run(const Game &game)
+    : game_(game),
+      n_(game.n),
+      weight_(game.base_weight),
+      scaled_weight_(game.n, 0),
+      msrfun_(game.n, 0),
+      stamp_(game.n, 0),
+      setL_(game.n),
+      setB_(game.n, 0) {}
+
+void MSCASolver::Run::log_statistics() const {
+    LGG_TRACE("MSCA solved with ", count_update_, " updated vertices");
+    LGG_TRACE("               ", count_iter_delta_, " set lifts");
+    LGG_TRACE("               ", count_delta_, " vertex lifts");
+    LGG_TRACE("               ", count_super_delta_, " lifts by more than one");
+    LGG_TRACE("               ", count_rebuild_, " closure rebuilds");
+    LGG_TRACE("               ", max_delta_, " maximum delta");
+    LGG_TRACE("               ", count_top_, " vertices lifted to top");
+    LGG_TRACE("               ", count_scaling_, " scaling levels");
+}
 
-    for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
-        int idx = vertex_to_index_[vertex];
-        strategy_[idx] = boost::graph_traits<graph::Graph>::null_vertex();
-        msrfun_[idx] = 0;
-        count_[idx] = 0;
-        weight_[idx] = graph[vertex].weight;
+void MSCASolver::Run::set_threshold(long long numerator, long long denominator) {
+    // ν(v) >= p/q  iff  player 0 has a finite credit for the weights q·w - p.
+    for (std::size_t v = 0; v < n_; ++v) {
+        weight_[v] = denominator * game_.base_weight[v] - numerator;
     }
-
-    nw_ = calc_n_w();
 }
 
-long long MSCASolver::calc_n_w() {
-    long long max_weight = 0;
-    const auto [vertices_begin, vertices_end] = boost::vertices(*graph_);
-
-    for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
-        long long abs_weight = std::abs(static_cast<long long>((*graph_)[vertex].weight));
-        max_weight = std::max(max_weight, abs_weight);
+void MSCASolver::Run::rescale_measure(long long from_denominator, long long to_denominator) {
+    for (std::size_t v = 0; v < n_; ++v) {
+        msrfun_[v] = is_top(v) ? kInfinity
+                               : static_cast<long long>(__int128(msrfun_[v]) * to_denominator / from_denominator);
     }
-
-    return max_weight;
 }
 
-long long MSCASolver::wf(int predecessor_idx, int successor_idx) {
-    if (rescaled_[predecessor_idx]) {
-        return std::ceil(static_cast<double>(weight_[successor_idx]) / static_cast<double>(scaling_val_)) +
-               msrfun_[predecessor_idx] - msrfun_[successor_idx];
-    } else {
-        double scaled_weight = static_cast<double>(weight_[successor_idx]) / static_cast<double>(scaling_val_);
-        double double_scaled = static_cast<double>(weight_[successor_idx]) / static_cast<double>(scaling_val_ * 2);
-
-        if ((2 * std::ceil(double_scaled)) > std::ceil(scaled_weight)) {
-            return std::ceil(scaled_weight) + 1 + msrfun_[predecessor_idx] - msrfun_[successor_idx];
-        } else {
-            return -2 * nw_;
+void MSCASolver::Run::set_level(long long scale) {
+    top_ = 1;
+    for (std::size_t v = 0; v < n_; ++v) {
+        scaled_weight_[v] = ceil_div(weight_[v], scale);
+        if (scaled_weight_[v] < 0) {
+            top_ -= scaled_weight_[v];
         }
     }
 }
 
-long long MSCASolver::delta_p1() {
-    long long max_d2 = -2 * nw_;
-
-    for (std::size_t pos = setB_.find_first(); pos != Bitset::npos && pos < setB_.size(); pos = setB_.find_next(pos)) {
-        const auto &vertex = index_to_vertex_[pos];
-
-        if ((*graph_)[vertex].player == 0) {
-            const auto [out_edges_begin, out_edges_end] = boost::out_edges(vertex, *graph_);
-            for (const auto &edge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-                const auto &successor = boost::target(edge, *graph_);
-                int successor_idx = vertex_to_index_[successor];
+void MSCASolver::Run::compute_energy() {
+    long long most_negative = 0;
+    for (const long long w : weight_) {
+        most_negative = std::max(most_negative, -w);
+    }
 
-                if (!setB_[successor_idx]) {
-                    long long edge_weight = wf(pos, successor_idx);
-                    max_d2 = std::max(max_d2, edge_weight);
-                }
-            }
+    // With 2^k > max(-w), all weights ⌈w/2^k⌉ are non-negative and the zero
+    // measure is the least one.
+    long long scale = 1;
+    while (scale <= most_negative) {
+        scale *= 2;
+    }
+    set_level(scale);
+    msrfun_.assign(n_, 0);
+
+    while (scale > 1) {
+        const long long previous_top = top_;
+        scale /= 2;
+        set_level(scale);
+        for (std::size_t v = 0; v < n_; ++v) {
+            msrfun_[v] = msrfun_[v] >= previous_top ? top_ : std::min(2 * msrfun_[v], top_);
         }
+        run_level();
+        count_scaling_++;
     }
-
-    return -max_d2;
 }
 
-long long MSCASolver::delta_p2() {
-    long long min_d2 = 2 * nw_;
-    long long min_d3 = 2 * nw_;
-
-    setB_.flip();
-
-    for (std::size_t pos = setB_.find_first(); pos != Bitset::npos && pos < setB_.size(); pos = setB_.find_next(pos)) {
-        const auto &vertex = index_to_vertex_[pos];
-        long long max_d2 = -2 * nw_;
-
-        if ((*graph_)[vertex].player == 0) {
-            bool enable2 = true;
+void MSCASolver::Run::compute_energy_warm() {
+    set_level(1);
+    for (std::size_t v = 0; v < n_; ++v) {
+        msrfun_[v] = std::min(msrfun_[v], top_);
+    }
+    run_level();
+}
 
-            const auto [out_edges_begin, out_edges_end] = boost::out_edges(vertex, *graph_);
-            for (const auto &edge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-                const auto &successor = boost::target(edge, *graph_);
-                int successor_idx = vertex_to_index_[successor];
+void MSCASolver::Run::run_level() {
+    worklist_.clear();
+    setL_.set();
+    for (std::size_t v = n_; v-- > 0;) {
+        worklist_.push_back(v);
+    }
+    for (std::size_t v = 0; v < n_; ++v) {
+        if (is_top(v)) {
+            lift_to_top(v);
+        }
+    }
 
-                if (enable2 && setB_[successor_idx] && wf(pos, successor_idx) >= 0) {
-                    enable2 = false;
-                }
-            }
+    while (!worklist_.empty()) {
+        ggg::solvers::throw_if_cancelled();
+        const std::size_t v = worklist_.back();
+        worklist_.pop_back();
+        setL_.reset(v);
+        update_energy(v);
+    }
+}
 
-            if (enable2) {
-                for (const auto &edge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-                    const auto &successor = boost::target(edge, *graph_);
-                    int successor_idx = vertex_to_index_[successor];
-                    max_d2 = std::max(max_d2, wf(pos, successor_idx));
-                }
-                min_d2 = std::min(min_d2, max_d2);
-            }
-        } else {
-            const auto [out_edges_begin, out_edges_end] = boost::out_edges(vertex, *graph_);
-            for (const auto &edge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-                const auto &successor = boost::target(edge, *graph_);
-                int successor_idx = vertex_to_index_[successor];
+long long MSCASolver::Run::wf(std::size_t predecessor, std::size_t successor) const {
+    if (is_top(successor)) {
+        return kMinusInfinity;
+    }
+    return scaled_weight_[successor] + measure(predecessor) - measure(successor);
+}
 
-                if (!setB_[successor_idx]) {
-                    min_d3 = std::min(min_d3, wf(pos, successor_idx));
-                }
-            }
+bool MSCASolver::Run::is_bad(std::size_t vertex) const {
+    if (is_top(vertex)) {
+        return false;
+    }
+    for (const std::size_t u : game_.successors.neighbours(vertex)) {
+        const bool consistent = wf(vertex, u) >= 0;
+        if (game_.is_player1[vertex] != consistent) {
+            return game_.is_player1[vertex];
         }
     }
+    return !game_.is_player1[vertex];
+}
 
-    setB_.flip();
-    return std::min(min_d2, min_d3);
+bool MSCASolver::Run::is_stale(const Event &event) const {
+    if (event.kind == kExit) {
+        return setB_[event.other];
+    }
+    return setB_[event.vertex] || (!game_.is_player1[event.vertex] && stamp_[event.vertex] != event.other);
 }
 
-void MSCASolver::delta() {
-    long long d1 = delta_p1();
-    long long d2 = delta_p2();
-    delta_value_ = std::min(d1, d2);
+void MSCASolver::Run::push_event(const Event &event) {
+    if (event.kind == kJoin && event.key <= offset_) {
+        // Already tight: joins without waiting for a lift.
+        tight_.push_back(event.vertex);
+        return;
+    }
+    events_.push_back(event);
+    std::push_heap(events_.begin(), events_.end(), std::greater<>{});
 }
 
-void MSCASolver::update_func(int pos) {
-    setL_[pos] = false;
-    ++msrfun_[pos];
-    count_update_++;
-
-    const auto &vertex = index_to_vertex_[pos];
-
-    if ((*graph_)[vertex].player == 0) {
-        count_[pos] = 0;
-        const auto [out_edges_begin, out_edges_end] = boost::out_edges(vertex, *graph_);
-        for (const auto &edge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-            const auto &successor = boost::target(edge, *graph_);
-            int successor_idx = vertex_to_index_[successor];
-            if (wf(pos, successor_idx) >= 0) {
-                ++count_[pos];
-            }
+void MSCASolver::Run::join_closure(std::size_t vertex, std::size_t root) {
+    // Members are stored relative to the shared offset.
+    msrfun_[vertex] -= offset_;
+    setB_[vertex] = 1;
+    closure_.push_back(vertex);
+    max_stored_ = std::max(max_stored_, msrfun_[vertex]);
+
+    schedule_exit(vertex, root);
+
+    // Predecessors join once their constraints become tight: player 1 on any
+    // edge into the closure, player 0 on its last consistent edge.
+    const long long entry = scaled_weight_[vertex] - msrfun_[vertex] - offset_;
+    for (const std::size_t u : game_.predecessors.neighbours(vertex)) {
+        if (setB_[u] || msrfun_[u] >= top_) {
+            continue;
+        }
+        if (!game_.is_player1[u]) {
+            schedule_player0(u);
+        } else if (entry + msrfun_[u] <= 0) {
+            tight_.push_back(u);
+        } else {
+            push_event({offset_ + entry + msrfun_[u], kJoin, u, 0});
         }
     }
+}
 
-    const auto [in_edges_begin, in_edges_end] = boost::in_edges(vertex, *graph_);
-    for (const auto &in_edge : boost::make_iterator_range(in_edges_begin, in_edges_end)) {
-        const auto &pred_vertex = boost::source(in_edge, *graph_);
-        int pred_idx = vertex_to_index_[pred_vertex];
-
-        if (wf(pred_idx, pos) < 0) {
-            if ((*graph_)[pred_vertex].player == 0) {
-                if (wf(pred_idx, pos) == -1) {
-                    --count_[pred_idx];
-                    if (count_[pred_idx] == 0) {
-                        setL_[pred_idx] = true;
-                        setB_[pred_idx] = true;
-                    }
-                }
-            } else {
-                setL_[pred_idx] = true;
-                setB_[pred_idx] = true;
-                strategy_[pred_idx] = vertex;
+void MSCASolver::Run::schedule_exit(std::size_t vertex, std::size_t root) {
+    // The lift is safe up to the smallest deficit on an edge leaving the
+    // closure from a player 0 member; a player 1 root is consistent once its
+    // largest deficit is covered.  One event per member: when its target
+    // joins, the event is stale and the member is rescheduled.
+    if (game_.is_player1[vertex] && vertex != root) {
+        return;
+    }
+    long long key = game_.is_player1[vertex] ? kMinusInfinity : kInfinity;
+    std::size_t target = vertex;
+    for (const std::size_t u : game_.successors.neighbours(vertex)) {
+        if (setB_[u] || is_top(u)) {
+            if (game_.is_player1[vertex] && setB_[u] && wf(vertex, u) < 0) {
+                return;
             }
+            continue;
         }
+        const long long slack = wf(vertex, u);
+        if (game_.is_player1[vertex] ? slack < 0 && offset_ - slack > key : offset_ - slack < key) {
+            key = offset_ - slack;
+            target = u;
+        }
+    }
+    if (target != vertex) {
+        push_event({key, kExit, vertex, target});
     }
 }
 
-void MSCASolver::update_energy() {
-    const auto &vertex = index_to_vertex_[working_vertex_index_];
-    bool valid;
-
-    if ((*graph_)[vertex].player == 0) {
-        valid = true;
-        const auto [out_edges_begin, out_edges_end] = boost::out_edges(vertex, *graph_);
-        for (const auto &edge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-            const auto &successor = boost::target(edge, *graph_);
-            int successor_idx = vertex_to_index_[successor];
-            if (valid && wf(working_vertex_index_, successor_idx) >= 0) {
-                valid = false;
+void MSCASolver::Run::schedule_player0(std::size_t vertex) {
+    // Supersedes any earlier event: the edges into the closure have changed.
+    const unsigned stamp = ++stamp_[vertex];
+    long long best = kMinusInfinity;
+    for (const std::size_t u : game_.successors.neighbours(vertex)) {
+        const long long slack = wf(vertex, u);
+        if (!setB_[u]) {
+            if (slack >= 0) {
+                return;
             }
+        } else {
+            best = std::max(best, slack);
         }
-    } else {
-        valid = false;
-        const auto [out_edges_begin, out_edges_end] = boost::out_edges(vertex, *graph_);
-        for (const auto &edge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-            const auto &successor = boost::target(edge, *graph_);
-            int successor_idx = vertex_to_index_[successor];
-            if (!valid && wf(working_vertex_index_, successor_idx) < 0) {
-                valid = true;
+    }
+    if (best >= 0) {
+        push_event({offset_ + best, kJoin, vertex, stamp});
+    }
+}
+
+void MSCASolver::Run::release_closure() {
+    const bool reaches_top = offset_ >= top_ - max_stored_;
+    for (const std::size_t v : closure_) {
+        setB_[v] = 0;
+        msrfun_[v] = offset_ >= top_ - msrfun_[v] ? top_ : msrfun_[v] + offset_;
+    }
+    offset_ = 0;
+    if (reaches_top) {
+        for (const std::size_t v : closure_) {
+            if (is_top(v)) {
+                lift_to_top(v);
             }
         }
     }
+    closure_.clear();
+    tight_.clear();
+    events_.clear();
+}
 
-    setL_.reset();
-    setB_.reset();
-
-    if (valid) {
-        setL_[working_vertex_index_] = true;
-
-        while ((setL_.count() == 1) && setL_[working_vertex_index_]) {
-
-            const auto [vertices_begin, vertices_end] = boost::vertices(*graph_);
-            for (const auto &v : boost::make_iterator_range(vertices_begin, vertices_end)) {
-                int v_idx = vertex_to_index_[v];
-                if ((*graph_)[v].player == 0) {
-                    count_[v_idx] = 0;
-                    const auto [out_edges_begin, out_edges_end] = boost::out_edges(v, *graph_);
-                    for (const auto &edge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-                        const auto &successor = boost::target(edge, *graph_);
-                        int successor_idx = vertex_to_index_[successor];
-                        if (wf(v_idx, successor_idx) >= 0) {
-                            ++count_[v_idx];
-                        }
-                    }
+void MSCASolver::Run::update_energy(std::size_t root) {
+    bool updated = false;
+    while (is_bad(root)) {
+        if (updated) {
+            count_rebuild_++;
+        }
+        updated = true;
+        offset_ = 0;
+        max_stored_ = kMinusInfinity;
+        join_closure(root, root);
+
+        while (true) {
+            while (!tight_.empty()) {
+                const std::size_t v = tight_.back();
+                tight_.pop_back();
+                if (!setB_[v]) {
+                    join_closure(v, root);
                 }
             }
-
-            update_func(working_vertex_index_);
-
-            while (((setL_.count() > 1) || ((setL_.count() == 1) && !setL_[working_vertex_index_]))) {
-                bool pick = false;
-                std::size_t ind = setL_.find_first();
-                while (!pick && ind != Bitset::npos) {
-                    if (ind < setL_.size() && ind != static_cast<std::size_t>(working_vertex_index_)) {
-                        pick = true;
-                    } else {
-                        ind = setL_.find_next(ind);
-                    }
-                }
-                if (pick && ind != Bitset::npos) {
-                    update_func(ind);
-                } else {
-                    LGG_DEBUG("No more vertices to update, exiting loop");
-                    break;
+            while (!events_.empty() && is_stale(events_.front())) {
+                const Event stale = events_.front();
+                std::pop_heap(events_.begin(), events_.end(), std::greater<>{});
+                events_.pop_back();
+                if (stale.kind == kExit) {
+                    schedule_exit(stale.vertex, root);
                 }
             }
-
-            bool delta_root = false;
-            if ((*graph_)[vertex].player == 0) {
-                if (count_[working_vertex_index_] < 1) {
-                    delta_root = true;
-                }
-            } else {
-                const auto [out_edges_begin, out_edges_end] = boost::out_edges(vertex, *graph_);
-                for (const auto &edge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-                    const auto &successor = boost::target(edge, *graph_);
-                    int successor_idx = vertex_to_index_[successor];
-                    if (!delta_root && wf(working_vertex_index_, successor_idx) < 0) {
-                        delta_root = true;
-                    }
+            if (!tight_.empty()) {
+                continue;
+            }
+            const long long next = events_.empty() ? kInfinity : events_.front().key;
+
+            // Offset at which the highest member reaches ⊤.
+            const long long limit = top_ - max_stored_;
+            if (next >= limit) {
+                offset_ = next == kInfinity ? kInfinity : limit;
+                count_iter_delta_++;
+                count_delta_ += closure_.size();
+                break;
+            }
+            if (next > offset_) {
+                const long long delta = next - offset_;
+                offset_ = next;
+                count_iter_delta_++;
+                count_delta_ += closure_.size();
+                if (delta > 1) {
+                    count_super_delta_++;
                 }
+                max_delta_ = std::max(max_delta_, delta);
             }
 
-            if (delta_root) {
-                delta();
-                if (delta_value_ > 0) {
-                    bool enable_d = false;
-                    for (std::size_t pos = setB_.find_first(); pos != Bitset::npos && pos < setB_.size(); pos = setB_.find_next(pos)) {
-                        msrfun_[pos] += delta_value_;
-                        count_delta_++;
-                        enable_d = true;
-                    }
+            const Event event = events_.front();
+            std::pop_heap(events_.begin(), events_.end(), std::greater<>{});
+            events_.pop_back();
 
-                    if (enable_d) {
-                        if (delta_value_ > 1) {
-                            count_super_delta_++;
-                        }
-                        if (delta_value_ > static_cast<long long>(max_delta_)) {
-                            max_delta_ = static_cast<unsigned long>(delta_value_);
-                        }
-                    }
-                    count_iter_delta_++;
-                } else {
-                    count_null_delta_++;
-                }
+            if (event.kind == kJoin) {
+                join_closure(event.vertex, root);
+            } else if (event.vertex != root || !is_bad(root)) {
+                // A member other than the root no longer depends on the
+                // closure, so it is rebuilt; or the root is consistent.
+                break;
             }
         }
+        release_closure();
+    }
+    if (updated) {
+        count_update_++;
     }
 }
 
-void MSCASolver::compute_energy() {
-    bool neg = false;
-    working_vertex_index_ = 0;
-
-    while (!neg && working_vertex_index_ < static_cast<int>(weight_.size())) {
-        double scaled_weight = static_cast<double>(weight_[working_vertex_index_]) / static_cast<double>(scaling_val_);
-        double double_scaled = static_cast<double>(weight_[working_vertex_index_]) / static_cast<double>(scaling_val_ * 2);
-
-        if ((2 * std::ceil(double_scaled)) > std::ceil(scaled_weight)) {
-            if (std::ceil(scaled_weight) - 1 < 0) {
-                neg = true;
-            } else {
-                working_vertex_index_++;
+void MSCASolver::Run::lift_to_top(std::size_t vertex) {
+    // ⊤ is closed under the player 1 attractor.  Player 0 predecessors that
+    // keep other moves may have lost their only consistent edge.
+    msrfun_[vertex] = top_;
+    std::vector<std::size_t> stack{vertex};
+    while (!stack.empty()) {
+        const std::size_t v = stack.back();
+        stack.pop_back();
+        for (const std::size_t u : game_.predecessors.neighbours(v)) {
+            if (is_top(u)) {
+                continue;
+            }
+            const auto moves = game_.successors.neighbours(u);
+            if (game_.is_player1[u] || std::all_of(moves.begin(), moves.end(), [&](std::size_t w) { return is_top(w); })) {
+                msrfun_[u] = top_;
+                stack.push_back(u);
+                count_top_++;
+            } else if (!setL_[u]) {
+                setL_.set(u);
+                worklist_.push_back(u);
             }
-        } else if (std::ceil(scaled_weight) < 0) {
-            neg = true;
-        } else {
-            working_vertex_index_++;
         }
     }
+}
 
-    if (neg) {
-        count_scaling_ += boost::num_edges(*graph_);
-        scaling_val_ *= 2;
-        compute_energy();
-        scaling_val_ /= 2;
-        count_scaling_ += boost::num_edges(*graph_);
-        count_scaling_ += boost::num_vertices(*graph_);
+MSCAValueSolutionType MSCAValueSolver::solve(const graph::Graph &graph) {
+    LGG_DEBUG("MSCA value solver starting with ", boost::num_vertices(graph), " vertices");
 
-        for (std::size_t pos = 0; pos < msrfun_.size(); ++pos) {
-            msrfun_[pos] *= 2;
-        }
+    MSCAValueSolutionType solution;
 
-        rescaled_.reset();
-        for (working_vertex_index_ = 0; working_vertex_index_ < static_cast<int>(weight_.size()); ++working_vertex_index_) {
-            rescaled_[working_vertex_index_] = true;
-            update_energy();
-        }
+    if (boost::num_vertices(graph) == 0) {
+        LGG_TRACE("Empty game - returning solved");
+        return solution;
     }
-}
 
-bool MSCASolver::is_empty() const {
-    const auto [vertices_begin, vertices_end] = boost::vertices(*graph_);
-    for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
-        if ((*graph_)[vertex].weight != 0) {
-            return false;
+    const MSCASolver::Game game(graph);
+    const std::size_t n = game.n;
+
+    long long max_weight = 0;
+    for (const long long w : game.base_weight) {
+        max_weight = std::max(max_weight, std::llabs(w));
+    }
+
+    // One run per block, kept across rounds with the threshold it last
+    // decided (den == 0 before the first).
+    std::vector<MSCASolver::Run> runs;
+    std::vector<utils::Fraction> last;
+
+    std::size_t rounds = 0;
+    std::size_t queries = 0;
+    const auto decide = [&](const std::vector<utils::Fraction> &thresholds) {
+        const std::size_t blocks = std::min<std::size_t>(utils::thread_count(threads_), thresholds.size());
+        while (runs.size() < blocks) {
+            runs.emplace_back(game);
+            last.push_back({0, 0});
         }
+
+        std::vector<std::vector<char>> at_least(thresholds.size());
+        utils::parallel_for(blocks, [&](std::size_t first_block, std::size_t end_block) {
+            for (std::size_t block = first_block; block < end_block; ++block) {
+                MSCASolver::Run &run = runs[block];
+                const std::size_t begin = thresholds.size() * block / blocks;
+                const std::size_t end = thresholds.size() * (block + 1) / blocks;
+                for (std::size_t i = begin; i < end; ++i) {
+                    const long long numerator = static_cast<long long>(thresholds[i].num);
+                    const long long denominator = static_cast<long long>(thresholds[i].den);
+                    if (last[block].den == 0 || thresholds[i] < last[block]) {
+                        run.set_threshold(numerator, denominator);
+                        run.compute_energy();
+                    } else {
+                        run.rescale_measure(static_cast<long long>(last[block].den), denominator);
+                        run.set_threshold(numerator, denominator);
+                        run.compute_energy_warm();
+                    }
+                    last[block] = thresholds[i];
+                    at_least[i].resize(n);
+                    for (std::size_t v = 0; v < n; ++v) {
+                        at_least[i][v] = !run.is_top(v);
+                    }
+                }
+            }
+        }, static_cast<unsigned>(blocks));
+        rounds++;
+        queries += thresholds.size();
+        return at_least;
+    };
+
+    const auto values = search_values_by_thresholds(n, max_weight, decide);
+
+    for (std::size_t v = 0; v < n; ++v) {
+        solution.set_value(v, values[v]);
+        solution.set_winning_player(v, values[v] > 0 ? 0 : 1);
     }
-    return true;
-}
 
-void MSCASolver::reset() {
-    vertex_to_index_.clear();
-    index_to_vertex_.clear();
-    weight_.clear();
-    msrfun_.clear();
-    count_.clear();
-    strategy_.clear();
-    rescaled_.clear();
-    setL_.clear();
-    setB_.clear();
+    LGG_TRACE("Solved with ", queries, " threshold queries in ", rounds, " rounds");
+
+    return solution;
 }
 
 } // namespace mean_payoff
@@ -1,7 +1,9 @@
 #include "libggg/mean_payoff/solvers/mse.hpp"
+#include "libggg/graphs/csr_utilities.hpp"
+#include "libggg/mean_payoff/energy_measure.hpp"
 #include "libggg/utils/logging.hpp"
-#include <map>
-#include <queue>
+#include <algorithm>
+#include <vector>
 
 namespace ggg {
 namespace mean_payoff {
@@ -19,164 +21,157 @@ SolutionType MSESolver::solve(const graph::Graph &graph) {
         return solution;
     }
 
+    const std::size_t n = boost::num_vertices(graph);
+    constexpr std::size_t no_vertex = static_cast<std::size_t>(-1);
+
+    // Flat per-vertex game data, indexed by vertex descriptor
+    const auto successors = graphs::csr_utilities::make_successors(graph);
+    const auto predecessors = graphs::csr_utilities::make_predecessors(graph);
+    std::vector<long long> weight(n);
+    std::vector<char> is_player1(n);
+
     // Algorithm state variables
-    int iterations = 0;
-    int lifts = 0;
-    int limit = 0;
-
-    std::vector<graph::Graph::vertex_descriptor> current_strategy(
-        boost::num_vertices(graph),
-        boost::graph_traits<graph::Graph>::null_vertex());
-    std::vector<int> current_cost(boost::num_vertices(graph), 0);
-    std::vector<int> current_count(boost::num_vertices(graph), 0);
-    std::queue<graph::Graph::vertex_descriptor> t_atr;
-    std::vector<bool> b_atr(boost::num_vertices(graph), false);
-
-    // Map vertex to appropriate index for above vectors and queue
-    std::map<graph::Graph::vertex_descriptor, int> vertex_map;
-    std::vector<graph::Graph::vertex_descriptor> index_to_vertex(boost::num_vertices(graph));
-
-    const auto [vertices_begin, vertices_end] = boost::vertices(graph);
-    int vertex_count = 0;
-
-    // Initialize vertex mappings and initial state
-    for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
-        vertex_map[vertex] = vertex_count;
-        index_to_vertex[vertex_count] = vertex;
-        vertex_count++;
-
-        const auto weight = graph[vertex].weight;
-
-        if (weight > 0) {
-            t_atr.push(vertex);
-            b_atr[vertex_map[vertex]] = true;
-            limit += weight;
-        } else {
-            if (graph[vertex].player) {
-                current_count[vertex_map[vertex]] = boost::out_degree(vertex, graph);
-            }
+    long long iterations = 0;
+    long long lifts = 0;
+    long long limit = 0;
+
+    std::vector<std::size_t> current_strategy(n, no_vertex);
+    std::vector<long long> current_cost(n, 0);
+    std::vector<std::size_t> current_count(n, 0);
+    std::vector<char> b_atr(n, 0);
+
+    // FIFO worklist as a ring buffer: b_atr guarantees each vertex is queued
+    // at most once, so n slots always suffice.
+    std::vector<std::size_t> t_atr(n);
+    std::size_t head = 0;
+    std::size_t queued = 0;
+    const auto push = [&](std::size_t v) {
+        t_atr[(head + queued) % n] = v;
+        ++queued;
+        b_atr[v] = 1;
+    };
+
+    // Initialize vertex data and initial state
+    for (std::size_t v = 0; v < n; ++v) {
+        weight[v] = graph[v].weight;
+        is_player1[v] = graph[v].player != 0;
+
+        if (weight[v] > 0) {
+            push(v);
+            limit += weight[v];
+        } else if (is_player1[v]) {
+            current_count[v] = successors.degree(v);
         }
     }
     limit += 1;
 
+    // Saturating lift: current_cost never exceeds limit, and |weight| < 2^31,
+    // so cost + weight is always representable before clamping.
+    const auto lifted = [&](long long cost, long long w) {
+        return cost >= limit ? limit : std::min(cost + w, limit);
+    };
+
     // Main solution cycle
-    while (!t_atr.empty()) {
+    while (queued > 0) {
+        ggg::solvers::throw_if_cancelled();
         iterations++;
-        const auto pos = t_atr.front();
-        t_atr.pop();
-        b_atr[vertex_map[pos]] = false;
-        int old_cost = current_cost[vertex_map[pos]];
-        graph::Graph::vertex_descriptor best_successor =
-            boost::graph_traits<graph::Graph>::null_vertex();
-
-        if (graph[pos].player) {
+        const std::size_t pos = t_atr[head];
+        head = (head + 1) % n;
+        --queued;
+        b_atr[pos] = 0;
+        const long long old_cost = current_cost[pos];
+        std::size_t best_successor = no_vertex;
+
+        if (is_player1[pos]) {
             // Player 1 minimizer
-            const auto [out_edges_begin, out_edges_end] = boost::out_edges(pos, graph);
-            for (const auto &edge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-                const auto successor = boost::target(edge, graph);
-                if (best_successor == boost::graph_traits<graph::Graph>::null_vertex()) {
+            for (const std::size_t successor : successors.neighbours(pos)) {
+                if (best_successor == no_vertex || current_cost[best_successor] > current_cost[successor]) {
                     best_successor = successor;
-                    current_count[vertex_map[pos]] = 1;
-                } else {
-                    // Compare with current best successor
-                    if (current_cost[vertex_map[best_successor]] > current_cost[vertex_map[successor]]) {
-                        best_successor = successor;
-                        current_count[vertex_map[pos]] = 1;
-                    } else if (current_cost[vertex_map[best_successor]] == current_cost[vertex_map[successor]]) {
-                        current_count[vertex_map[pos]]++;
-                    }
+                    current_count[pos] = 1;
+                } else if (current_cost[best_successor] == current_cost[successor]) {
+                    current_count[pos]++;
                 }
             }
 
-            if (current_cost[vertex_map[best_successor]] >= limit) {
-                current_count[vertex_map[pos]] = 0;
+            if (current_cost[best_successor] >= limit) {
+                current_count[pos] = 0;
+            }
+            const long long sum = lifted(current_cost[best_successor], weight[pos]);
+            if (current_cost[pos] < sum) {
                 lifts++;
-                current_cost[vertex_map[pos]] = limit;
-            } else {
-                int sum = current_cost[vertex_map[best_successor]] + graph[pos].weight;
-                if (sum >= limit) {
-                    sum = limit;
-                }
-                if (current_cost[vertex_map[pos]] < sum) {
-                    lifts++;
-                    current_cost[vertex_map[pos]] = sum;
-                }
+                current_cost[pos] = sum;
             }
         } else {
             // Player 0 maximizer
-            const auto [out_edges_begin, out_edges_end] = boost::out_edges(pos, graph);
-            for (const auto &edge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-                const auto successor = boost::target(edge, graph);
-                if (best_successor == boost::graph_traits<graph::Graph>::null_vertex()) {
+            for (const std::size_t successor : successors.neighbours(pos)) {
+                if (best_successor == no_vertex || current_cost[best_successor] < current_cost[successor]) {
                     best_successor = successor;
-                } else {
-                    if (current_cost[vertex_map[best_successor]] < current_cost[vertex_map[successor]]) {
-                        best_successor = successor;
-                    }
                 }
             }
 
-            if (current_cost[vertex_map[best_successor]] >= limit) {
+            const long long sum = lifted(current_cost[best_successor], weight[pos]);
+            if (current_cost[pos] < sum) {
                 lifts++;
-                current_cost[vertex_map[pos]] = limit;
-                current_strategy[vertex_map[pos]] = best_successor;
-            } else {
-                int sum = current_cost[vertex_map[best_successor]] + graph[pos].weight;
-                if (sum >= limit) {
-                    sum = limit;
-                }
-                if (current_cost[vertex_map[pos]] < sum) {
-                    lifts++;
-                    current_cost[vertex_map[pos]] = sum;
-                    current_strategy[vertex_map[pos]] = best_successor;
-                }
+                current_cost[pos] = sum;
+                current_strategy[pos] = best_successor;
             }
         }
 
-        // Propagate to predecessors via in_edges.
-        const auto [in_edges_begin, in_edges_end] = boost::in_edges(pos, graph);
-        for (const auto &in_edge : boost::make_iterator_range(in_edges_begin, in_edges_end)) {
-            const auto predecessor = boost::source(in_edge, graph);
-            if (!b_atr[vertex_map[predecessor]] &&
-                (current_cost[vertex_map[predecessor]] < limit) &&
-                ((current_cost[vertex_map[pos]] == limit) ||
-                 (current_cost[vertex_map[predecessor]] <
-                  current_cost[vertex_map[pos]] + graph[predecessor].weight))) {
-
-                if (graph[predecessor].player) {
-                    if (current_cost[vertex_map[predecessor]] >= old_cost + graph[predecessor].weight) {
-                        current_count[vertex_map[predecessor]]--;
+        // Propagate to predecessors.
+        const long long pos_cost = current_cost[pos];
+        for (const std::size_t predecessor : predecessors.neighbours(pos)) {
+            const long long predecessor_cost = current_cost[predecessor];
+            if (!b_atr[predecessor] &&
+                (predecessor_cost < limit) &&
+                ((pos_cost == limit) || (predecessor_cost < pos_cost + weight[predecessor]))) {
+
+                if (is_player1[predecessor]) {
+                    if (predecessor_cost >= old_cost + weight[predecessor] && current_count[predecessor] > 0) {
+                        current_count[predecessor]--;
                     }
-                    if (current_count[vertex_map[predecessor]] <= 0) {
-                        t_atr.push(predecessor);
-                        b_atr[vertex_map[predecessor]] = true;
+                    if (current_count[predecessor] == 0) {
+                        push(predecessor);
                     }
                 } else {
-                    t_atr.push(predecessor);
-                    b_atr[vertex_map[predecessor]] = true;
+                    push(predecessor);
                 }
             }
         }
     }
 
+    // The choices recorded at lift time can close cycles of weight 0 in
+    // player 0's region.  Player 0 instead follows the least energy measure
+    // on its region, improved until every cycle it allows has positive
+    // weight.
+    const long long top = energy_top(weight);
+    std::vector<long long> credit(n);
+    for (std::size_t v = 0; v < n; ++v) {
+        credit[v] = current_cost[v] >= limit ? 0 : top;
+    }
+    lifts += lift_energy_measure(successors, predecessors, weight, is_player1, top, credit);
+    std::vector<std::size_t> positive_strategy;
+    positive_mean_payoff(successors, weight, is_player1, top, credit, positive_strategy);
+
     // Set the final solution
-    for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
-        // Set the quantitative value (currentCost as int)
-        solution.set_value(vertex, current_cost[vertex_map[vertex]]);
+    for (std::size_t v = 0; v < n; ++v) {
+        solution.set_value(v, current_cost[v]);
 
-        if (current_cost[vertex_map[vertex]] >= limit) {
-            solution.set_winning_player(vertex, 0);
+        if (current_cost[v] >= limit) {
+            solution.set_winning_player(v, 0);
+
+            if (!is_player1[v]) {
+                current_strategy[v] = positive_strategy[v];
+            }
         } else {
-            solution.set_winning_player(vertex, 1);
-
-            if (graph[vertex].player) {
-                const auto [out_edges_begin, out_edges_end] = boost::out_edges(vertex, graph);
-                for (const auto &edge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-                    const auto successor = boost::target(edge, graph);
-                    if (current_cost[vertex_map[successor]] == 0 ||
-                        current_cost[vertex_map[vertex]] >=
-                            current_cost[vertex_map[successor]] + graph[vertex].weight) {
-                        current_strategy[vertex_map[vertex]] = successor;
+            solution.set_winning_player(v, 1);
+
+            // Player 1 keeps to a successor below the limit that bounds the
+            // vertex's cost: every cycle it allows has weight <= 0.
+            if (is_player1[v]) {
+                for (const std::size_t successor : successors.neighbours(v)) {
+                    if (current_cost[successor] < limit &&
+                        current_cost[v] >= current_cost[successor] + weight[v]) {
+                        current_strategy[v] = successor;
                         break;
                     }
                 }
@@ -184,8 +179,8 @@ SolutionType MSESolver::solve(const graph::Graph &graph) {
         }
 
         // Only set strategy if it's a valid vertex
-        if (current_strategy[vertex_map[vertex]] != boost::graph_traits<graph::Graph>::null_vertex()) {
-            solution.set_strategy(vertex, current_strategy[vertex_map[vertex]]);
+        if (current_strategy[v] != no_vertex) {
+            solution.set_strategy(v, current_strategy[v]);
         }
     }
 
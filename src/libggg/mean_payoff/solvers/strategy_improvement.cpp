@@ -0,0 +1,292 @@
+#include "libggg/mean_payoff/solvers/strategy_improvement.hpp"
+#include "libggg/graphs/csr_utilities.hpp"
+#include "libggg/mean_payoff/threshold_search.hpp"
+#include "libggg/utils/logging.hpp"
+#include "libggg/utils/parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <vector>
+
+namespace ggg {
+namespace mean_payoff {
+
+namespace {
+
+// Valuation kinds, ordered from worst to best for player 0.
+constexpr char kMinusInfinity = 0;
+constexpr char kFinite = 1;
+constexpr char kPlusInfinity = 2;
+
+/**
+ * Player 0 strategies of the game with retreats.  Vertex index n stands for
+ * the sink; a player 0 vertex choosing it retreats.  The strategy is kept
+ * between queries, so each query starts from the previous optimum.  The
+ * mirrored game swaps the players and negates the weights, so that its
+ * player 0 is the graph's player 1 and values become -ν.
+ */
+class RetreatGame {
+  public:
+    RetreatGame(const graph::Graph &graph, unsigned threads, bool mirrored = false)
+        : n_(boost::num_vertices(graph)),
+          threads_(threads),
+          successors_(graphs::csr_utilities::make_successors(graph)),
+          predecessors_(graphs::csr_utilities::make_predecessors(graph)),
+          is_player1_(n_),
+          weight_(n_),
+          cost_(n_),
+          sigma_(n_, n_),
+          kind_(n_),
+          distance_(n_),
+          length_(n_),
+          queue_(n_),
+          queued_(n_) {
+        for (std::size_t v = 0; v < n_; ++v) {
+            is_player1_[v] = (graph[v].player != 0) != mirrored;
+            weight_[v] = mirrored ? -static_cast<long long>(graph[v].weight) : graph[v].weight;
+            if (!is_player1_[v]) {
+                player0_.push_back(v);
+            }
+        }
+    }
+
+    long long max_weight() const {
+        long long result = 0;
+        for (const long long w : weight_) {
+            result = std::max(result, std::llabs(w));
+        }
+        return result;
+    }
+
+    /**
+     * Decide ν(v) > p/q (@p strict) or ν(v) >= p/q for every vertex.
+     *
+     * Cycle sums of q·w - p are tested through the costs (n+1)(q·w - p) ∓ 1:
+     * on a cycle of length L <= n the correction is smaller than n+1, so
+     * exactly the cycles that player 0 loses become negative.
+     */
+    void decide(long long numerator, long long denominator, bool strict) {
+        for (std::size_t v = 0; v < n_; ++v) {
+            cost_[v] = __int128(n_ + 1) * (__int128(denominator) * weight_[v] - numerator) + (strict ? -1 : 1);
+        }
+        do {
+            ggg::solvers::throw_if_cancelled();
+            evaluate();
+            iterations_++;
+        } while (improve());
+    }
+
+    bool wins(std::size_t v) const { return kind_[v] == kPlusInfinity; }
+    std::size_t choice(std::size_t v) const { return sigma_[v]; }
+    std::size_t iterations() const { return iterations_; }
+
+  private:
+    std::size_t n_;
+    unsigned threads_;
+    graphs::csr_utilities::CompressedAdjacency successors_;
+    graphs::csr_utilities::CompressedAdjacency predecessors_;
+    std::vector<char> is_player1_;
+    std::vector<long long> weight_;
+    std::vector<__int128> cost_;
+    std::vector<std::size_t> player0_;
+    std::vector<std::size_t> sigma_;
+    std::vector<char> kind_;
+    std::vector<__int128> distance_;
+    std::vector<std::size_t> length_;
+    std::vector<std::size_t> queue_;
+    std::vector<char> queued_;
+    std::size_t head_ = 0;
+    std::size_t size_ = 0;
+    std::size_t iterations_ = 0;
+
+    void push(std::size_t v) {
+        if (!queued_[v]) {
+            queued_[v] = 1;
+            queue_[(head_ + size_++) % n_] = v;
+        }
+    }
+
+    std::size_t pop() {
+        const std::size_t v = queue_[head_];
+        head_ = (head_ + 1) % n_;
+        size_--;
+        queued_[v] = 0;
+        return v;
+    }
+
+    // Whether edge p -> u exists once player 0 is fixed to the strategy.
+    bool follows(std::size_t p, std::size_t u) const { return is_player1_[p] || sigma_[p] == u; }
+
+    void mark_losing(std::size_t vertex) {
+        kind_[vertex] = kMinusInfinity;
+        std::vector<std::size_t> stack{vertex};
+        while (!stack.empty()) {
+            const std::size_t u = stack.back();
+            stack.pop_back();
+            for (const std::size_t p : predecessors_.neighbours(u)) {
+                if (kind_[p] != kMinusInfinity && follows(p, u)) {
+                    kind_[p] = kMinusInfinity;
+                    stack.push_back(p);
+                }
+            }
+        }
+    }
+
+    void evaluate() {
+        // Negative cycles player 1 can reach: shortest walks ending anywhere,
+        // relaxed until a walk needs more than n edges.
+        std::fill(kind_.begin(), kind_.end(), kFinite);
+        std::fill(distance_.begin(), distance_.end(), 0);
+        std::fill(length_.begin(), length_.end(), 0);
+        for (std::size_t v = 0; v < n_; ++v) {
+            push(v);
+        }
+        while (size_ > 0) {
+            ggg::solvers::throw_if_cancelled();
+            const std::size_t u = pop();
+            if (kind_[u] == kMinusInfinity) {
+                continue;
+            }
+            for (const std::size_t p : predecessors_.neighbours(u)) {
+                if (kind_[p] == kMinusInfinity || !follows(p, u)) {
+                    continue;
+                }
+                const __int128 candidate = cost_[p] + distance_[u];
+                if (candidate < distance_[p]) {
+                    distance_[p] = candidate;
+                    length_[p] = length_[u] + 1;
+                    if (length_[p] > n_) {
+                        mark_losing(p);
+                    } else {
+                        push(p);
+                    }
+                }
+            }
+        }
+
+        // Shortest distances to the sink; the rest cannot be forced to leave.
+        for (std::size_t v = 0; v < n_; ++v) {
+            if (kind_[v] == kMinusInfinity) {
+                continue;
+            }
+            kind_[v] = kPlusInfinity;
+            if (!is_player1_[v] && sigma_[v] == n_) {
+                kind_[v] = kFinite;
+                distance_[v] = cost_[v];
+                push(v);
+            }
+        }
+        while (size_ > 0) {
+            ggg::solvers::throw_if_cancelled();
+            const std::size_t u = pop();
+            for (const std::size_t p : predecessors_.neighbours(u)) {
+                if (kind_[p] == kMinusInfinity || !follows(p, u)) {
+                    continue;
+                }
+                const __int128 candidate = cost_[p] + distance_[u];
+                if (kind_[p] == kPlusInfinity || candidate < distance_[p]) {
+                    kind_[p] = kFinite;
+                    distance_[p] = candidate;
+                    push(p);
+                }
+            }
+        }
+    }
+
+    bool better(std::size_t a, std::size_t b) const {
+        const char kind_a = a == n_ ? kFinite : kind_[a];
+        const char kind_b = b == n_ ? kFinite : kind_[b];
+        if (kind_a != kind_b) {
+            return kind_a > kind_b;
+        }
+        return kind_a == kFinite && (a == n_ ? 0 : distance_[a]) > (b == n_ ? 0 : distance_[b]);
+    }
+
+    bool improve() {
+        // Switches only read the valuation, so player 0 vertices are
+        // evaluated and switched independently.
+        std::atomic<std::size_t> switched{0};
+        utils::parallel_for(player0_.size(), [&](std::size_t begin, std::size_t end) {
+            std::size_t local = 0;
+            for (std::size_t i = begin; i < end; ++i) {
+                const std::size_t v = player0_[i];
+                std::size_t best = sigma_[v];
+                for (const std::size_t u : successors_.neighbours(v)) {
+                    if (better(u, best)) {
+                        best = u;
+                    }
+                }
+                if (better(n_, best)) {
+                    best = n_;
+                }
+                if (best != sigma_[v]) {
+                    sigma_[v] = best;
+                    local++;
+                }
+            }
+            switched += local;
+        }, threads_, 1024);
+        return switched > 0;
+    }
+};
+
+} // namespace
+
+SISolutionType StrategyImprovementSolver::solve(const graph::Graph &graph) {
+    LGG_DEBUG("Mean payoff strategy improvement solver starting with ", boost::num_vertices(graph), " vertices");
+
+    SISolutionType solution;
+
+    if (boost::num_vertices(graph) == 0) {
+        LGG_TRACE("Empty game - returning solved");
+        return solution;
+    }
+
+    const std::size_t n = boost::num_vertices(graph);
+    RetreatGame game(graph, threads_);
+
+    // Winning regions and a winning strategy for player 0: ν > 0.
+    game.decide(0, 1, true);
+    for (std::size_t v = 0; v < n; ++v) {
+        if (graph[v].player == 0 && game.wins(v)) {
+            solution.set_strategy(v, game.choice(v));
+        }
+    }
+
+    // Player 1 wins where ν <= 0, i.e. where -ν >= 0 in the mirrored game,
+    // whose winning strategy for its player 0 is one for player 1.
+    {
+        RetreatGame mirrored(graph, threads_, true);
+        mirrored.decide(0, 1, false);
+        for (std::size_t v = 0; v < n; ++v) {
+            if (graph[v].player != 0 && mirrored.wins(v)) {
+                solution.set_strategy(v, mirrored.choice(v));
+            }
+        }
+    }
+
+    std::size_t queries = 2;
+    const auto values = search_values_by_thresholds(n, game.max_weight(), [&](const std::vector<utils::Fraction> &thresholds) {
+        std::vector<std::vector<char>> at_least(thresholds.size(), std::vector<char>(n));
+        for (std::size_t i = 0; i < thresholds.size(); ++i) {
+            game.decide(static_cast<long long>(thresholds[i].num), static_cast<long long>(thresholds[i].den), false);
+            for (std::size_t v = 0; v < n; ++v) {
+                at_least[i][v] = game.wins(v);
+            }
+        }
+        queries += thresholds.size();
+        return at_least;
+    });
+
+    for (std::size_t v = 0; v < n; ++v) {
+        solution.set_value(v, values[v]);
+        solution.set_winning_player(v, values[v] > 0 ? 0 : 1);
+    }
+
+    LGG_TRACE("Solved with ", game.iterations(), " improvement rounds over ", queries, " threshold queries");
+
+    return solution;
+}
+
+} // namespace mean_payoff
+} // namespace ggg
@@ -0,0 +1,380 @@
+#include "libggg/mean_payoff/solvers/zwick_paterson.hpp"
+#include "libggg/graphs/csr_utilities.hpp"
+#include "libggg/mean_payoff/verifier.hpp"
+#include "libggg/utils/fraction.hpp"
+#include "libggg/utils/logging.hpp"
+#include "libggg/utils/parallel.hpp"
+#include <algorithm>
+#include <barrier>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace ggg {
+namespace mean_payoff {
+
+namespace {
+
+// Checks whether the positional strategies in @p choice (one successor per
+// vertex, player 0's and player 1's alike) are optimal.  The candidate value
+// of a vertex is the mean of the cycle the two strategies reach from it.
+// Player 0's choices guarantee at least the candidate if candidates never
+// decrease along the edges left to player 1 and no cycle within a candidate
+// class has a smaller mean; symmetrically for player 1.  Both together make
+// the candidates the exact values.
+//
+// Greedy choices of one round need not pass when plays are periodic: which
+// cycle a k-step optimum enters depends on k.  A failed check lets the
+// opponent of the player that is not held to its candidate improve, as in
+// policy iteration: to a successor of better candidate, or of the same
+// candidate and better bias.  Only passing the check certifies the result.
+class Certificate {
+  public:
+    Certificate(const graphs::csr_utilities::CompressedAdjacency &successors, const std::vector<long long> &weight,
+                const std::vector<char> &is_player1)
+        : successors_(successors), weight_(weight), is_player1_(is_player1), n_(weight.size()) {}
+
+    /**
+     * @brief Check @p choice, improving it up to @p max_steps times
+     * @return Whether a check passed; the candidates are then left in
+     *         @p num / @p den in lowest terms, and the choices in @p choice
+     */
+    bool check(std::vector<std::size_t> &choice, std::vector<long long> &num, std::vector<long long> &den,
+               std::size_t max_steps) {
+        for (std::size_t step = 0;; ++step) {
+            evaluate(choice, num, den);
+            const bool lower = guarantees(choice, num, den, 0);
+            const bool upper = guarantees(choice, num, den, 1);
+            if (lower && upper) {
+                return true;
+            }
+            if (step == max_steps) {
+                return false;
+            }
+            bool changed = false;
+            if (!lower) {
+                changed = improve(choice, num, den, 1) || changed;
+            }
+            if (!upper) {
+                changed = improve(choice, num, den, 0) || changed;
+            }
+            if (!changed) {
+                return false;
+            }
+        }
+    }
+
+  private:
+    // Mean of the cycle reached from every vertex in the graph of @p choice,
+    // and the bias q·(weight of the path to the cycle) - p·(its length),
+    // relative to one vertex of the cycle.
+    void evaluate(const std::vector<std::size_t> &choice, std::vector<long long> &num, std::vector<long long> &den) {
+        enum : char { unvisited, on_path, finished };
+        std::vector<char> state(n_, unvisited);
+        std::vector<std::size_t> path;
+        num.assign(n_, 0);
+        den.assign(n_, 1);
+        bias_.assign(n_, 0);
+        for (std::size_t start = 0; start < n_; ++start) {
+            path.clear();
+            std::size_t v = start;
+            while (state[v] == unvisited) {
+                state[v] = on_path;
+                path.push_back(v);
+                v = choice[v];
+            }
+            std::size_t tail = path.size();
+            if (state[v] == on_path) {
+                // v closes a new cycle: the path from v on, with bias 0 at v.
+                const std::size_t first = static_cast<std::size_t>(std::find(path.begin(), path.end(), v) - path.begin());
+                tail = first;
+                long long sum = 0;
+                for (std::size_t i = first; i < path.size(); ++i) {
+                    sum += weight_[path[i]];
+                }
+                const long long length = static_cast<long long>(path.size() - first);
+                const long long divisor = std::gcd(sum, length);
+                for (std::size_t i = first; i < path.size(); ++i) {
+                    num[path[i]] = sum / divisor;
+                    den[path[i]] = length / divisor;
+                    state[path[i]] = finished;
+                }
+                for (std::size_t i = path.size(); --i > first;) {
+                    const std::size_t u = path[i];
+                    bias_[u] = den[u] * weight_[u] - num[u] + bias_[choice[u]];
+                }
+            }
+            for (std::size_t i = tail; i-- > 0;) {
+                const std::size_t u = path[i];
+                if (state[u] == finished) {
+                    continue;
+                }
+                num[u] = num[choice[u]];
+                den[u] = den[choice[u]];
+                bias_[u] = den[u] * weight_[u] - num[u] + bias_[choice[u]];
+                state[u] = finished;
+            }
+        }
+    }
+
+    // One policy-iteration step for @p player's choices; whether any changed.
+    bool improve(std::vector<std::size_t> &choice, const std::vector<long long> &num, const std::vector<long long> &den,
+                 int player) const {
+        const int sign = player == 0 ? 1 : -1;
+        bool changed = false;
+        for (std::size_t v = 0; v < n_; ++v) {
+            if (is_player1_[v] != (player != 0)) {
+                continue;
+            }
+            // The current choice has v's own candidate, so its bias is v's.
+            std::size_t best = choice[v];
+            long long best_through = bias_[v];
+            for (const std::size_t u : successors_.neighbours(v)) {
+                const __int128 gain = sign * (__int128(num[u]) * den[best] - __int128(num[best]) * den[u]);
+                if (gain > 0) {
+                    best = u;
+                    best_through = 0;
+                } else if (gain == 0 && num[u] == num[v] && den[u] == den[v]) {
+                    const long long through = den[v] * weight_[v] - num[v] + bias_[u];
+                    if (num[best] == num[v] && den[best] == den[v] && sign * (through - best_through) > 0) {
+                        best = u;
+                        best_through = through;
+                    }
+                }
+            }
+            if (best != choice[v]) {
+                choice[v] = best;
+                changed = true;
+            }
+        }
+        return changed;
+    }
+
+    // Whether @p player's choices hold every play to the candidate value.
+    bool guarantees(const std::vector<std::size_t> &choice, const std::vector<long long> &num, const std::vector<long long> &den,
+                    int player) const {
+        // Positive when u's candidate is better than v's for the opponent.
+        const auto compare = [&](std::size_t v, std::size_t u) {
+            const __int128 diff = __int128(num[u]) * den[v] - __int128(num[v]) * den[u];
+            return player == 0 ? -diff : diff;
+        };
+        graphs::csr_utilities::CompressedAdjacency same;
+        same.offsets.assign(1, 0);
+        for (std::size_t v = 0; v < n_; ++v) {
+            const auto edge = [&](std::size_t u) {
+                const __int128 order = compare(v, u);
+                if (order == 0) {
+                    same.targets.push_back(u);
+                }
+                return order <= 0;
+            };
+            if (is_player1_[v] == (player != 0)) {
+                if (!edge(choice[v])) {
+                    return false;
+                }
+            } else {
+                for (const std::size_t u : successors_.neighbours(v)) {
+                    if (!edge(u)) {
+                        return false;
+                    }
+                }
+            }
+            same.offsets.push_back(same.targets.size());
+        }
+        // Within a class of value p/q, a cycle the opponent prefers has
+        // negative weight for q·w - p (player 0) or p - q·w (player 1).
+        const auto cost = [&](std::size_t v) {
+            const long long scaled = den[v] * weight_[v] - num[v];
+            return player == 0 ? scaled : -scaled;
+        };
+        std::vector<std::int64_t> distance;
+        return !detail::find_negative_cycle(same, cost, distance);
+    }
+
+    const graphs::csr_utilities::CompressedAdjacency &successors_;
+    const std::vector<long long> &weight_;
+    const std::vector<char> &is_player1_;
+    std::size_t n_;
+    std::vector<long long> bias_;
+};
+
+} // namespace
+
+ZPSolutionType ZwickPatersonSolver::solve(const graph::Graph &graph) {
+    LGG_DEBUG("Mean payoff Zwick-Paterson solver starting with ", boost::num_vertices(graph), " vertices");
+
+    ZPSolutionType solution;
+
+    if (boost::num_vertices(graph) == 0) {
+        LGG_TRACE("Empty game - returning solved");
+        return solution;
+    }
+
+    const std::size_t n = boost::num_vertices(graph);
+    const auto successors = graphs::csr_utilities::make_successors(graph);
+
+    std::vector<long long> weight(n);
+    std::vector<char> is_player1(n);
+    long long max_weight = 1;
+    for (std::size_t v = 0; v < n; ++v) {
+        weight[v] = graph[v].weight;
+        is_player1[v] = graph[v].player != 0;
+        max_weight = std::max(max_weight, std::llabs(weight[v]));
+    }
+
+    // |v_k − k·ν| <= 2nW.  The Farey gap around any fraction of order n is at
+    // least 2/n wide, so no interval can isolate a value before round 2n²W;
+    // this bound is only the fallback.  From a short warm-up on, the greedy
+    // choices of the round are checked for optimality instead (see
+    // Certificate), on rounds growing by 1/8 each time, which costs at most
+    // ~12% extra rounds but keeps checks rare.
+    const __int128 slack = __int128(2) * n * max_weight;
+    const __int128 isolating_from = slack * n + 1;
+    long long next_check = 16;
+    // Certificate weights stay within 2nW in absolute value, paths within n
+    // edges; v_k stays within k·W.
+    const bool certifiable = slack * n < std::numeric_limits<std::int64_t>::max();
+    // Improvement steps per check: a few during the rounds, more at the end.
+    constexpr std::size_t check_steps = 8;
+    constexpr std::size_t final_steps = 64;
+    const long long max_rounds = std::numeric_limits<long long>::max() / max_weight;
+    Certificate certificate(successors, weight, is_player1);
+
+    std::vector<long long> current(n, 0);
+    std::vector<long long> next(n, 0);
+    std::vector<std::size_t> choice(n);
+    std::vector<char> stable(n, 0);
+    std::vector<boost::rational<long long>> value(n);
+    std::vector<long long> num;
+    std::vector<long long> den;
+
+    const std::size_t workers = std::min<std::size_t>(utils::thread_count(threads_), std::max<std::size_t>(1, n / 256));
+    std::vector<std::size_t> stabilised(workers, 0);
+    std::size_t remaining = n;
+    long long round = 0;
+    bool done = false;
+    bool certified = false;
+    bool cancelled = false; // set by worker 0, which runs on the solving thread
+    bool overflow = false;
+    std::exception_ptr error; // thrown by worker 0 while checking a certificate
+
+    // Runs once per round after all blocks are gathered: swap buffers, count progress.
+    const auto end_of_round = [&]() noexcept {
+        for (auto &count : stabilised) {
+            remaining -= count;
+            count = 0;
+        }
+        current.swap(next);
+        ++round;
+        overflow = round == max_rounds;
+        done = remaining == 0 || cancelled || overflow;
+        if (round == next_check) {
+            next_check += std::max(1LL, next_check / 8);
+        }
+    };
+    std::barrier sync(static_cast<std::ptrdiff_t>(workers), end_of_round);
+    std::barrier checked(static_cast<std::ptrdiff_t>(workers));
+
+    const auto work = [&](std::size_t worker) {
+        const std::size_t begin = n * worker / workers;
+        const std::size_t end = n * (worker + 1) / workers;
+        while (!done) {
+            const long long k = round + 1;
+            const bool check = k == next_check;
+            for (std::size_t v = begin; v < end; ++v) {
+                const auto range = successors.neighbours(v);
+                std::size_t best = range.front();
+                for (const std::size_t u : range.subspan(1)) {
+                    if (is_player1[v] ? current[u] < current[best] : current[u] > current[best]) {
+                        best = u;
+                    }
+                }
+                next[v] = weight[v] + current[best];
+                choice[v] = best;
+            }
+
+            if (check && k >= isolating_from) {
+                for (std::size_t v = begin; v < end; ++v) {
+                    if (stable[v]) {
+                        continue;
+                    }
+                    const utils::Fraction lo{__int128(next[v]) - slack, k};
+                    const utils::Fraction hi{__int128(next[v]) + slack, k};
+                    utils::Fraction candidate;
+                    if (utils::unique_of_order(lo, hi, static_cast<long long>(n), false, candidate)) {
+                        value[v] = candidate.to_rational();
+                        stable[v] = 1;
+                        ++stabilised[worker];
+                    }
+                }
+            }
+
+            if (worker == 0) {
+                cancelled = ggg::solvers::cancellation_requested();
+            }
+            sync.arrive_and_wait();
+
+            if (check) {
+                if (worker == 0 && !done && certifiable) {
+                    try {
+                        certified = certificate.check(choice, num, den, check_steps);
+                        done = certified;
+                    } catch (...) {
+                        error = std::current_exception();
+                        done = true;
+                    }
+                }
+                checked.arrive_and_wait();
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(workers - 1);
+    for (std::size_t worker = 1; worker < workers; ++worker) {
+        pool.emplace_back(work, worker);
+    }
+    work(0);
+    for (auto &thread : pool) {
+        thread.join();
+    }
+    if (cancelled) {
+        throw ggg::solvers::Cancelled();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    // Values isolated by the fallback bound come with the last round's
+    // choices, which are optimal if they, or their improvements, pass the
+    // check.
+    if (!certified && certifiable) {
+        certified = certificate.check(choice, num, den, final_steps);
+    }
+    if (overflow && !certified && remaining > 0) {
+        throw std::overflow_error("Zwick-Paterson values exceed 64 bits");
+    }
+    for (std::size_t v = 0; v < n; ++v) {
+        if (certified) {
+            value[v] = boost::rational<long long>(num[v], den[v]);
+        }
+        solution.set_value(v, value[v]);
+        const int winner = value[v] > 0 ? 0 : 1;
+        solution.set_winning_player(v, winner);
+        if (certified && is_player1[v] == (winner != 0)) {
+            solution.set_strategy(v, choice[v]);
+        }
+    }
+
+    LGG_TRACE("Solved with ", round, " rounds on ", workers, " threads", certified ? " (certified)" : "");
+
+    return solution;
+}
+
+} // namespace mean_payoff
+} // namespace ggg
@@ -0,0 +1,43 @@
+#include "libggg/parity/solvers/portfolio.hpp"
+#include "libggg/parity/solvers/priority_promotion.hpp"
+#include "libggg/parity/solvers/progressive_small_progress_measures.hpp"
+#include "libggg/parity/solvers/recursive.hpp"
+#include "libggg/parity/verifier.hpp"
+#include <stdexcept>
+
+namespace ggg {
+namespace parity {
+
+ParityPortfolioSolver::ParityPortfolioSolver() : ParityPortfolioSolver(available()) {}
+
+ParityPortfolioSolver::ParityPortfolioSolver(const std::vector<std::string> &solvers) {
+    for (const auto &solver : solvers) {
+        if (solver == "priority_promotion" || solver == "pp") {
+            add("priority_promotion", make_run<PriorityPromotionSolver>());
+        } else if (solver == "progressive_small_progress_measures" || solver == "spm") {
+            add("progressive_small_progress_measures", make_run<ProgressiveSmallProgressMeasuresSolver>());
+        } else if (solver == "recursive") {
+            add("recursive", make_run<RecursiveParitySolver>());
+        } else {
+            throw std::invalid_argument("unknown parity solver '" + solver + "' for the portfolio");
+        }
+    }
+    check_with([](const graph::Graph &graph, const ParityPortfolioSolution &solution) {
+        if (const auto verification = verify(graph, solution); !verification) {
+            throw std::runtime_error("solution rejected: " + verification.reason);
+        }
+    });
+}
+
+ParityPortfolioSolution ParityPortfolioSolver::solve(const graph::Graph &graph) {
+    auto solution = PortfolioSolver::solve(graph);
+    solution.set_winner(winner());
+    return solution;
+}
+
+std::vector<std::string> ParityPortfolioSolver::available() {
+    return {"priority_promotion", "progressive_small_progress_measures", "recursive"};
+}
+
+} // namespace parity
+} // namespace ggg
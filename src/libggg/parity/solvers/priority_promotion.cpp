@@ -55,6 +55,7 @@ PriorityPromotionSolver::Solution PriorityPromotionSolver::solve(const Graph &gr
      */
 
     while (i < static_cast<int>(sorted_vertices_.size())) {
+        ggg::solvers::throw_if_cancelled();
         // Get current priority and skip all disabled/attracted vertices
         int p = get_original_priority(sorted_vertices_[i]);
 
@@ -83,6 +84,7 @@ PriorityPromotionSolver::Solution PriorityPromotionSolver::solve(const Graph &gr
         if (setup_region(i, p, true)) {
             // Region not empty, maybe promote
             while (true) {
+                ggg::solvers::throw_if_cancelled();
                 int status = get_region_status(i, p);
                 if (status == -2) {
                     // Not closed, skip to next priority and break inner loop
@@ -26,6 +26,7 @@ ggg::solutions::RSSolution<graph::Graph> ProgressiveSmallProgressMeasuresSolver:
 
     auto vertices = boost::vertices(*pv);
     for (auto vertex_it = vertices.first; vertex_it != vertices.second; ++vertex_it) {
+        ggg::solvers::throw_if_cancelled();
         auto vertex = *vertex_it;
         int node = vertex_to_node(*pv, vertex);
         counts[(*pv)[vertex].priority]++;
@@ -38,6 +39,7 @@ ggg::solutions::RSSolution<graph::Graph> ProgressiveSmallProgressMeasuresSolver:
     lift_count = lift_attempt = 0;
 
     for (int n = boost::num_vertices(*pv) - 1; n >= 0; n--) {
+        ggg::solvers::throw_if_cancelled();
         if (lift(n, -1)) {
             auto vertex = node_to_vertex(*pv, n);
             const auto [in_edges_begin, in_edges_end] = boost::in_edges(vertex, *pv);
@@ -54,6 +56,7 @@ ggg::solutions::RSSolution<graph::Graph> ProgressiveSmallProgressMeasuresSolver:
     int64_t last_update = 0;
 
     while (!todo.empty()) {
+        ggg::solvers::throw_if_cancelled();
         int n = todo_pop();
         auto vertex = node_to_vertex(*pv, n);
 
@@ -76,6 +79,7 @@ ggg::solutions::RSSolution<graph::Graph> ProgressiveSmallProgressMeasuresSolver:
     ggg::solutions::RSSolution<graph::Graph> solution;
 
     for (auto vertex_it = vertices.first; vertex_it != vertices.second; ++vertex_it) {
+        ggg::solvers::throw_if_cancelled();
         auto vertex = *vertex_it;
         int node = vertex_to_node(*pv, vertex);
         int *pm = pms.data() + k * node;
@@ -293,6 +297,7 @@ void ProgressiveSmallProgressMeasuresSolver::update(int pl) {
     std::queue<int> q;
 
     for (int i = 0; i < boost::num_vertices(*pv); i++) {
+        ggg::solvers::throw_if_cancelled();
         unstable[i] = 0;
         if (pms[k * i + pl] == -1 || canlift(i, pl)) {
             unstable[i] = 1;
@@ -301,6 +306,7 @@ void ProgressiveSmallProgressMeasuresSolver::update(int pl) {
     }
 
     while (!q.empty()) {
+        ggg::solvers::throw_if_cancelled();
         int n = q.front();
         q.pop();
         auto vertex = node_to_vertex(*pv, n);
@@ -346,6 +352,7 @@ void ProgressiveSmallProgressMeasuresSolver::update(int pl) {
     }
 
     for (int i = 0; i < boost::num_vertices(*pv); i++) {
+        ggg::solvers::throw_if_cancelled();
         if (unstable[i] == 0 && pms[k * i + 1 - pl] != -1) {
             auto vertex = node_to_vertex(*pv, i);
             if (((*pv)[vertex].priority & 1) != pl) {
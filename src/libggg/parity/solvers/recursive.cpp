@@ -51,6 +51,7 @@ RecursiveParitySolution RecursiveParitySolver::solve(const graph::Graph &graph)
 }
 
 RecursiveParitySolution RecursiveParitySolver::solve_internal(const graph::Graph &graph, size_t depth) {
+    ggg::solvers::throw_if_cancelled();
     current_depth_ = depth;
     if (enable_statistics_ && depth > max_reached_depth_) {
         max_reached_depth_ = depth;
@@ -4,50 +4,62 @@
 #include <cmath>
 #include <limits>
 #include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace ggg {
 namespace stochastic_discounted {
 
 namespace g = ggg::stochastic_discounted::graph;
 using graphs_t = g::Graph;
+using Policy = NumericPolicy<double>;
+
+namespace {
+
+// std::mt19937_64's output is fixed by the standard, but the distributions
+// and std::shuffle are not, so draws are derived from gen() directly: runs
+// with the same seed are identical across standard libraries.
+
+// A fair coin: the top bit of one draw.
+bool draw_coin(std::mt19937_64 &gen) {
+    return (gen() >> 63) != 0;
+}
+
+// An index below @p bound (> 0): the high word of draw × bound.
+std::size_t draw_below(std::mt19937_64 &gen, std::size_t bound) {
+    return static_cast<std::size_t>((static_cast<unsigned __int128>(gen()) * bound) >> 64);
+}
+
+// Fisher–Yates shuffle.
+template <typename T>
+void shuffle(std::vector<T> &items, std::mt19937_64 &gen) {
+    for (std::size_t i = items.size(); i > 1; --i) {
+        std::swap(items[i - 1], items[draw_below(gen, i)]);
+    }
+}
+
+} // namespace
 
 bool StochasticDiscountedObjectiveSolver::switch_str(const graphs_t &graph) {
     bool no_switch = true;
     for (const auto &vertex : g::get_non_probabilistic_vertices(graph)) {
-        const auto old_edge = boost::edge(vertex, strategy[vertex], graph);
-        double oldval = graph[old_edge.first].weight;
-        const auto reach = g::get_reachable_through_probabilistic(
-            graph, vertex, strategy[vertex]);
-        for (const auto &[target, prob] : reach) {
-            oldval += prob * graph[old_edge.first].discount * sol[target];
-        }
-
-        const auto [out_edges_begin, out_edges_end] = boost::out_edges(vertex,
-                                                                       graph);
-        for (const auto &gedge :
-             boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-            const auto successor = boost::target(gedge, graph);
-            if (successor == strategy[vertex]) {
+        const double oldval = choices.value(strategy[vertex], sol);
+        for (std::size_t c = choices.first_choice(vertex); c < choices.end_choice(vertex); ++c) {
+            if (c == strategy[vertex]) {
                 continue;
             }
 
-            const auto new_edge = boost::edge(vertex, successor, graph);
-            double newval = graph[new_edge.first].weight;
-            const auto reach2 = g::get_reachable_through_probabilistic(
-                graph, vertex, successor);
-            for (const auto &[target, prob] : reach2) {
-                newval += prob * graph[new_edge.first].discount * sol[target];
-            }
-
+            const double newval = choices.value(c, sol);
             if (graph[vertex].player == 0) {
-                if (oldval + 1e-6 < newval) {
-                    strategy[vertex] = successor;
+                if (oldval + Policy::improvement_tolerance() < newval) {
+                    strategy[vertex] = c;
                     switches++;
                     no_switch = false;
                 }
             } else {
-                if (oldval > newval + 1e-6) {
-                    strategy[vertex] = successor;
+                if (oldval > newval + Policy::improvement_tolerance()) {
+                    strategy[vertex] = c;
                     switches++;
                     no_switch = false;
                 }
@@ -57,52 +69,30 @@ bool StochasticDiscountedObjectiveSolver::switch_str(const graphs_t &graph) {
     return no_switch;
 }
 
-int StochasticDiscountedObjectiveSolver::setup_matrix_rows(
-    const graphs_t &graph,
-    std::vector<std::vector<double>> &matrix_coeff,
-    std::vector<double> &obj_coeff_up,
-    std::vector<double> &obj_coeff_low,
-    std::vector<double> &var_up,
-    std::vector<double> &var_low) {
-    int row = 0;
-    var_up.resize(num_real_vertices);
-    var_low.resize(num_real_vertices);
-    for (size_t i = 0; i < num_real_vertices; ++i) {
-        var_low[i] = -1e100;
-        var_up[i] = 1e100;
-    }
-
+void StochasticDiscountedObjectiveSolver::setup_matrix_rows(const graphs_t &graph,
+                                                           utils::RevisedSimplex &lp) {
+    std::vector<utils::RevisedSimplex::Entry> row;
     for (const auto &vertex : g::get_non_probabilistic_vertices(graph)) {
-        const auto [out_edges_begin, out_edges_end] = boost::out_edges(vertex,
-                                                                       graph);
-        for (const auto &gedge :
-             boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-            std::fill(matrix_coeff[row].begin(), matrix_coeff[row].end(), 0.0);
-            const auto successor = boost::target(gedge, graph);
-            const auto curre = boost::edge(vertex, successor, graph);
-            if (graph[vertex].player == 0) {
-                obj_coeff_up[row] = std::numeric_limits<double>::infinity();
-                obj_coeff_low[row] = graph[curre.first].weight;
-            } else {
-                obj_coeff_up[row] = graph[curre.first].weight;
-                obj_coeff_low[row] = -std::numeric_limits<double>::infinity();
-            }
-            const auto reach =
-                g::get_reachable_through_probabilistic(graph, vertex, successor);
-            matrix_coeff[row][matrixMap[vertex]] = 1.0;
-            for (const auto &[target, prob] : reach) {
-                if (target == vertex) {
-                    matrix_coeff[row][matrixMap[target]] =
-                        1.0 - prob * graph[curre.first].discount;
+        for (std::size_t c = choices.first_choice(vertex); c < choices.end_choice(vertex); ++c) {
+            row.clear();
+            double diagonal = 1.0;
+            const auto columns = choices.row_columns(c);
+            const auto coefficients = choices.row_coefficients(c);
+            for (std::size_t k = 0; k < columns.size(); ++k) {
+                if (columns[k] == vertex) {
+                    diagonal -= coefficients[k];
                 } else {
-                    matrix_coeff[row][matrixMap[target]] =
-                        -prob * graph[curre.first].discount;
+                    row.push_back({matrixMap[columns[k]], -coefficients[k]});
                 }
             }
-            row++;
+            row.push_back({matrixMap[vertex], diagonal});
+            if (graph[vertex].player == 0) {
+                lp.add_row(row, choices.reward[c], utils::RevisedSimplex::kInfinity);
+            } else {
+                lp.add_row(row, -utils::RevisedSimplex::kInfinity, choices.reward[c]);
+            }
         }
     }
-    return row;
 }
 
 void StochasticDiscountedObjectiveSolver::calculate_obj_coefficients(
@@ -112,38 +102,36 @@ void StochasticDiscountedObjectiveSolver::calculate_obj_coefficients(
     std::fill(obj_coeff.begin(), obj_coeff.end(), 0.0);
 
     for (const auto &vertex : g::get_non_probabilistic_vertices(graph)) {
-        const auto curre = boost::edge(vertex, strategy[vertex], graph);
-        const auto reach = g::get_reachable_through_probabilistic(
-            graph, vertex, strategy[vertex]);
+        const std::size_t c = strategy[vertex];
+        const auto columns = choices.row_columns(c);
+        const auto coefficients = choices.row_coefficients(c);
 
         if (graph[vertex].player == 0) {
             obj_coeff[matrixMap[vertex]] += 1.0;
-            for (const auto &[target, prob] : reach) {
-                obj_coeff[matrixMap[target]] +=
-                    -prob * graph[curre.first].discount;
+            for (std::size_t k = 0; k < columns.size(); ++k) {
+                obj_coeff[matrixMap[columns[k]]] += -coefficients[k];
             }
-            cff += -graph[curre.first].weight;
+            cff += -choices.reward[c];
         } else {
             obj_coeff[matrixMap[vertex]] += -1.0;
-            for (const auto &[target, prob] : reach) {
-                obj_coeff[matrixMap[target]] +=
-                    prob * graph[curre.first].discount;
+            for (std::size_t k = 0; k < columns.size(); ++k) {
+                obj_coeff[matrixMap[columns[k]]] += coefficients[k];
             }
-            cff += graph[curre.first].weight;
+            cff += choices.reward[c];
         }
     }
 }
 
 void StochasticDiscountedObjectiveSolver::solve_simplex(
-    Simplex &solver,
+    utils::RevisedSimplex &lp,
     std::vector<double> &sol_vec,
     double &obj) {
-    while (solver.remove_artificial_variables()) {
-    }
-    while (solver.calculate_simplex()) {
-        lpiter++;
+    if (lp.solve() != utils::LPStatus::Optimal) {
+        throw std::runtime_error("objective improvement LP has no optimal solution");
     }
-    solver.get_full_results(sol_vec, obj, true);
+    lpiter = lp.iterations();
+    sol_vec = lp.values();
+    obj = lp.objective();
 }
 
 auto StochasticDiscountedObjectiveSolver::solve(const graphs_t &graph)
@@ -161,52 +149,34 @@ auto StochasticDiscountedObjectiveSolver::solve(const graphs_t &graph)
     lpiter = 0;
     stales = 0;
 
+    choices = make_choice_matrix(graph);
+
     const auto [vertices_begin, vertices_end] = boost::vertices(graph);
-    matrixMap.clear();
+    const std::size_t num_vertices = boost::num_vertices(graph);
+    matrixMap.assign(num_vertices, 0);
     reverseMap.clear();
-    int reindex = 0;
 
     for (const auto &vertex : g::get_non_probabilistic_vertices(graph)) {
-        matrixMap[vertex] = reindex;
-        reverseMap[reindex] = vertex;
-        ++reindex;
+        matrixMap[vertex] = reverseMap.size();
+        reverseMap.push_back(vertex);
     }
 
-    strategy.clear();
-    sol.clear();
+    // Every player vertex starts on its first choice.
+    strategy.resize(num_vertices);
+    sol.assign(num_vertices, 0.0);
     obj_coeff.clear();
 
     for (const auto &vertex : boost::make_iterator_range(vertices_begin,
                                                          vertices_end)) {
-        const auto [out_begin, out_end] = boost::out_edges(vertex, graph);
-        if (out_begin != out_end) {
-            strategy[vertex] = boost::target(*out_begin, graph);
-        } else {
-            strategy[vertex] = static_cast<int>(boost::graph_traits<graphs_t>::null_vertex());
-        }
-        sol[vertex] = 0.0;
-    }
-
-    int edges = 0;
-    for (const auto &vertex : g::get_non_probabilistic_vertices(graph)) {
-        const auto [out_edges_begin, out_edges_end] =
-            boost::out_edges(vertex, graph);
-        edges += std::distance(out_edges_begin, out_edges_end);
+        strategy[vertex] = choices.first_choice(vertex);
     }
 
     num_real_vertices = boost::distance(
         g::get_non_probabilistic_vertices(graph));
 
-    std::vector<std::vector<double>> matrix_coeff(
-        edges, std::vector<double>(num_real_vertices));
-    std::vector<double> obj_coeff_up(edges);
-    std::vector<double> obj_coeff_low(edges);
+    utils::RevisedSimplex lp(num_real_vertices);
+    setup_matrix_rows(graph, lp);
     obj_coeff.resize(num_real_vertices);
-    std::vector<double> var_up;
-    std::vector<double> var_low;
-
-    setup_matrix_rows(graph, matrix_coeff, obj_coeff_up, obj_coeff_low, var_up,
-                      var_low);
 
     calculate_obj_coefficients(graph, obj_coeff);
     std::vector<double> n_obj_coeff(num_real_vertices);
@@ -216,12 +186,8 @@ auto StochasticDiscountedObjectiveSolver::solve(const graphs_t &graph)
 
     double obj = 0.0;
     std::vector<double> sol_vec(num_real_vertices);
-    Simplex solver(matrix_coeff, obj_coeff_low, obj_coeff_up, var_low, var_up,
-                   n_obj_coeff);
-    solve_simplex(solver, sol_vec, obj);
-
-    // Optionally purge artificial columns after first phase
-    solver.purge_artificial_columns();
+    lp.set_objective(n_obj_coeff);
+    solve_simplex(lp, sol_vec, obj);
 
     for (size_t i = 0; i < sol_vec.size(); ++i) {
         sol[reverseMap[i]] = sol_vec[i];
@@ -232,9 +198,12 @@ auto StochasticDiscountedObjectiveSolver::solve(const graphs_t &graph)
     }
 
     bool stale = false;
-    std::map<graphs_t::vertex_descriptor, std::vector<int>> stale_str;
+    std::vector<std::vector<std::size_t>> stale_str(num_vertices);
+    // Stalls are broken by a generator seeded per solve, so that runs are reproducible.
+    std::mt19937_64 gen(seed_);
 
-    while (!stale && (obj + cff > 1e-8)) {
+    while (!stale && (obj + cff > Policy::objective_tolerance())) {
+        ggg::solvers::throw_if_cancelled();
         stale = switch_str(graph);
 
         if (stale) {
@@ -244,32 +213,15 @@ auto StochasticDiscountedObjectiveSolver::solve(const graphs_t &graph)
             int nr_stale_vertices = 0;
             for (const auto &vertex : g::get_non_probabilistic_vertices(graph)) {
                 stale_str[vertex].clear();
-                const auto old_edge = boost::edge(vertex, strategy[vertex], graph);
-                double oldval = graph[old_edge.first].weight;
-                const auto reach = g::get_reachable_through_probabilistic(
-                    graph, vertex, strategy[vertex]);
-                for (const auto &[target, prob] : reach) {
-                    oldval += prob * graph[old_edge.first].discount * sol[target];
-                }
-                const auto [out_edges_begin, out_edges_end] =
-                    boost::out_edges(vertex, graph);
-                for (const auto &gedge :
-                     boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-                    const auto successor = boost::target(gedge, graph);
-                    if (successor == strategy[vertex]) {
+                const double oldval = choices.value(strategy[vertex], sol);
+                for (std::size_t c = choices.first_choice(vertex); c < choices.end_choice(vertex); ++c) {
+                    if (c == strategy[vertex]) {
                         continue;
                     }
-                    const auto new_edge = boost::edge(vertex, successor, graph);
-                    double newval = graph[new_edge.first].weight;
-                    const auto reach2 =
-                        g::get_reachable_through_probabilistic(graph, vertex,
-                                                               successor);
-                    for (const auto &[target, prob] : reach2) {
-                        newval += prob * graph[new_edge.first].discount * sol[target];
-                    }
+                    const double newval = choices.value(c, sol);
                     double stalevalue = oldval - newval;
-                    if (std::abs(stalevalue) < 1e-8) {
-                        stale_str[vertex].push_back(successor);
+                    if (std::abs(stalevalue) < Policy::objective_tolerance()) {
+                        stale_str[vertex].push_back(c);
                     }
                 }
                 if (!stale_str[vertex].empty()) {
@@ -278,20 +230,16 @@ auto StochasticDiscountedObjectiveSolver::solve(const graphs_t &graph)
             }
 
             if (nr_stale_vertices > 0) {
-                std::random_device rd;
-                std::mt19937 gen(rd());
-                std::bernoulli_distribution dist(0.5);
-
-                std::vector<bool> draws(nr_stale_vertices);
+                std::vector<char> draws(nr_stale_vertices);
                 bool has_true = false;
                 for (int i = 0; i < nr_stale_vertices - 1; ++i) {
-                    draws[i] = dist(gen);
+                    draws[i] = draw_coin(gen);
                     if (draws[i]) {
                         has_true = true;
                     }
                 }
-                draws[nr_stale_vertices - 1] = has_true ? dist(gen) : true;
-                std::shuffle(draws.begin(), draws.end(), gen);
+                draws[nr_stale_vertices - 1] = has_true ? draw_coin(gen) : true;
+                shuffle(draws, gen);
 
                 int swi = 0;
                 for (const auto &vertex : g::get_non_probabilistic_vertices(graph)) {
@@ -299,10 +247,7 @@ auto StochasticDiscountedObjectiveSolver::solve(const graphs_t &graph)
                     if (!lst.empty()) {
                         if (draws[swi]) {
                             stale = false;
-                            std::uniform_int_distribution<> dist_choice(
-                                0, static_cast<int>(lst.size() - 1));
-                            int choice = dist_choice(gen);
-                            strategy[vertex] = lst[choice];
+                            strategy[vertex] = lst[draw_below(gen, lst.size())];
                         }
                         ++swi;
                     }
@@ -320,13 +265,9 @@ auto StochasticDiscountedObjectiveSolver::solve(const graphs_t &graph)
             n_obj_coeff[i] = obj_coeff[i] * (-1);
         }
 
-        // Use solver reuse pattern instead of full reconstruction
-        solver.update_objective_row(n_obj_coeff);
-        solver.normalize_objective_row();
-        while (solver.calculate_simplex()) {
-            lpiter++;
-        }
-        solver.get_full_results(sol_vec, obj, true);
+        // The constraints are unchanged: continue from the previous basis
+        lp.set_objective(n_obj_coeff);
+        solve_simplex(lp, sol_vec, obj);
 
         for (size_t i = 0; i < sol_vec.size(); ++i) {
             sol[reverseMap[i]] = sol_vec[i];
@@ -337,7 +278,7 @@ auto StochasticDiscountedObjectiveSolver::solve(const graphs_t &graph)
         }
     }
 
-    if (obj + cff > 1e-8) {
+    if (obj + cff > Policy::objective_tolerance()) {
         LGG_WARN("Stopped with no local improvements, solution may not be optimal");
     }
 
@@ -348,7 +289,11 @@ auto StochasticDiscountedObjectiveSolver::solve(const graphs_t &graph)
         } else {
             solution.set_winning_player(vertex, 1);
         }
-        solution.set_strategy(vertex, strategy[vertex]);
+        if (graph[vertex].player != -1) {
+            solution.set_strategy(vertex, choices.successor[strategy[vertex]]);
+        } else {
+            solution.set_strategy(vertex, -1);
+        }
         solution.set_value(vertex, sol[vertex]);
     }
 
@@ -1,8 +1,8 @@
 ﻿#include "libggg/stochastic_discounted/solvers/strategy.hpp"
 #include "libggg/utils/logging.hpp"
-#include "libggg/utils/simplex.hpp"
 #include <boost/graph/graph_utility.hpp>
-#include <map>
+#include <limits>
+#include <stdexcept>
 
 namespace ggg {
 namespace stochastic_discounted {
@@ -10,215 +10,205 @@ namespace stochastic_discounted {
 namespace g = ggg::stochastic_discounted::graph;
 using graphs_t = g::Graph;
 
-void StochasticDiscountedStrategySolver::switch_str(const graphs_t &graph) {
+template <typename T>
+void BasicStochasticDiscountedStrategySolver<T>::switch_str(const graphs_t &graph) {
+    const T tolerance = NumericPolicy<T>::improvement_tolerance();
+    switched.clear();
     const auto [vertices_begin, vertices_end] = boost::vertices(graph);
     for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
         if (graph[vertex].player == 0) {
-            const auto olde = edge(vertex, strategy[vertex], graph);
-            double oldval = graph[olde.first].weight;
-            const auto reach = g::get_reachable_through_probabilistic(graph, vertex, strategy[vertex]);
-            for (const auto &[TARGET, PROB] : reach) {
-                oldval += PROB * graph[olde.first].discount * sol[TARGET];
-            }
-            const auto [out_edges_begin, out_edges_end] = boost::out_edges(vertex, graph);
-            for (const auto &gedge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-                const auto successor = boost::target(gedge, graph);
-                const auto newe = edge(vertex, successor, graph);
-                double newval = graph[newe.first].weight;
-                const auto reach = g::get_reachable_through_probabilistic(graph, vertex, successor);
-                for (const auto &[TARGET, PROB] : reach) {
-                    newval += PROB * graph[newe.first].discount * sol[TARGET];
-                }
-                if (oldval + 1e-6 < newval) {
-                    strategy[vertex] = successor;
+            const std::size_t old_choice = strategy[vertex];
+            const T oldval = choices.value(strategy[vertex], sol);
+            for (std::size_t c = choices.first_choice(vertex); c < choices.end_choice(vertex); ++c) {
+                const T newval = choices.value(c, sol);
+                if (oldval + tolerance < newval) {
+                    strategy[vertex] = c;
                     switches++;
                 }
             }
+            if (strategy[vertex] != old_choice) {
+                switched.push_back(vertex);
+            }
         }
     }
 }
 
-int StochasticDiscountedStrategySolver::count_player_edges(const graphs_t &graph) {
-    int edges = 0;
-    const auto [vertices_begin, vertices_end] = boost::vertices(graph);
-    for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
-        if (graph[vertex].player == 0) {
-            edges++;
+template <typename T>
+void BasicStochasticDiscountedStrategySolver<T>::set_matrix_row(graph::Vertex vertex,
+                                                                std::size_t choice,
+                                                                std::vector<utils::RevisedSimplex::Entry> &row) const {
+    row.clear();
+    double diagonal = 1.0;
+    const auto columns = choices.row_columns(choice);
+    const auto coefficients = choices.row_coefficients(choice);
+    for (std::size_t k = 0; k < columns.size(); ++k) {
+        if (columns[k] == vertex) {
+            diagonal -= static_cast<double>(coefficients[k]);
         } else {
-            if (graph[vertex].player == 1) {
-                const auto [out_edges_begin, out_edges_end] = boost::out_edges(vertex, graph);
-                for (const auto &edge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-                    edges++;
-                }
-            }
+            row.push_back({matrixMap[columns[k]], -1.0 * static_cast<double>(coefficients[k])});
         }
     }
-    return edges;
+    row.push_back({matrixMap[vertex], diagonal});
 }
 
-void StochasticDiscountedStrategySolver::calculate_obj_coefficients(const graphs_t &graph,
-                                                                    std::vector<double> &obj_coeff,
-                                                                    std::vector<double> &var_up,
-                                                                    std::vector<double> &var_low) {
-    obj_coeff.resize(num_real_vertices);
-    var_up.resize(num_real_vertices);
-    var_low.resize(num_real_vertices);
-
+template <typename T>
+void BasicStochasticDiscountedStrategySolver<T>::setup_matrix_rows(const graphs_t &graph, utils::RevisedSimplex &lp) {
+    std::vector<utils::RevisedSimplex::Entry> row;
     for (const auto &vertex : g::get_non_probabilistic_vertices(graph)) {
-        obj_coeff[matrixMap[vertex]] = -1;
-        var_up[matrixMap[vertex]] = std::numeric_limits<double>::infinity();
-        var_low[matrixMap[vertex]] = -std::numeric_limits<double>::infinity();
-    }
-}
-
-int StochasticDiscountedStrategySolver::setup_matrix_rows(const graphs_t &graph,
-                                                          std::vector<std::vector<double>> &matrix_coeff,
-                                                          std::vector<double> &obj_coeff_up,
-                                                          std::vector<double> &obj_coeff_low) {
-    int row = 0;
-    for (const auto &vertex : g::get_non_probabilistic_vertices(graph)) {
-        std::fill(matrix_coeff[row].begin(), matrix_coeff[row].end(), 0.0);
         if (graph[vertex].player == 0) {
-            const auto curre = edge(vertex, strategy[vertex], graph);
-            obj_coeff_up[row] = graph[curre.first].weight;
-            obj_coeff_low[row] = graph[curre.first].weight;
-            const auto reach = g::get_reachable_through_probabilistic(graph, vertex, strategy[vertex]);
-            matrix_coeff[row][matrixMap[vertex]] = 1.0;
-            for (const auto &[TARGET, PROB] : reach) {
-                if (TARGET == vertex) {
-                    matrix_coeff[row][matrixMap[TARGET]] = 1.0 - PROB * graph[curre.first].discount;
-                } else {
-                    matrix_coeff[row][matrixMap[TARGET]] = -1.0 * PROB * graph[curre.first].discount;
-                }
-            }
-            row++;
+            const double reward = static_cast<double>(choices.reward[strategy[vertex]]);
+            set_matrix_row(vertex, strategy[vertex], row);
+            playerRow[vertex] = lp.add_row(row, reward, reward);
         } else {
-            const auto [out_edges_begin, out_edges_end] = boost::out_edges(vertex, graph);
-            for (const auto &gedge : boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-                const auto successor = boost::target(gedge, graph);
-                const auto curre = edge(vertex, successor, graph);
-                obj_coeff_up[row] = graph[curre.first].weight;
-                obj_coeff_low[row] = -std::numeric_limits<double>::infinity();
-                const auto reach = g::get_reachable_through_probabilistic(graph, vertex, successor);
-                matrix_coeff[row][matrixMap[vertex]] = 1.0;
-                for (const auto &[TARGET, PROB] : reach) {
-                    if (TARGET == vertex) {
-                        matrix_coeff[row][matrixMap[TARGET]] = 1.0 - PROB * graph[curre.first].discount;
-                    } else {
-                        matrix_coeff[row][matrixMap[TARGET]] = -1.0 * PROB * graph[curre.first].discount;
-                    }
-                }
-                row++;
+            for (std::size_t c = choices.first_choice(vertex); c < choices.end_choice(vertex); ++c) {
+                set_matrix_row(vertex, c, row);
+                lp.add_row(row, -std::numeric_limits<double>::infinity(), static_cast<double>(choices.reward[c]));
             }
         }
     }
-    return row;
 }
 
-void StochasticDiscountedStrategySolver::solve_simplex(const std::vector<std::vector<double>> &matrix_coeff,
-                                                       const std::vector<double> &obj_coeff_low,
-                                                       const std::vector<double> &obj_coeff_up,
-                                                       const std::vector<double> &var_low,
-                                                       const std::vector<double> &var_up,
-                                                       const std::vector<double> &n_obj_coeff,
-                                                       std::vector<double> &sol_vec,
-                                                       double &obj) {
-    Simplex solver(matrix_coeff, obj_coeff_low, obj_coeff_up, var_low, var_up, n_obj_coeff);
-    while (solver.remove_artificial_variables()) {
-        // solver.printTableau();
-    }
-    while (solver.calculate_simplex()) {
-        lpiter++;
+template <typename T>
+void BasicStochasticDiscountedStrategySolver<T>::update_matrix_rows(utils::RevisedSimplex &lp) {
+    std::vector<utils::RevisedSimplex::Entry> row;
+    for (const auto &vertex : switched) {
+        const double reward = static_cast<double>(choices.reward[strategy[vertex]]);
+        set_matrix_row(vertex, strategy[vertex], row);
+        lp.set_row(playerRow[vertex], row, reward, reward);
     }
-    solver.get_full_results(sol_vec, obj, true);
 }
 
-auto StochasticDiscountedStrategySolver::solve(const graphs_t &graph) -> ggg::solutions::RSQSolution<graphs_t> {
-    LGG_INFO("Starting Strategy Improvement solver for stochastic discounted game");
-
-    ggg::solutions::RSQSolution<graphs_t> solution;
-    if (boost::num_vertices(graph) == 0) {
-        LGG_WARN("Empty graph provided");
-        return solution;
+template <typename T>
+void BasicStochasticDiscountedStrategySolver<T>::solve_simplex(utils::RevisedSimplex &lp,
+                                                               std::vector<double> &sol_vec,
+                                                               double &obj) {
+    if (lp.solve() != utils::LPStatus::Optimal) {
+        throw std::runtime_error("strategy evaluation LP has no optimal solution");
     }
+    lpiter = lp.iterations();
+    sol_vec = lp.values();
+    obj = lp.objective();
+}
 
-    switches = 0;
-    iterations = 0;
-    lpiter = 0;
-
-    const auto [vertices_begin, vertices_end] = boost::vertices(graph);
-    matrixMap.clear();
-    int reindex = 0;
+template <typename T>
+bool BasicStochasticDiscountedStrategySolver<T>::improve_opponent(const graphs_t &graph) {
+    const T tolerance = NumericPolicy<T>::response_tolerance();
+    bool improved = false;
     for (const auto &vertex : g::get_non_probabilistic_vertices(graph)) {
-        matrixMap[vertex] = reindex;
-        reverseMap[reindex] = vertex;
-        ++reindex;
-    }
-    for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
-        if (matrixMap.count(vertex) == 0) {
-            matrixMap[vertex] = reindex;
-            reverseMap[reindex] = vertex;
-            ++reindex;
+        if (graph[vertex].player != 1) {
+            continue;
         }
-    }
-    strategy.clear();
-    sol.clear();
-
-    for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
-        if (graph[vertex].player == 0) {
-            const auto [out_begin, out_end] = boost::out_edges(vertex, graph);
-            if (out_begin != out_end) {
-                strategy[vertex] = boost::target(*out_begin, graph);
+        std::size_t best = strategy[vertex];
+        T best_value = choices.value(best, sol);
+        for (std::size_t c = choices.first_choice(vertex); c < choices.end_choice(vertex); ++c) {
+            const T value = choices.value(c, sol);
+            if (value < best_value - tolerance) {
+                best = c;
+                best_value = value;
             }
-        } else {
-            strategy[vertex] = 0;
         }
-        sol[vertex] = 0.0;
+        if (best != strategy[vertex]) {
+            strategy[vertex] = best;
+            improved = true;
+        }
     }
+    return improved;
+}
 
-    int edges = count_player_edges(graph);
-    int num_vertices = boost::num_vertices(graph);
-    num_real_vertices = boost::distance(g::get_non_probabilistic_vertices(graph));
-
-    std::vector<std::vector<double>> matrix_coeff(edges, std::vector<double>(num_real_vertices));
-    std::vector<double> obj_coeff_up(edges);
-    std::vector<double> obj_coeff_low(edges);
-    std::vector<double> obj_coeff;
-    std::vector<double> var_up;
-    std::vector<double> var_low;
-
-    calculate_obj_coefficients(graph, obj_coeff, var_up, var_low);
+template <typename T>
+void BasicStochasticDiscountedStrategySolver<T>::solve_linear(const graphs_t &graph) {
+    BasicPolicyEvaluation<T> evaluator(choices, evaluation_ == StrategyEvaluation::GaussSeidel ? LinearSolver::GaussSeidel : LinearSolver::BiCGSTAB);
 
-    setup_matrix_rows(graph, matrix_coeff, obj_coeff_up, obj_coeff_low);
+    // Player 1's strategy is kept across player 0 iterations: its previous
+    // best response is usually close to the next one.
+    do {
+        iterations++;
+        do {
+            ggg::solvers::throw_if_cancelled();
+            evaluator.evaluate(strategy, sol);
+            evaluations++;
+            solveriter += evaluator.iterations();
+        } while (improve_opponent(graph));
+        switch_str(graph);
+    } while (!switched.empty());
+}
 
-    std::vector<double> n_obj_coeff(num_real_vertices);
-    for (std::size_t i = 0; i < n_obj_coeff.size(); ++i) {
-        n_obj_coeff[i] = obj_coeff[i] * (-1);
-    }
+template <typename T>
+void BasicStochasticDiscountedStrategySolver<T>::solve_lp(const graphs_t &graph) {
+    // Maximise the sum of values: player 0 rows are equations for its
+    // current choice, player 1 rows bound the value by every choice.
+    utils::RevisedSimplex lp(num_real_vertices);
+    lp.set_objective(std::vector<double>(num_real_vertices, 1.0));
+    playerRow.assign(boost::num_vertices(graph), 0);
+    setup_matrix_rows(graph, lp);
 
     double obj = 0;
     std::vector<double> sol_vec(num_real_vertices);
-    solve_simplex(matrix_coeff, obj_coeff_low, obj_coeff_up, var_low, var_up, n_obj_coeff, sol_vec, obj);
+    solve_simplex(lp, sol_vec, obj);
 
     for (size_t i = 0; i < sol_vec.size(); ++i) {
-        sol[reverseMap[i]] = sol_vec[i];
+        sol[reverseMap[i]] = T(sol_vec[i]);
     }
 
     double old_obj = obj - 1;
 
     while (old_obj < obj) {
+        ggg::solvers::throw_if_cancelled();
         iterations++;
         old_obj = obj;
         switch_str(graph);
 
-        setup_matrix_rows(graph, matrix_coeff, obj_coeff_up, obj_coeff_low);
+        update_matrix_rows(lp);
 
-        solve_simplex(matrix_coeff, obj_coeff_low, obj_coeff_up, var_low, var_up, n_obj_coeff, sol_vec, obj);
+        solve_simplex(lp, sol_vec, obj);
 
         for (size_t i = 0; i < sol_vec.size(); ++i) {
-            sol[reverseMap[i]] = sol_vec[i];
+            sol[reverseMap[i]] = T(sol_vec[i]);
         }
     }
+}
+
+template <typename T>
+auto BasicStochasticDiscountedStrategySolver<T>::solve(const graphs_t &graph) -> SolutionType {
+    LGG_INFO("Starting Strategy Improvement solver for stochastic discounted game (", NumericPolicy<T>::name, ")");
+
+    SolutionType solution;
+    if (boost::num_vertices(graph) == 0) {
+        LGG_WARN("Empty graph provided");
+        return solution;
+    }
+
+    switches = 0;
+    iterations = 0;
+    lpiter = 0;
+    evaluations = 0;
+    solveriter = 0;
+
+    choices = make_choice_matrix<T>(graph);
+
+    const auto [vertices_begin, vertices_end] = boost::vertices(graph);
+    const std::size_t num_vertices = boost::num_vertices(graph);
+    matrixMap.assign(num_vertices, 0);
+    reverseMap.clear();
+    for (const auto &vertex : g::get_non_probabilistic_vertices(graph)) {
+        matrixMap[vertex] = reverseMap.size();
+        reverseMap.push_back(vertex);
+    }
+
+    // Every player starts on its first choice.
+    strategy.resize(num_vertices);
+    sol.assign(num_vertices, T(0));
+    for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
+        strategy[vertex] = choices.first_choice(vertex);
+    }
+
+    num_real_vertices = boost::distance(g::get_non_probabilistic_vertices(graph));
+
+    if (evaluation_ == StrategyEvaluation::LinearProgram) {
+        solve_lp(graph);
+    } else {
+        solve_linear(graph);
+    }
 
     for (const auto &vertex : boost::make_iterator_range(vertices_begin, vertices_end)) {
         if (sol[vertex] >= 0) {
@@ -227,7 +217,7 @@ auto StochasticDiscountedStrategySolver::solve(const graphs_t &graph) -> ggg::so
             solution.set_winning_player(vertex, 1);
         }
         if (graph[vertex].player == 0) {
-            solution.set_strategy(vertex, strategy[vertex]);
+            solution.set_strategy(vertex, choices.successor[strategy[vertex]]);
         } else {
             solution.set_strategy(vertex, -1);
         }
@@ -235,10 +225,19 @@ auto StochasticDiscountedStrategySolver::solve(const graphs_t &graph) -> ggg::so
     }
 
     LGG_TRACE("Solved with ", iterations, " iterations");
-    LGG_TRACE("Solved with ", lpiter, " LP pivotes");
+    if (evaluation_ == StrategyEvaluation::LinearProgram) {
+        LGG_TRACE("Solved with ", lpiter, " LP pivotes");
+    } else {
+        LGG_TRACE("Solved with ", evaluations, " policy evaluations (", solveriter, " solver iterations)");
+    }
     LGG_TRACE("Solved with ", switches, " switches");
     return solution;
 }
 
+template class BasicStochasticDiscountedStrategySolver<float>;
+template class BasicStochasticDiscountedStrategySolver<double>;
+template class BasicStochasticDiscountedStrategySolver<long double>;
+template class BasicStochasticDiscountedStrategySolver<Rational>;
+
 } // namespace stochastic_discounted
 } // namespace ggg
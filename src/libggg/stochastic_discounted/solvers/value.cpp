@@ -1,7 +1,7 @@
 ﻿#include "libggg/stochastic_discounted/solvers/value.hpp"
 #include "libggg/utils/logging.hpp"
 #include <boost/graph/graph_utility.hpp>
-#include <map>
+#include <cmath>
 
 namespace ggg {
 namespace stochastic_discounted {
@@ -9,102 +9,52 @@ namespace stochastic_discounted {
 namespace g = ggg::stochastic_discounted::graph;
 using graphs_t = g::Graph;
 
-auto StochasticDiscountedValueSolver::solve(const graphs_t &graph) -> ggg::solutions::RSQSolution<graphs_t> {
-    LGG_INFO("Starting Value Iteration solver for stochastic discounted game");
-
-    ggg::solutions::RSQSolution<graphs_t> solution;
-    if (boost::num_vertices(graph) == 0) {
-        LGG_WARN("Empty graph provided");
-        return solution;
-    }
-
-    lifts = 0;
-    iterations = 0;
-
+template <typename T>
+void BasicStochasticDiscountedValueSolver<T>::solve_worklist(const graphs_t &graph, const BasicChoiceMatrix<T> &matrix) {
+    using std::abs;
     int num_vertices = boost::num_vertices(graph);
-    strategy.clear();
-    sol.clear();
     TAtr.resize(num_vertices);
+    BAtr.clear();
     BAtr.resize(num_vertices);
 
-    const auto [vertices_begin, vertices_end] = boost::vertices(graph);
-
-    // Initialize all vertices
-    for (const auto &vertex :
-         boost::make_iterator_range(vertices_begin, vertices_end)) {
-        sol[vertex] = 0.0;
-        BAtr[vertex] = false;
-    }
-
     // Add non-probabilistic vertices to the work queue
     for (const auto &vertex : g::get_non_probabilistic_vertices(graph)) {
-        strategy[vertex] = -1;
         TAtr.push(vertex);
         BAtr[vertex] = true;
     }
 
     int pos;
     int best_succ;
-    double sum;
-    double best;
-    double max_change;
-    const double epsilon = 1e-10;
+    T sum;
+    T best;
+    T max_change;
+    const T epsilon = NumericPolicy<T>::convergence_tolerance();
 
     // Outer loop: continue until convergence
     do {
-        max_change = 0.0;
+        max_change = 0;
 
         while (TAtr.nonempty()) {
+            ggg::solvers::throw_if_cancelled();
             iterations++;
             pos = TAtr.pop();
             BAtr[pos] = false;
-            oldcost = sol[pos];
             best_succ = -1;
-            const auto [out_edges_begin, out_edges_end] = boost::out_edges(pos,
-                                                                           graph);
-            for (const auto &gedge :
-                 boost::make_iterator_range(out_edges_begin, out_edges_end)) {
-                const auto successor = boost::target(gedge, graph);
-                const auto curre = edge(pos, successor, graph);
-                const auto reach = g::get_reachable_through_probabilistic(
-                    graph, pos, successor);
-                if (best_succ == -1) {
-                    best_succ = successor;
-                    best = 0;
-                    for (const auto &[TARGET, PROB] : reach) {
-                        best += (PROB * graph[curre.first].discount *
-                                 sol[TARGET]);
-                    }
-                    best += graph[curre.first].weight;
-                } else {
-                    sum = 0;
-                    for (const auto &[TARGET, PROB] : reach) {
-                        sum += (PROB * graph[curre.first].discount *
-                                sol[TARGET]);
-                    }
-                    sum += graph[curre.first].weight;
-                    if ((graph[pos].player == 0 && sum > best) ||
-                        (graph[pos].player == 1 && sum < best)) {
-                        best_succ = successor;
-                        best = sum;
-                    }
+            for (std::size_t c = matrix.first_choice(pos); c < matrix.end_choice(pos); ++c) {
+                sum = matrix.value(c, sol);
+                if (best_succ == -1 ||
+                    (graph[pos].player == 0 && sum > best) ||
+                    (graph[pos].player == 1 && sum < best)) {
+                    best_succ = static_cast<int>(matrix.successor[c]);
+                    best = sum;
                 }
             }
             if (sol[pos] != best || strategy[pos] == -1) {
                 lifts++;
-                double change = std::abs(sol[pos] - best);
+                T change = abs(sol[pos] - best);
                 max_change = std::max(max_change, change);
                 sol[pos] = best;
                 strategy[pos] = best_succ;
-
-                for (auto in_edge :
-                     boost::make_iterator_range(boost::in_edges(pos, graph))) {
-                    auto pred = boost::source(in_edge, graph);
-                    if (!BAtr[pred]) {
-                        TAtr.push(pred);
-                        BAtr[pred] = true;
-                    }
-                }
             }
         }
 
@@ -119,7 +69,97 @@ auto StochasticDiscountedValueSolver::solve(const graphs_t &graph) -> ggg::solut
             }
         }
     } while (max_change > epsilon);
+}
+
+template <typename T>
+void BasicStochasticDiscountedValueSolver<T>::solve_sweeps(const BasicChoiceMatrix<T> &matrix, const T &precision) {
+    SweepOrder order = SweepOrder::Jacobi;
+    if (method_ == ValueIterationMethod::GaussSeidel) {
+        order = SweepOrder::GaussSeidel;
+    } else if (method_ == ValueIterationMethod::RedBlack) {
+        order = SweepOrder::RedBlack;
+    }
+
+    BasicValueIteration<T> engine(matrix, order, threads_);
+    iterations = engine.run(sol, precision);
+    for (std::size_t v = 0; v < matrix.num_vertices(); ++v) {
+        if (matrix.player[v] != -1) {
+            strategy[v] = static_cast<int>(matrix.successor[engine.choices()[v]]);
+        }
+    }
+    LGG_TRACE("Contraction factor ", engine.gamma(), ", error bound ", engine.error_bound());
+}
 
+template <typename T>
+void BasicStochasticDiscountedValueSolver<T>::solve_topological(const BasicChoiceMatrix<T> &matrix, const T &precision) {
+    BasicTopologicalValueIteration<T> engine(matrix, threads_);
+    lifts = engine.run(sol, precision);
+    iterations = engine.num_levels();
+    for (std::size_t v = 0; v < matrix.num_vertices(); ++v) {
+        if (matrix.player[v] != -1) {
+            strategy[v] = static_cast<int>(matrix.successor[engine.choices()[v]]);
+        }
+    }
+    LGG_TRACE("Solved ", engine.num_components(), " components (", engine.num_cyclic_components(), " cyclic) in ",
+              engine.num_levels(), " levels, error bound ", engine.error_bound());
+}
+
+template <typename T>
+void BasicStochasticDiscountedValueSolver<T>::solve_interval(const BasicChoiceMatrix<T> &matrix, const T &precision) {
+    BasicIntervalValueIteration<T> engine(matrix);
+    iterations = engine.run(sol, precision, progress_);
+    lower_ = engine.lower();
+    upper_ = engine.upper();
+    for (std::size_t v = 0; v < matrix.num_vertices(); ++v) {
+        if (matrix.player[v] != -1) {
+            strategy[v] = static_cast<int>(matrix.successor[engine.choices()[v]]);
+        }
+    }
+    if (!engine.converged()) {
+        LGG_WARN("Interval value iteration stopped early, error bound ", engine.error_bound());
+    }
+    LGG_TRACE("Contraction factor ", engine.gamma(), ", error bound ", engine.error_bound());
+}
+
+template <typename T>
+auto BasicStochasticDiscountedValueSolver<T>::solve(const graphs_t &graph) -> SolutionType {
+    LGG_INFO("Starting Value Iteration solver for stochastic discounted game (", NumericPolicy<T>::name, ")");
+
+    SolutionType solution;
+    if (boost::num_vertices(graph) == 0) {
+        LGG_WARN("Empty graph provided");
+        return solution;
+    }
+
+    lifts = 0;
+    iterations = 0;
+    lower_.clear();
+    upper_.clear();
+
+    const auto matrix = make_choice_matrix<T>(graph);
+    strategy.assign(boost::num_vertices(graph), -1);
+    sol.assign(boost::num_vertices(graph), T(0));
+
+    T precision(precision_);
+    if (method_ != ValueIterationMethod::Worklist) {
+        const T attainable = attainable_precision(matrix);
+        if (precision < attainable) {
+            LGG_INFO("Precision ", precision_, " is below what ", NumericPolicy<T>::name, " values can certify, using ", attainable);
+            precision = attainable;
+        }
+    }
+
+    if (method_ == ValueIterationMethod::Worklist) {
+        solve_worklist(graph, matrix);
+    } else if (method_ == ValueIterationMethod::Topological) {
+        solve_topological(matrix, precision);
+    } else if (method_ == ValueIterationMethod::Interval) {
+        solve_interval(matrix, precision);
+    } else {
+        solve_sweeps(matrix, precision);
+    }
+
+    const auto [vertices_begin, vertices_end] = boost::vertices(graph);
     for (const auto &vertex :
          boost::make_iterator_range(vertices_begin, vertices_end)) {
         if (sol[vertex] >= 0) {
@@ -136,5 +176,9 @@ auto StochasticDiscountedValueSolver::solve(const graphs_t &graph) -> ggg::solut
     return solution;
 }
 
+template class BasicStochasticDiscountedValueSolver<float>;
+template class BasicStochasticDiscountedValueSolver<double>;
+template class BasicStochasticDiscountedValueSolver<long double>;
+
 } // namespace stochastic_discounted
 } // namespace ggg
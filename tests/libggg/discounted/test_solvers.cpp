@@ -0,0 +1,106 @@
+#include "libggg/discounted/flat_game.hpp"
+#include "libggg/discounted/graph.hpp"
+#include "libggg/discounted/solvers/strategy_improvement.hpp"
+#include "libggg/discounted/solvers/value.hpp"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using namespace ggg::discounted;
+using namespace ggg::discounted::graph;
+
+namespace {
+
+// Values: x0 = max(1 + x1/2, x0/2) = 2/3, x1 = min(-1 + x0/2, 2 + x1/2) = -2/3;
+// v2 only leads into the cycle: x2 = 3 + x0/4 = 19/6.
+struct MaxMinGame {
+    Graph graph;
+    Vertex v0 = add_vertex(graph, "max", 0);
+    Vertex v1 = add_vertex(graph, "min", 1);
+    Vertex v2 = add_vertex(graph, "tail", 0);
+    std::vector<double> exact = {2.0 / 3.0, -2.0 / 3.0, 19.0 / 6.0};
+
+    MaxMinGame() {
+        add_edge(graph, v0, v1, "e01", 1.0, 0.5);
+        add_edge(graph, v0, v0, "e00", 0.0, 0.5);
+        add_edge(graph, v1, v0, "e10", -1.0, 0.5);
+        add_edge(graph, v1, v1, "e11", 2.0, 0.5);
+        add_edge(graph, v2, v0, "e20", 3.0, 0.25);
+    }
+};
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(DiscountedSolverTests, MaxMinGame)
+
+BOOST_AUTO_TEST_CASE(TestEvaluateProfile) {
+    const auto game = make_flat_game(graph);
+    BOOST_TEST(game.num_vertices() == 3);
+    BOOST_TEST(game.num_edges() == 5);
+    BOOST_TEST(game.max_discount() == 0.5);
+    const auto edge = [&](Vertex from, Vertex to) {
+        for (std::size_t e = game.first_edge(from); e < game.end_edge(from); ++e) {
+            if (game.target[e] == to) {
+                return e;
+            }
+        }
+        return game.end_edge(from);
+    };
+
+    // Optimal profile: the cycle v0 -> v1 -> v0 and the tail v2 -> v0
+    std::vector<std::size_t> profile = {edge(v0, v1), edge(v1, v0), edge(v2, v0)};
+    std::vector<double> values;
+    evaluate_profile(game, profile, values);
+    for (const auto v : {v0, v1, v2}) {
+        BOOST_TEST(values[v] == exact[v], boost::test_tools::tolerance(1e-12));
+    }
+
+    // Neither player improves on it
+    for (const auto v : {v0, v1, v2}) {
+        std::size_t choice;
+        BOOST_TEST(best_edge(game, v, values, choice) == values[v], boost::test_tools::tolerance(1e-12));
+        BOOST_TEST(choice == profile[v]);
+    }
+
+    // Self loops: x0 = x0/2 = 0, x1 = 2 + x1/2 = 4
+    profile = {edge(v0, v0), edge(v1, v1), edge(v2, v0)};
+    evaluate_profile(game, profile, values);
+    BOOST_TEST(values[v0] == 0.0, boost::test_tools::tolerance(1e-12));
+    BOOST_TEST(values[v1] == 4.0, boost::test_tools::tolerance(1e-12));
+    BOOST_TEST(values[v2] == 3.0, boost::test_tools::tolerance(1e-12));
+}
+
+BOOST_AUTO_TEST_CASE(TestSolversAgree) {
+    // Extend the game by a ring of both players' vertices with two moves
+    // each, one of them back into the max/min cycle.
+    constexpr std::size_t ring = 6;
+    std::vector<Vertex> vertices = {v0, v1, v2};
+    for (std::size_t i = 0; i < ring; ++i) {
+        vertices.push_back(add_vertex(graph, "r" + std::to_string(i), static_cast<int>(i % 2)));
+    }
+    for (std::size_t i = 0; i < ring; ++i) {
+        const Vertex from = vertices[3 + i];
+        const double weight = static_cast<double>(static_cast<int>((5 * i) % 7) - 3);
+        add_edge(graph, from, vertices[3 + (i + 1) % ring], "next", weight, 0.9);
+        add_edge(graph, from, i % 2 == 0 ? v0 : v1, "back", -weight / 2.0, 0.8);
+    }
+
+    DiscountedValueSolver value_solver(1e-10);
+    DiscountedStrategyImprovementSolver strategy_solver;
+    const auto by_value = value_solver.solve(graph);
+    const auto by_strategy = strategy_solver.solve(graph);
+
+    for (const auto v : {v0, v1, v2}) {
+        BOOST_TEST(by_value.get_value(v) == exact[v], boost::test_tools::tolerance(1e-9));
+        BOOST_TEST(by_strategy.get_value(v) == exact[v], boost::test_tools::tolerance(1e-12));
+    }
+    for (const auto v : vertices) {
+        BOOST_TEST(std::abs(by_value.get_value(v) - by_strategy.get_value(v)) <= 1e-9);
+        BOOST_TEST(by_value.get_winning_player(v) == by_strategy.get_winning_player(v));
+        BOOST_TEST(by_value.get_strategy(v) == by_strategy.get_strategy(v));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
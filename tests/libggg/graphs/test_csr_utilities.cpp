@@ -0,0 +1,110 @@
+#include "libggg/graphs/csr_utilities.hpp"
+#include "libggg/mean_payoff/graph.hpp"
+#include <algorithm>
+#include <boost/test/unit_test.hpp>
+#include <span>
+#include <utility>
+#include <vector>
+
+using namespace ggg::graphs::csr_utilities;
+using namespace ggg::mean_payoff::graph;
+
+BOOST_AUTO_TEST_SUITE(CsrUtilitiesTests)
+
+BOOST_AUTO_TEST_CASE(TestEmptyGraph) {
+    Graph graph;
+
+    const auto successors = make_successors(graph);
+    const auto predecessors = make_predecessors(graph);
+
+    BOOST_CHECK_EQUAL(successors.num_vertices(), 0);
+    BOOST_CHECK_EQUAL(predecessors.num_vertices(), 0);
+    BOOST_CHECK(successors.targets.empty());
+}
+
+BOOST_AUTO_TEST_CASE(TestSuccessorsFollowOutEdges) {
+    Graph graph;
+    auto v0 = add_vertex(graph, "v0", 0, 1);
+    auto v1 = add_vertex(graph, "v1", 1, -2);
+    auto v2 = add_vertex(graph, "v2", 0, 3);
+    add_edge(graph, v0, v1, "");
+    add_edge(graph, v0, v2, "");
+    add_edge(graph, v1, v1, "");
+    add_edge(graph, v2, v0, "");
+
+    const auto successors = make_successors(graph);
+
+    BOOST_REQUIRE_EQUAL(successors.num_vertices(), 3);
+    BOOST_CHECK_EQUAL(successors.targets.size(), 4);
+    for (std::size_t v = 0; v < 3; ++v) {
+        BOOST_CHECK_EQUAL(successors.degree(v), boost::out_degree(v, graph));
+        const auto [out_begin, out_end] = boost::out_edges(v, graph);
+        std::vector<std::size_t> expected;
+        for (auto it = out_begin; it != out_end; ++it) {
+            expected.push_back(boost::target(*it, graph));
+        }
+        const auto range = successors.neighbours(v);
+        BOOST_CHECK_EQUAL_COLLECTIONS(range.begin(), range.end(), expected.begin(), expected.end());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestPredecessorsFollowInEdges) {
+    Graph graph;
+    auto v0 = add_vertex(graph, "v0", 0, 1);
+    auto v1 = add_vertex(graph, "v1", 1, -2);
+    auto v2 = add_vertex(graph, "v2", 0, 3);
+    add_edge(graph, v2, v1, "");
+    add_edge(graph, v0, v1, "");
+    add_edge(graph, v1, v1, "");
+    add_edge(graph, v1, v0, "");
+
+    const auto predecessors = make_predecessors(graph);
+
+    BOOST_REQUIRE_EQUAL(predecessors.num_vertices(), 3);
+    BOOST_CHECK_EQUAL(predecessors.degree(v0), 1);
+    BOOST_CHECK_EQUAL(predecessors.degree(v1), 3);
+    BOOST_CHECK_EQUAL(predecessors.degree(v2), 0);
+
+    // Sources are listed in increasing order.
+    const std::vector<std::size_t> expected{v0, v1, v2};
+    const auto range = predecessors.neighbours(v1);
+    BOOST_CHECK_EQUAL_COLLECTIONS(range.begin(), range.end(), expected.begin(), expected.end());
+    BOOST_CHECK_EQUAL(predecessors.neighbours(v0)[0], v1);
+}
+
+BOOST_AUTO_TEST_CASE(TestStrongComponentsOfSubgraphs) {
+    // 0 <-> 1 -> 2 -> 2, 3 -> 0, 4 alone
+    CompressedAdjacency graph;
+    graph.offsets = {0, 1, 3, 4, 5, 5};
+    graph.targets = {1, 0, 2, 2, 0};
+    StrongComponents scc(graph);
+    const std::vector<std::size_t> all = {0, 1, 2, 3, 4};
+
+    std::vector<std::pair<std::vector<std::size_t>, bool>> components;
+    const auto collect = [&](std::span<const std::size_t> members, bool cyclic) {
+        std::vector<std::size_t> sorted(members.begin(), members.end());
+        std::sort(sorted.begin(), sorted.end());
+        components.emplace_back(std::move(sorted), cyclic);
+    };
+    scc.run(all, [](std::size_t) { return true; }, collect);
+    BOOST_REQUIRE_EQUAL(components.size(), 4);
+    BOOST_CHECK((components[0] == std::make_pair(std::vector<std::size_t>{2}, true)));
+    BOOST_CHECK((components[1] == std::make_pair(std::vector<std::size_t>{0, 1}, true)));
+    BOOST_CHECK((components[2] == std::make_pair(std::vector<std::size_t>{3}, false)));
+    BOOST_CHECK((components[3] == std::make_pair(std::vector<std::size_t>{4}, false)));
+
+    // Without vertex 1 the cycle through 0 is gone; the scratch state is reset between runs.
+    components.clear();
+    scc.run(all, [](std::size_t v) { return v != 1; }, collect);
+    BOOST_REQUIRE_EQUAL(components.size(), 4);
+    BOOST_CHECK(!components[0].second);
+    BOOST_CHECK_EQUAL(std::count_if(components.begin(), components.end(), [](const auto &c) { return c.second; }), 1);
+
+    const std::vector<std::size_t> kept = {0, 1, 3};
+    const auto subgraph = make_subgraph(graph, kept);
+    BOOST_REQUIRE_EQUAL(subgraph.num_vertices(), 3);
+    BOOST_CHECK_EQUAL(subgraph.targets.size(), 3); // 0 -> 1, 1 -> 0, 3 -> 0; 1 -> 2 is dropped
+    BOOST_CHECK_EQUAL(subgraph.neighbours(2)[0], 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
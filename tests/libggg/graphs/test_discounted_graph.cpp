@@ -0,0 +1,29 @@
+#include "libggg/discounted/graph.hpp"
+#include <boost/test/unit_test.hpp>
+#include <sstream>
+
+using namespace ggg::discounted::graph;
+
+BOOST_AUTO_TEST_SUITE(DiscountedGameTests)
+
+BOOST_AUTO_TEST_CASE(TestDiscountedGameValidation) {
+    Graph graph;
+    auto v0 = add_vertex(graph, "v0", 0);
+    auto v1 = add_vertex(graph, "v1", 1);
+    add_edge(graph, v0, v1, "e01", 1.5, 0.9);
+    add_edge(graph, v1, v0, "e10", -2.0, 0.5);
+    BOOST_CHECK_NO_THROW(StandardValidator::validate(graph));
+
+    std::stringstream buffer;
+    write(graph, buffer);
+    auto parsed = parse(buffer);
+    BOOST_REQUIRE(parsed != nullptr);
+    BOOST_CHECK_NO_THROW(StandardValidator::validate(*parsed));
+
+    Graph undiscounted;
+    auto u0 = add_vertex(undiscounted, "u0", 0);
+    add_edge(undiscounted, u0, u0, "loop", 1.0, 1.0);
+    BOOST_CHECK_THROW(StandardValidator::validate(undiscounted), ggg::graphs::GraphValidationError);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
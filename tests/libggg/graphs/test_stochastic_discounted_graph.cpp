@@ -1,3 +1,4 @@
+#include "libggg/stochastic_discounted/choice_matrix.hpp"
 #include "libggg/stochastic_discounted/graph.hpp"
 #include <sstream>
 #include <string>
@@ -204,4 +205,60 @@ BOOST_AUTO_TEST_CASE(WriteParseRoundTripPreservesProbabilityPrecision) {
     BOOST_CHECK_NO_THROW(StandardValidator::validate(*parsed));
 }
 
+BOOST_AUTO_TEST_CASE(ChoiceMatrixMatchesProbabilisticClosure) {
+    using namespace ggg::stochastic_discounted::graph;
+
+    Graph graph;
+
+    // v0 -> v1 (prob) -> {v2 (prob): 0.6, v4: 0.4}, v2 (prob) -> {v3: 0.5, v4: 0.5}
+    // v0 -> v3 directly; v3 and v4 loop back to v0.
+    auto v0 = add_vertex(graph, "start", 0);
+    auto v1 = add_vertex(graph, "prob1", -1);
+    auto v2 = add_vertex(graph, "prob2", -1);
+    auto v3 = add_vertex(graph, "end1", 1);
+    auto v4 = add_vertex(graph, "end2", 0);
+
+    add_edge(graph, v0, v1, "edge_0_1", 1.0, 0.5, 0.0);
+    add_edge(graph, v0, v3, "edge_0_3", -2.0, 0.9, 0.0);
+    add_edge(graph, v1, v2, "edge_1_2", 0.0, 0.0, 0.6);
+    add_edge(graph, v1, v4, "edge_1_4", 0.0, 0.0, 0.4);
+    add_edge(graph, v2, v3, "edge_2_3", 0.0, 0.0, 0.5);
+    add_edge(graph, v2, v4, "edge_2_4", 0.0, 0.0, 0.5);
+    add_edge(graph, v3, v0, "edge_3_0", 3.0, 0.8, 0.0);
+    add_edge(graph, v4, v0, "edge_4_0", 0.0, 0.7, 0.0);
+
+    const auto matrix = ggg::stochastic_discounted::make_choice_matrix(graph);
+
+    BOOST_TEST(matrix.num_vertices() == 5);
+    BOOST_TEST(matrix.num_choices() == 4);
+    BOOST_TEST(matrix.end_choice(v0) - matrix.first_choice(v0) == 2);
+    BOOST_TEST(matrix.end_choice(v1) == matrix.first_choice(v1));
+    BOOST_TEST(matrix.end_choice(v2) == matrix.first_choice(v2));
+
+    // Each row carries the closure of get_reachable_through_probabilistic, scaled by the discount
+    for (std::size_t c = matrix.first_choice(v0); c < matrix.end_choice(v0); ++c) {
+        const auto successor = matrix.successor[c];
+        const auto edge = boost::edge(v0, successor, graph).first;
+        const auto reach = get_reachable_through_probabilistic(graph, v0, successor);
+        const auto columns = matrix.row_columns(c);
+        const auto coefficients = matrix.row_coefficients(c);
+
+        BOOST_TEST(matrix.reward[c] == graph[edge].weight);
+        BOOST_REQUIRE(columns.size() == reach.size());
+        std::size_t k = 0;
+        for (const auto &[target, probability] : reach) {
+            BOOST_TEST(columns[k] == target);
+            BOOST_TEST(coefficients[k] == probability * graph[edge].discount);
+            ++k;
+        }
+    }
+
+    // Choice values: reward + sum of coefficient * value
+    const std::vector<double> values = {0.0, 0.0, 0.0, 10.0, 20.0};
+    const auto first = matrix.first_choice(v0);
+    BOOST_TEST(matrix.successor[first] == v1);
+    BOOST_TEST(matrix.value(first, values) == 1.0 + 0.15 * 10.0 + 0.35 * 20.0, boost::test_tools::tolerance(1e-12));
+    BOOST_TEST(matrix.value(first + 1, values) == -2.0 + 0.9 * 10.0, boost::test_tools::tolerance(1e-12));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
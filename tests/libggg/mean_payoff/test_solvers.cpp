@@ -0,0 +1,264 @@
+#include "libggg/mean_payoff/solvers/energy.hpp"
+#include "libggg/mean_payoff/solvers/msca.hpp"
+#include "libggg/mean_payoff/solvers/mse.hpp"
+#include "libggg/mean_payoff/solvers/strategy_improvement.hpp"
+#include "libggg/mean_payoff/solvers/zwick_paterson.hpp"
+#include "libggg/mean_payoff/verifier.hpp"
+#include <boost/test/unit_test.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ggg::mean_payoff;
+
+namespace {
+
+// Weights close to the int limits: their sums overflow 32 bits.  Only c's
+// negative self-loop is won by player 1; d and e close a cycle of weight
+// 10^9, which MSE lifts to ⊤ in a few rounds (a cycle of small weight would
+// take a round per unit).
+struct LargeWeightsGame {
+    graph::Graph graph;
+    graph::Vertex a = graph::add_vertex(graph, "a", 0, 2000000000);
+    graph::Vertex c = graph::add_vertex(graph, "c", 1, -2000000000);
+    graph::Vertex d = graph::add_vertex(graph, "d", 1, 2000000000);
+    graph::Vertex e = graph::add_vertex(graph, "e", 0, -1000000000);
+    graph::Vertex f = graph::add_vertex(graph, "f", 0, -2000000000);
+
+    LargeWeightsGame() {
+        graph::add_edge(graph, a, a, "");
+        graph::add_edge(graph, a, c, "");
+        graph::add_edge(graph, c, c, "");
+        graph::add_edge(graph, d, a, "");
+        graph::add_edge(graph, d, e, "");
+        graph::add_edge(graph, e, d, "");
+        graph::add_edge(graph, f, d, "");
+    }
+};
+
+// x and y close a cycle of mean payoff 0, which player 0 loses; z is a
+// negative self-loop.  From p, player 1 picks the cycle p q r of mean 1/3
+// over p q of mean 1.
+struct ZeroCycleGame {
+    graph::Graph graph;
+    graph::Vertex x = graph::add_vertex(graph, "x", 0, 0);
+    graph::Vertex y = graph::add_vertex(graph, "y", 1, 0);
+    graph::Vertex z = graph::add_vertex(graph, "z", 0, -1);
+    graph::Vertex p = graph::add_vertex(graph, "p", 0, 3);
+    graph::Vertex q = graph::add_vertex(graph, "q", 1, -1);
+    graph::Vertex r = graph::add_vertex(graph, "r", 1, -1);
+
+    ZeroCycleGame() {
+        graph::add_edge(graph, x, y, "");
+        graph::add_edge(graph, x, z, "");
+        graph::add_edge(graph, y, x, "");
+        graph::add_edge(graph, z, z, "");
+        graph::add_edge(graph, p, q, "");
+        graph::add_edge(graph, q, p, "");
+        graph::add_edge(graph, q, r, "");
+        graph::add_edge(graph, r, p, "");
+    }
+
+    template <typename SolutionType>
+    void check_values(const SolutionType &solution) const {
+        using Value = boost::rational<long long>;
+        BOOST_CHECK_EQUAL(solution.get_value(x), Value(0));
+        BOOST_CHECK_EQUAL(solution.get_value(y), Value(0));
+        BOOST_CHECK_EQUAL(solution.get_value(z), Value(-1));
+        for (const auto v : {p, q, r}) {
+            BOOST_CHECK_EQUAL(solution.get_value(v), Value(1, 3));
+        }
+    }
+
+    template <typename SolutionType>
+    void check_winners(const SolutionType &solution) const {
+        for (const auto v : {x, y, z}) {
+            BOOST_CHECK_EQUAL(solution.get_winning_player(v), 1);
+        }
+        for (const auto v : {p, q, r}) {
+            BOOST_CHECK_EQUAL(solution.get_winning_player(v), 0);
+        }
+    }
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(MeanPayoffSolverTests)
+
+BOOST_FIXTURE_TEST_CASE(TestMSEWithLargeWeights, LargeWeightsGame) {
+    MSESolver solver;
+    const auto solution = solver.solve(graph);
+
+    for (const auto v : {a, d, e, f}) {
+        BOOST_CHECK_EQUAL(solution.get_winning_player(v), 0);
+    }
+    BOOST_CHECK_EQUAL(solution.get_winning_player(c), 1);
+
+    // Costs are 64-bit and capped at ⊤ = 4000000000 + 1.
+    BOOST_CHECK_EQUAL(solution.get_value(a), 4000000001LL);
+    BOOST_CHECK_EQUAL(solution.get_value(c), 0);
+    BOOST_CHECK_EQUAL(solution.get_strategy(a), a);
+}
+
+BOOST_FIXTURE_TEST_CASE(TestEnergyCreditsAndWinners, ZeroCycleGame) {
+    EnergySolver solver;
+    const auto solution = solver.solve(graph);
+
+    // A finite credit suffices on the zero cycle, but player 0 loses it.
+    check_winners(solution);
+    BOOST_CHECK_EQUAL(solution.get_value(x), 0);
+    BOOST_CHECK_EQUAL(solution.get_value(y), 0);
+    BOOST_CHECK_EQUAL(solution.get_value(z), EnergySolver::infinite_credit);
+    BOOST_CHECK_EQUAL(solution.get_value(p), 0);
+    BOOST_CHECK_EQUAL(solution.get_value(q), 2);
+    BOOST_CHECK_EQUAL(solution.get_value(r), 1);
+    BOOST_CHECK(!solution.has_strategy(x));
+    BOOST_CHECK_EQUAL(solution.get_strategy(p), q);
+    BOOST_CHECK_EQUAL(solution.get_strategy(y), x);
+    BOOST_CHECK(verify(graph, solution, Threshold::Positive));
+}
+
+BOOST_AUTO_TEST_CASE(TestEnergyZeroCycleBesideHeavyWeights) {
+    // a and b close a cycle of weight 0 next to many heavy negative
+    // self-loops; the winners must not depend on how heavy they are.
+    graph::Graph graph;
+    const auto a = graph::add_vertex(graph, "a", 0, 1000000);
+    const auto b = graph::add_vertex(graph, "b", 0, -1000000);
+    graph::add_edge(graph, a, b, "");
+    graph::add_edge(graph, b, a, "");
+    std::vector<graph::Vertex> loops;
+    for (int i = 0; i < 198; ++i) {
+        loops.push_back(graph::add_vertex(graph, "l" + std::to_string(i), 0, -1000000));
+        graph::add_edge(graph, loops.back(), loops.back(), "");
+    }
+
+    EnergySolver solver;
+    const auto solution = solver.solve(graph);
+
+    BOOST_CHECK_EQUAL(solution.get_value(a), 0);
+    BOOST_CHECK_EQUAL(solution.get_value(b), 1000000);
+    BOOST_CHECK_EQUAL(solution.get_winning_player(a), 1);
+    BOOST_CHECK_EQUAL(solution.get_winning_player(b), 1);
+    for (const auto v : loops) {
+        BOOST_CHECK_EQUAL(solution.get_value(v), EnergySolver::infinite_credit);
+        BOOST_CHECK_EQUAL(solution.get_winning_player(v), 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestEnergyAvoidsZeroCycleOfLeastCredit) {
+    // v needs no credit on its zero self-loop, but wins through y and z.
+    graph::Graph graph;
+    const auto v = graph::add_vertex(graph, "v", 0, 0);
+    const auto y = graph::add_vertex(graph, "y", 0, -5);
+    const auto z = graph::add_vertex(graph, "z", 0, 10);
+    graph::add_edge(graph, v, v, "");
+    graph::add_edge(graph, v, y, "");
+    graph::add_edge(graph, y, z, "");
+    graph::add_edge(graph, z, v, "");
+
+    EnergySolver solver;
+    const auto solution = solver.solve(graph);
+
+    BOOST_CHECK_EQUAL(solution.get_value(v), 0);
+    BOOST_CHECK_EQUAL(solution.get_value(y), 5);
+    BOOST_CHECK_EQUAL(solution.get_value(z), 0);
+    for (const auto w : {v, y, z}) {
+        BOOST_CHECK_EQUAL(solution.get_winning_player(w), 0);
+    }
+    BOOST_CHECK_EQUAL(solution.get_strategy(v), y);
+    BOOST_CHECK(verify(graph, solution, Threshold::Positive));
+}
+
+BOOST_FIXTURE_TEST_CASE(TestMSCAWinnersExcludeZeroCycles, ZeroCycleGame) {
+    MSCASolver solver;
+    const auto solution = solver.solve(graph);
+
+    check_winners(solution);
+    BOOST_CHECK_EQUAL(solution.get_value(z), -1);
+    BOOST_CHECK(!solution.has_strategy(x));
+    BOOST_CHECK_EQUAL(solution.get_strategy(p), q);
+}
+
+BOOST_FIXTURE_TEST_CASE(TestMSCAValuesAndWinners, ZeroCycleGame) {
+    MSCAValueSolver solver(2);
+    const auto solution = solver.solve(graph);
+
+    check_values(solution);
+    check_winners(solution);
+}
+
+BOOST_FIXTURE_TEST_CASE(TestStrategyImprovementValuesAndWinners, ZeroCycleGame) {
+    StrategyImprovementSolver solver(2);
+    const auto solution = solver.solve(graph);
+
+    check_values(solution);
+    check_winners(solution);
+    BOOST_CHECK_EQUAL(solution.get_strategy(p), q);
+    BOOST_CHECK_EQUAL(solution.get_strategy(y), x);
+    BOOST_CHECK(verify(graph, solution, Threshold::Positive));
+}
+
+BOOST_FIXTURE_TEST_CASE(TestStrategyImprovementWithLargeWeights, LargeWeightsGame) {
+    StrategyImprovementSolver solver(1);
+    const auto solution = solver.solve(graph);
+
+    BOOST_CHECK_EQUAL(solution.get_value(d), boost::rational<long long>(500000000));
+    BOOST_CHECK_EQUAL(solution.get_strategy(c), c);
+    BOOST_CHECK(verify(graph, solution, Threshold::Positive));
+}
+
+BOOST_FIXTURE_TEST_CASE(TestZwickPatersonValuesAndWinners, ZeroCycleGame) {
+    ZwickPatersonSolver solver(2);
+    const auto solution = solver.solve(graph);
+
+    check_values(solution);
+    check_winners(solution);
+    BOOST_CHECK_EQUAL(solution.get_strategy(y), x);
+    BOOST_CHECK(verify(graph, solution, Threshold::Positive));
+}
+
+BOOST_FIXTURE_TEST_CASE(TestZwickPatersonWithLargeWeights, LargeWeightsGame) {
+    // The worst-case bound would take 2n²W = 10^11 rounds to isolate the
+    // values; the optimal choices are certified after a few.
+    ZwickPatersonSolver solver(1);
+    const auto solution = solver.solve(graph);
+
+    using Value = boost::rational<long long>;
+    BOOST_CHECK_EQUAL(solution.get_value(a), Value(2000000000));
+    BOOST_CHECK_EQUAL(solution.get_value(c), Value(-2000000000));
+    for (const auto v : {d, e, f}) {
+        BOOST_CHECK_EQUAL(solution.get_value(v), Value(500000000));
+    }
+    BOOST_CHECK_EQUAL(solution.get_strategy(a), a);
+    BOOST_CHECK(verify(graph, solution, Threshold::Positive));
+}
+
+BOOST_AUTO_TEST_CASE(TestZwickPatersonCertifiesPeriodicChoices) {
+    // Player 1 owns every vertex but v0 and v2 and holds all plays to the
+    // cycle v5 v8 v7 v6 v3 of mean -8/5.  The greedy choices of a single
+    // round alternate at v5 with the phase of the horizon, so they pass the
+    // optimality check only after improvement.
+    graph::Graph graph;
+    const std::vector<std::pair<int, int>> vertices{{0, -3}, {1, -1}, {0, 3}, {1, -3}, {1, 1},
+                                                    {1, 0},  {1, 1},  {1, -3}, {1, -3}, {1, -1}};
+    std::vector<graph::Vertex> v;
+    for (std::size_t i = 0; i < vertices.size(); ++i) {
+        v.push_back(graph::add_vertex(graph, "v" + std::to_string(i), vertices[i].first, vertices[i].second));
+    }
+    for (const auto &[from, to] : std::vector<std::pair<int, int>>{
+             {0, 5}, {0, 0}, {1, 9}, {1, 5}, {2, 6}, {2, 9}, {3, 4}, {3, 5}, {3, 6}, {4, 6}, {5, 3},
+             {5, 8}, {5, 4}, {6, 4}, {6, 1}, {6, 3}, {7, 6}, {7, 2}, {8, 5}, {8, 7}, {9, 5}, {9, 8}}) {
+        graph::add_edge(graph, v[from], v[to], "");
+    }
+
+    ZwickPatersonSolver solver(1);
+    const auto solution = solver.solve(graph);
+
+    for (const auto u : v) {
+        BOOST_CHECK_EQUAL(solution.get_value(u), boost::rational<long long>(-8, 5));
+    }
+    BOOST_CHECK_EQUAL(solution.get_strategy(v[5]), v[8]);
+    BOOST_CHECK(verify(graph, solution, Threshold::Positive));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
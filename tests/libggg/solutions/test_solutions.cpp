@@ -0,0 +1,360 @@
+#include "libggg/buechi/verifier.hpp"
+#include "libggg/mean_payoff/verifier.hpp"
+#include "libggg/parity/graph.hpp"
+#include "libggg/parity/verifier.hpp"
+#include "libggg/solutions/binary_solution.hpp"
+#include "libggg/solutions/concepts.hpp"
+#include "libggg/solutions/rsqsolution.hpp"
+#include "libggg/solutions/rssolution.hpp"
+#include "libggg/strategy/mixing.hpp"
+#include <boost/rational.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+using namespace ggg::solutions;
+using ggg::parity::graph::Graph;
+using Vertex = boost::graph_traits<Graph>::vertex_descriptor;
+
+BOOST_AUTO_TEST_SUITE(SolutionTests)
+
+static_assert(HasRegions<RSSolution<Graph>, Graph>);
+static_assert(HasStrategy<RSSolution<Graph>, Graph>);
+static_assert(HasValueMapping<RSQSolution<Graph>, Graph>);
+static_assert(sizeof(DenseSlot<double>::storage_type) == sizeof(double));
+
+BOOST_AUTO_TEST_CASE(TestDenseVertexMapIteratesSetEntriesInOrder) {
+    DenseVertexMap<Vertex, int> map;
+    BOOST_CHECK(map.empty());
+    map.set(5, 50);
+    map.set(2, 20);
+    map.set(5, 55);
+
+    BOOST_CHECK_EQUAL(map.size(), 2);
+    BOOST_CHECK(map.contains(2));
+    BOOST_CHECK(!map.contains(3));
+    BOOST_CHECK(!map.contains(100));
+    BOOST_CHECK_EQUAL(map.count(5), 1);
+    BOOST_CHECK_EQUAL(map.at(5), 55);
+    BOOST_CHECK_THROW(map.at(3), std::out_of_range);
+    BOOST_CHECK_EQUAL(map.find(2)->second, 20);
+    BOOST_CHECK(map.find(4) == map.end());
+
+    std::vector<std::pair<Vertex, int>> entries;
+    for (const auto &[vertex, value] : map) {
+        entries.emplace_back(vertex, value);
+    }
+    const std::vector<std::pair<Vertex, int>> expected = {{2, 20}, {5, 55}};
+    BOOST_CHECK(entries == expected);
+
+    map.erase(2);
+    BOOST_CHECK_EQUAL(map.size(), 1);
+    BOOST_CHECK_EQUAL(map.begin()->first, 5);
+}
+
+BOOST_AUTO_TEST_CASE(TestDenseVertexMapTracksPresenceOfPlainValues) {
+    // Any double, NaN included, is a value: presence is kept apart.
+    DenseVertexMap<Vertex, double> map;
+    map.reserve(4);
+    BOOST_CHECK(map.empty());
+    BOOST_CHECK(!map.contains(0));
+    map.set(1, 0.0);
+    map.set(3, std::numeric_limits<double>::quiet_NaN());
+
+    BOOST_CHECK_EQUAL(map.size(), 2);
+    BOOST_CHECK(!map.contains(0));
+    BOOST_CHECK(map.contains(1));
+    BOOST_CHECK(std::isnan(map.at(3)));
+    BOOST_CHECK_EQUAL(map.get(2, -1.0), -1.0);
+
+    map.erase(1);
+    BOOST_CHECK(!map.contains(1));
+    BOOST_CHECK_EQUAL(map.begin()->first, 3);
+    map.set(1, 2.5);
+    BOOST_CHECK_EQUAL(map.size(), 2);
+    BOOST_CHECK_EQUAL(map.at(1), 2.5);
+
+    map.clear();
+    BOOST_CHECK(map.begin() == map.end());
+}
+
+BOOST_AUTO_TEST_CASE(TestRegionsDistinguishUnsetFromUndecided) {
+    RSSolution<Graph> solution;
+    solution.set_winning_player(1, 1);
+    solution.set_winning_player(3, -1);
+
+    BOOST_CHECK_EQUAL(solution.get_winning_player(0), -1);
+    BOOST_CHECK(solution.is_won_by_player1(1));
+    BOOST_CHECK(!solution.is_won_by_player0(1));
+    BOOST_CHECK_EQUAL(solution.get_winning_player(3), -1);
+    BOOST_CHECK_EQUAL(solution.get_winning_regions().size(), 2);
+    BOOST_CHECK_EQUAL(solution.to_json(), "{\"winning_regions\":{\"1\": 1,\"3\": -1},\"strategy\":{}}");
+}
+
+BOOST_AUTO_TEST_CASE(TestStrategyKeepsNullVertexEntries) {
+    const auto null = boost::graph_traits<Graph>::null_vertex();
+    RSSolution<Graph> solution;
+    solution.set_strategy(0, 2);
+    solution.set_strategy(2, null);
+
+    BOOST_CHECK_EQUAL(solution.get_strategy(0), 2);
+    BOOST_CHECK(solution.has_strategy(2));
+    BOOST_CHECK_EQUAL(solution.get_strategy(2), null);
+    BOOST_CHECK(!solution.has_strategy(1));
+    BOOST_CHECK_EQUAL(solution.get_strategy(1), null);
+    BOOST_CHECK_EQUAL(solution.get_strategies().size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(TestValuesAndMixingStrategies) {
+    RSQSolution<Graph, ggg::strategy::MixingStrategy<Graph>> solution;
+    solution.set_value(1, 0.5);
+    solution.set_strategy(1, {{0, 0.25}, {2, 0.75}});
+
+    BOOST_CHECK(solution.has_value(1));
+    BOOST_CHECK(!solution.has_value(0));
+    BOOST_CHECK_EQUAL(solution.get_value(0), 0.0);
+    BOOST_CHECK_EQUAL(solution.get_value(1), 0.5);
+    BOOST_CHECK_EQUAL(solution.get_strategy(1).size(), 2);
+    BOOST_CHECK(solution.get_strategy(0).empty());
+
+    std::ostringstream os;
+    os << static_cast<const QSolution<Graph> &>(solution);
+    BOOST_CHECK_EQUAL(os.str(), "Values: {1:0.5}");
+}
+
+BOOST_AUTO_TEST_CASE(TestOutputSinkMatchesStringFormatting) {
+    const std::vector<double> samples = {0.0, -0.0, 0.5, -1.25, 1e-7, 123456789.123, 1e300,
+                                         std::numeric_limits<double>::infinity()};
+    for (const double x : samples) {
+        std::ostringstream fixed;
+        std::ostringstream general;
+        {
+            ggg::utils::OutputSink out(fixed);
+            out.fixed(x);
+        }
+        {
+            ggg::utils::OutputSink out(general);
+            out.general(x);
+        }
+        std::ostringstream expected;
+        expected << x;
+        BOOST_CHECK_EQUAL(fixed.str(), std::to_string(x));
+        BOOST_CHECK_EQUAL(general.str(), expected.str());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestStreamedJsonMatchesToJson) {
+    RSQSolution<Graph> solution;
+    for (Vertex v = 0; v < 5000; ++v) {
+        solution.set_winning_player(v, static_cast<int>(v % 2));
+        solution.set_strategy(v, (v * 7) % 5000);
+        solution.set_value(v, v / 3.0);
+    }
+
+    // A minimal buffer and flushing every few bytes must not change the bytes written.
+    std::ostringstream streamed;
+    {
+        ggg::utils::OutputSink out(streamed, 100, 0);
+        solution.write_json(out);
+    }
+    BOOST_CHECK_EQUAL(streamed.str(), solution.to_json());
+    BOOST_CHECK(streamed.str().starts_with("{\"winning_regions\":{\"0\": 0,\"1\": 1,"));
+    BOOST_CHECK(streamed.str().ends_with("\"4999\": 1666.333333}}"));
+}
+
+namespace {
+
+Graph make_path(std::size_t n) {
+    Graph graph;
+    for (std::size_t v = 0; v < n; ++v) {
+        ggg::parity::graph::add_vertex(graph, "v" + std::to_string(v), static_cast<int>(v % 2), static_cast<int>(v % 3));
+    }
+    return graph;
+}
+
+template <typename Solution>
+std::string binary_bytes(const Graph &graph, const Solution &solution, double time, std::map<std::string, std::string> statistics = {}) {
+    std::ostringstream os;
+    {
+        ggg::utils::OutputSink out(os);
+        binary::write(out, graph, solution, time, std::move(statistics));
+    }
+    return os.str();
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(TestBinarySolutionRoundTrip) {
+    const auto graph = make_path(130);
+    RSQSolution<Graph> solution;
+    for (Vertex v = 0; v < 130; ++v) {
+        if (v % 5 != 4) {
+            solution.set_winning_player(v, static_cast<int>(v % 3 == 0));
+        }
+        if (v % 7 != 0) {
+            solution.set_strategy(v, (v + 1) % 130);
+        }
+        if (v % 2 == 0) {
+            solution.set_value(v, v * 0.25);
+        }
+    }
+    solution.set_strategy(7, boost::graph_traits<Graph>::null_vertex());
+
+    const std::string bytes = binary_bytes(graph, solution, 12.5, {{"iterations", "42"}, {"note", ""}});
+    BOOST_CHECK_EQUAL(bytes.size() % 8, 0);
+    const auto loaded = binary::BinarySolution::from_bytes(std::vector<char>(bytes.begin(), bytes.end()));
+
+    BOOST_CHECK_EQUAL(loaded.num_vertices(), 130);
+    BOOST_CHECK_EQUAL(loaded.solve_time(), 12.5);
+    BOOST_CHECK(loaded.value_kind() == binary::ValueKind::Float64);
+    for (Vertex v = 0; v < 130; ++v) {
+        BOOST_CHECK_EQUAL(loaded.get_winning_player(v), solution.get_winning_player(v));
+        BOOST_CHECK_EQUAL(loaded.has_strategy(v), solution.has_strategy(v));
+        BOOST_CHECK_EQUAL(loaded.get_strategy(v), solution.get_strategy(v));
+        BOOST_CHECK_EQUAL(loaded.has_value(v), solution.has_value(v));
+        BOOST_CHECK_EQUAL(loaded.get_value(v), solution.get_value(v));
+    }
+    const std::map<std::string, std::string> statistics = {{"iterations", "42"}, {"note", ""}};
+    BOOST_CHECK(loaded.get_statistics() == statistics);
+    static_assert(HasRegions<binary::BinarySolution, Graph>);
+}
+
+BOOST_AUTO_TEST_CASE(TestBinarySolutionExactValuesAndMappedFile) {
+    const auto graph = make_path(3);
+    RSQSolution<Graph, ggg::strategy::DeterministicStrategy<Graph>, boost::rational<long long>> solution;
+    solution.set_winning_player(0, 0);
+    solution.set_value(0, boost::rational<long long>(-7, 3));
+    solution.set_value(2, boost::rational<long long>(5));
+
+    const std::string path = "test_binary_solution.sol";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << binary_bytes(graph, solution, 0.0);
+    }
+    const auto loaded = binary::BinarySolution::open(path);
+    std::remove(path.c_str());
+
+    BOOST_CHECK(loaded.value_kind() == binary::ValueKind::Rational64);
+    using Exact = std::pair<std::int64_t, std::int64_t>;
+    BOOST_CHECK((loaded.get_exact_value(0) == Exact{-7, 3}));
+    BOOST_CHECK((loaded.get_exact_value(2) == Exact{5, 1}));
+    BOOST_CHECK(!loaded.has_value(1));
+    BOOST_CHECK_EQUAL(loaded.get_winning_player(1), -1);
+    BOOST_CHECK(!loaded.has_strategy(0));
+}
+
+BOOST_AUTO_TEST_CASE(TestBinarySolutionRejectsInvalidData) {
+    const auto graph = make_path(70);
+    RSSolution<Graph> solution;
+    std::string bytes = binary_bytes(graph, solution, 0.0);
+
+    BOOST_CHECK_THROW(binary::BinarySolution::from_bytes(std::vector<char>(bytes.begin(), bytes.begin() + 40)), std::runtime_error);
+    BOOST_CHECK_THROW(binary::BinarySolution::from_bytes(std::vector<char>(bytes.begin(), bytes.end() - 8)), std::runtime_error);
+    bytes[0] = 'X';
+    BOOST_CHECK_THROW(binary::BinarySolution::from_bytes(std::vector<char>(bytes.begin(), bytes.end())), std::runtime_error);
+}
+
+namespace {
+
+// v0 (player 0, priority 4) -> v1, v2; v1 (player 1, priority 3) -> v0, v1; v2 (player 1, priority 1) -> v2
+Graph make_parity_game() {
+    Graph graph;
+    ggg::parity::graph::add_vertex(graph, "v0", 0, 4);
+    ggg::parity::graph::add_vertex(graph, "v1", 1, 3);
+    ggg::parity::graph::add_vertex(graph, "v2", 1, 1);
+    ggg::parity::graph::add_edge(graph, 0, 1, "");
+    ggg::parity::graph::add_edge(graph, 0, 2, "");
+    ggg::parity::graph::add_edge(graph, 1, 0, "");
+    ggg::parity::graph::add_edge(graph, 1, 1, "");
+    ggg::parity::graph::add_edge(graph, 2, 2, "");
+    return graph;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(TestParityVerifierAcceptsCertificatesOnly) {
+    const auto graph = make_parity_game();
+    // Player 1 wins everywhere: v1 loops on priority 3, v2 on priority 1.
+    RSSolution<Graph> solution;
+    for (Vertex v = 0; v < 3; ++v) {
+        solution.set_winning_player(v, 1);
+    }
+    solution.set_strategy(1, 1);
+    solution.set_strategy(2, 2);
+    BOOST_CHECK(ggg::parity::verify(graph, solution));
+    BOOST_CHECK(ggg::parity::verify(graph, binary::BinarySolution::from_bytes([&] {
+        const std::string bytes = binary_bytes(graph, solution, 0.0);
+        return std::vector<char>(bytes.begin(), bytes.end());
+    }())));
+
+    // Going back from v1 to v0 lets player 0 win the cycle v0 v1 on priority 4.
+    solution.set_strategy(1, 0);
+    const auto wrong_strategy = ggg::parity::verify(graph, solution);
+    BOOST_CHECK(!wrong_strategy);
+    BOOST_CHECK_EQUAL(wrong_strategy.reason, "player 0 wins a cycle through 'v0' (priority 4) in the winning region of player 1");
+
+    solution.set_strategy(1, 1);
+    solution.set_winning_player(1, 0);
+    BOOST_CHECK(!ggg::parity::verify(graph, solution));
+    solution.set_winning_player(1, -1);
+    BOOST_CHECK_EQUAL(ggg::parity::verify(graph, solution).reason, "vertex 'v1' has no winner");
+}
+
+BOOST_AUTO_TEST_CASE(TestBuechiVerifierChecksAcceptingCycles) {
+    // Player 1 wins by visiting priority 1 infinitely often.
+    Graph graph;
+    ggg::parity::graph::add_vertex(graph, "a", 1, 1);
+    ggg::parity::graph::add_vertex(graph, "b", 0, 0);
+    ggg::parity::graph::add_edge(graph, 0, 1, "");
+    ggg::parity::graph::add_edge(graph, 1, 0, "");
+    ggg::parity::graph::add_edge(graph, 1, 1, "");
+
+    RSSolution<Graph> solution;
+    solution.set_winning_player(0, 0);
+    solution.set_winning_player(1, 0);
+    solution.set_strategy(1, 1);
+    BOOST_CHECK(ggg::buechi::verify(graph, solution));
+    solution.set_strategy(1, 0);
+    BOOST_CHECK_EQUAL(ggg::buechi::verify(graph, solution).reason,
+                      "player 1 can visit the accepting vertex 'a' infinitely often in the winning region of player 0");
+}
+
+BOOST_AUTO_TEST_CASE(TestMeanPayoffVerifierThresholds) {
+    namespace mp = ggg::mean_payoff;
+    const auto make_game = [](int weight_u) {
+        // u (player 0) -> w; w (player 1, weight -2) -> u, w
+        mp::graph::Graph graph;
+        mp::graph::add_vertex(graph, "u", 0, weight_u);
+        mp::graph::add_vertex(graph, "w", 1, -2);
+        mp::graph::add_edge(graph, 0, 1, "");
+        mp::graph::add_edge(graph, 1, 0, "");
+        mp::graph::add_edge(graph, 1, 1, "");
+        return graph;
+    };
+    RSSolution<mp::graph::Graph> solution;
+    solution.set_winning_player(0, 1);
+    solution.set_winning_player(1, 1);
+    solution.set_strategy(1, 1);
+
+    // Player 1 wins everywhere by looping on w ...
+    const auto graph = make_game(3);
+    BOOST_CHECK(mp::verify(graph, solution, mp::Threshold::Positive));
+    // ... but not by going back to u, closing the cycle u w of weight 1.
+    solution.set_strategy(1, 0);
+    const auto positive = mp::verify(graph, solution, mp::Threshold::Positive);
+    BOOST_CHECK(!positive);
+    BOOST_CHECK(positive.reason.starts_with("player 0 wins a positive cycle through"));
+
+    // The cycle u w of weight 0 goes to player 0 only if it wins non-negative mean payoffs.
+    const auto zero_game = make_game(2);
+    BOOST_CHECK(mp::verify(zero_game, solution, mp::Threshold::Positive, 1));
+    const auto zero = mp::verify(zero_game, solution, mp::Threshold::NonNegative, 1);
+    BOOST_CHECK(zero.reason.starts_with("player 0 wins a zero-weight cycle through"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,55 @@
+#include "libggg/solvers/cancellation.hpp"
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <thread>
+
+using namespace ggg::solvers;
+
+BOOST_AUTO_TEST_SUITE(CancellationTests)
+
+BOOST_AUTO_TEST_CASE(TestScopeInstallsToken) {
+    BOOST_CHECK(!cancellation_requested());
+    CancellationToken outer;
+    CancellationToken inner;
+    inner.cancel();
+    {
+        const CancellationScope outer_scope(outer);
+        BOOST_CHECK_NO_THROW(throw_if_cancelled());
+        {
+            const CancellationScope inner_scope(inner);
+            BOOST_CHECK_THROW(throw_if_cancelled(), Cancelled);
+        }
+        BOOST_CHECK(!cancellation_requested());
+        // Tokens are per thread: another thread sees none.
+        bool seen = true;
+        outer.cancel();
+        std::thread([&seen] { seen = cancellation_requested(); }).join();
+        BOOST_CHECK(!seen);
+        BOOST_CHECK(cancellation_requested());
+    }
+    BOOST_CHECK(!cancellation_requested());
+}
+
+BOOST_AUTO_TEST_CASE(TestWatchdogCancelsAtDeadline) {
+    using Clock = DeadlineWatchdog::Clock;
+    CancellationToken expired;
+    CancellationToken unwatched;
+    CancellationToken distant;
+    {
+        DeadlineWatchdog watchdog;
+        watchdog.watch(distant, Clock::now() + std::chrono::hours(1));
+        watchdog.watch(unwatched, Clock::now() + std::chrono::milliseconds(20));
+        watchdog.unwatch(unwatched);
+        watchdog.watch(expired, Clock::now() + std::chrono::milliseconds(20));
+        const auto limit = Clock::now() + std::chrono::seconds(10);
+        while (!expired.cancelled() && Clock::now() < limit) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    BOOST_CHECK(expired.cancelled());
+    BOOST_CHECK(!unwatched.cancelled());
+    BOOST_CHECK(!distant.cancelled());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
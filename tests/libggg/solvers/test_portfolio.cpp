@@ -0,0 +1,127 @@
+#include "libggg/solvers/portfolio.hpp"
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace ggg::solvers;
+
+namespace {
+
+struct Game {
+    int answer;
+};
+
+// Answers after @p delay_ms, checking for cancellation meanwhile
+class DelayedSolver : public Solver<Game, int> {
+  public:
+    explicit DelayedSolver(int delay_ms = 0) : delay_ms_(delay_ms) {}
+
+    int solve(const Game &game) override {
+        const auto until = std::chrono::steady_clock::now() + std::chrono::milliseconds(delay_ms_);
+        while (std::chrono::steady_clock::now() < until) {
+            throw_if_cancelled();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return game.answer;
+    }
+
+    std::string get_name() const override { return "Delayed " + std::to_string(delay_ms_) + " ms"; }
+
+  private:
+    int delay_ms_;
+};
+
+// Runs until cancelled, counting the runs that were
+PortfolioSolver<Game, int>::Run endless(std::atomic<int> &cancelled) {
+    return [&cancelled](const Game &) -> int {
+        try {
+            while (true) {
+                throw_if_cancelled();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        } catch (const Cancelled &) {
+            ++cancelled;
+            throw;
+        }
+    };
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(PortfolioTests)
+
+BOOST_AUTO_TEST_CASE(TestFirstSolutionWinsAndLosersAreCancelled) {
+    std::atomic<int> cancelled{0};
+    PortfolioSolver<Game, int> portfolio;
+    portfolio.add("endless", endless(cancelled)).add<DelayedSolver>(5).add("also endless", endless(cancelled));
+    BOOST_CHECK_EQUAL(portfolio.size(), 3u);
+    BOOST_CHECK_EQUAL(portfolio.get_name(), "Portfolio (endless, Delayed 5 ms, also endless)");
+    BOOST_CHECK(portfolio.winner().empty());
+
+    BOOST_CHECK_EQUAL(portfolio.solve(Game{42}), 42);
+    BOOST_CHECK_EQUAL(portfolio.winner(), "Delayed 5 ms");
+    // solve() returns only once every loser has stopped
+    BOOST_CHECK_EQUAL(cancelled.load(), 2);
+
+    BOOST_CHECK_EQUAL(portfolio.solve(Game{7}), 7);
+    BOOST_CHECK_EQUAL(cancelled.load(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(TestFailuresDropOutOfTheRace) {
+    const auto failing = [](const Game &) -> int { throw std::runtime_error("no luck"); };
+    PortfolioSolver<Game, int> portfolio;
+    portfolio.add("failing", failing).add<DelayedSolver>(20);
+    BOOST_CHECK_EQUAL(portfolio.solve(Game{3}), 3);
+    BOOST_CHECK_EQUAL(portfolio.winner(), "Delayed 20 ms");
+
+    PortfolioSolver<Game, int> hopeless;
+    hopeless.add("failing", failing).add("also failing", failing);
+    BOOST_CHECK_EXCEPTION(hopeless.solve(Game{3}), std::runtime_error,
+                          [](const std::runtime_error &e) { return std::string(e.what()) == "no luck"; });
+    BOOST_CHECK(hopeless.winner().empty());
+
+    BOOST_CHECK_THROW((PortfolioSolver<Game, int>().solve(Game{3})), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(TestRejectedSolutionsDropOutOfTheRace) {
+    const auto wrong = [](const Game &game) { return game.answer + 1; };
+    const auto check = [](const Game &game, const int &answer) {
+        if (answer != game.answer) {
+            throw std::runtime_error("wrong answer");
+        }
+    };
+    PortfolioSolver<Game, int> portfolio;
+    portfolio.add("wrong", wrong).add<DelayedSolver>(20).check_with(check);
+    BOOST_CHECK_EQUAL(portfolio.solve(Game{5}), 5);
+    BOOST_CHECK_EQUAL(portfolio.winner(), "Delayed 20 ms");
+
+    PortfolioSolver<Game, int> hopeless;
+    hopeless.add("wrong", wrong).check_with(check);
+    BOOST_CHECK_EXCEPTION(hopeless.solve(Game{5}), std::runtime_error,
+                          [](const std::runtime_error &e) { return std::string(e.what()) == "wrong answer"; });
+    BOOST_CHECK(hopeless.winner().empty());
+}
+
+BOOST_AUTO_TEST_CASE(TestCancellingThePortfolioCancelsItsMembers) {
+    std::atomic<int> cancelled{0};
+    PortfolioSolver<Game, int> portfolio;
+    portfolio.add("endless", endless(cancelled)).add("also endless", endless(cancelled));
+
+    CancellationToken token;
+    std::thread canceller([&token] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        token.cancel();
+    });
+    {
+        const CancellationScope scope(token);
+        BOOST_CHECK_THROW(portfolio.solve(Game{1}), Cancelled);
+    }
+    canceller.join();
+    BOOST_CHECK_EQUAL(cancelled.load(), 2);
+    BOOST_CHECK(portfolio.winner().empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,178 @@
+#include "libggg/stochastic_discounted/choice_matrix.hpp"
+#include "libggg/stochastic_discounted/graph.hpp"
+#include "libggg/stochastic_discounted/interval_value_iteration.hpp"
+#include "libggg/stochastic_discounted/numeric.hpp"
+#include "libggg/stochastic_discounted/policy_evaluation.hpp"
+#include "libggg/stochastic_discounted/topological_value_iteration.hpp"
+#include "libggg/stochastic_discounted/value_iteration.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace ggg::stochastic_discounted;
+using namespace ggg::stochastic_discounted::graph;
+
+namespace {
+
+// Two vertices, every edge discounted by 1/2, with values
+// x0 = max(1 + x1/2, x0/2) = 2/3 and x1 = min(-1 + x0/2, 2 + x1/2) = -2/3.
+struct MaxMinGame {
+    Graph graph;
+    Vertex v0 = add_vertex(graph, "max", 0);
+    Vertex v1 = add_vertex(graph, "min", 1);
+
+    MaxMinGame() {
+        add_edge(graph, v0, v1, "edge_0_1", 1.0, 0.5, 0.0);
+        add_edge(graph, v0, v0, "edge_0_0", 0.0, 0.5, 0.0);
+        add_edge(graph, v1, v0, "edge_1_0", -1.0, 0.5, 0.0);
+        add_edge(graph, v1, v1, "edge_1_1", 2.0, 0.5, 0.0);
+    }
+};
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(StochasticDiscountedEngineTests, MaxMinGame)
+
+BOOST_AUTO_TEST_CASE(ValueIterationSweepOrdersReachPrecision) {
+    const auto matrix = make_choice_matrix(graph);
+    BOOST_TEST(contraction_factor(matrix) == 0.5);
+
+    for (const auto order : {SweepOrder::Jacobi, SweepOrder::GaussSeidel, SweepOrder::RedBlack}) {
+        ValueIteration engine(matrix, order, 2);
+        std::vector<double> values(2, 0.0);
+        BOOST_TEST(engine.run(values, 1e-9) > 0);
+        BOOST_TEST(engine.error_bound() <= 1e-9);
+        BOOST_TEST(std::abs(values[v0] - 2.0 / 3.0) <= 1e-9);
+        BOOST_TEST(std::abs(values[v1] + 2.0 / 3.0) <= 1e-9);
+        BOOST_TEST(matrix.successor[engine.choices()[v0]] == v1);
+        BOOST_TEST(matrix.successor[engine.choices()[v1]] == v0);
+    }
+
+    ValueIteration engine(matrix, SweepOrder::Jacobi);
+    std::vector<double> values(2, 0.0);
+    BOOST_CHECK_THROW(engine.run(values, 0.0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(PolicyEvaluationSolversAgree) {
+    const auto matrix = make_choice_matrix(graph);
+    const auto choice = [&](Vertex from, Vertex to) {
+        for (std::size_t c = matrix.first_choice(from); c < matrix.end_choice(from); ++c) {
+            if (matrix.successor[c] == to) {
+                return c;
+            }
+        }
+        return matrix.end_choice(from);
+    };
+
+    // Cyclic profile: x0 = 1 + x1/2, x1 = -1 + x0/2
+    const std::vector<std::size_t> cyclic = {choice(v0, v1), choice(v1, v0)};
+    for (const auto solver : {LinearSolver::GaussSeidel, LinearSolver::BiCGSTAB}) {
+        PolicyEvaluation evaluation(matrix, solver);
+        std::vector<double> values(2, 0.0);
+        BOOST_CHECK(evaluation.evaluate(cyclic, values, 1e-12) == solver);
+        BOOST_TEST(evaluation.iterations() > 0);
+        BOOST_TEST(std::abs(values[v0] - 2.0 / 3.0) <= 1e-12);
+        BOOST_TEST(std::abs(values[v1] + 2.0 / 3.0) <= 1e-12);
+    }
+
+    // Acyclic up to self loops: x1 = 2 + x1/2, x0 = 1 + x1/2
+    const std::vector<std::size_t> acyclic = {choice(v0, v1), choice(v1, v1)};
+    PolicyEvaluation evaluation(matrix);
+    std::vector<double> values(2, 0.0);
+    BOOST_CHECK(evaluation.evaluate(acyclic, values) == LinearSolver::Direct);
+    BOOST_TEST(values[v1] == 4.0, boost::test_tools::tolerance(1e-12));
+    BOOST_TEST(values[v0] == 3.0, boost::test_tools::tolerance(1e-12));
+}
+
+BOOST_AUTO_TEST_CASE(TopologicalValueIterationSolvesComponentsInOrder) {
+    // The fixture is the cyclic component {v0, v1};
+    // v2 = max(3 + x0/2, 1 + x2/2) = 10/3 reads it, and v3 = -1 + x2/2 = 2/3 reads v2.
+    auto v2 = add_vertex(graph, "entry", 0);
+    auto v3 = add_vertex(graph, "source", 1);
+    add_edge(graph, v2, v0, "edge_2_0", 3.0, 0.5, 0.0);
+    add_edge(graph, v2, v2, "edge_2_2", 1.0, 0.5, 0.0);
+    add_edge(graph, v3, v2, "edge_3_2", -1.0, 0.5, 0.0);
+
+    const auto matrix = make_choice_matrix(graph);
+    TopologicalValueIteration engine(matrix, 2);
+    BOOST_TEST(engine.num_components() == 3);
+    BOOST_TEST(engine.num_cyclic_components() == 1);
+    BOOST_TEST(engine.num_levels() == 3);
+
+    std::vector<double> values(4, 0.0);
+    BOOST_TEST(engine.run(values, 1e-9) > 0);
+    BOOST_TEST(engine.error_bound() <= 1e-9);
+    BOOST_TEST(std::abs(values[v0] - 2.0 / 3.0) <= 1e-9);
+    BOOST_TEST(std::abs(values[v1] + 2.0 / 3.0) <= 1e-9);
+    BOOST_TEST(std::abs(values[v2] - 10.0 / 3.0) <= 1e-9);
+    BOOST_TEST(std::abs(values[v3] - 2.0 / 3.0) <= 1e-9);
+    BOOST_TEST(matrix.successor[engine.choices()[v2]] == v0);
+    BOOST_TEST(matrix.successor[engine.choices()[v3]] == v2);
+}
+
+BOOST_AUTO_TEST_CASE(IntervalValueIterationBracketsValues) {
+    const std::vector<double> exact = {2.0 / 3.0, -2.0 / 3.0};
+
+    const auto matrix = make_choice_matrix(graph);
+
+    // Every intermediate interval contains the value; stop after three sweeps.
+    IntervalValueIteration engine(matrix);
+    std::vector<double> values(2, 0.0);
+    double last_width = std::numeric_limits<double>::infinity();
+    const auto sweeps = engine.run(values, 1e-9, [&](const IntervalProgress &progress) {
+        for (std::size_t v = 0; v < exact.size(); ++v) {
+            BOOST_TEST(progress.lower[v] <= exact[v]);
+            BOOST_TEST(progress.upper[v] >= exact[v]);
+        }
+        BOOST_TEST(progress.width <= last_width);
+        last_width = progress.width;
+        return progress.sweeps < 3;
+    });
+    BOOST_TEST(sweeps == 3);
+    BOOST_TEST(!engine.converged());
+    BOOST_TEST(engine.error_bound() > 1e-9);
+    for (std::size_t v = 0; v < exact.size(); ++v) {
+        BOOST_TEST(std::abs(values[v] - exact[v]) <= engine.error_bound());
+    }
+
+    BOOST_TEST(engine.run(values, 1e-9) > 3);
+    BOOST_TEST(engine.converged());
+    BOOST_TEST(engine.error_bound() <= 1e-9);
+    for (std::size_t v = 0; v < exact.size(); ++v) {
+        BOOST_TEST(std::abs(values[v] - exact[v]) <= 1e-9);
+        BOOST_TEST(engine.upper()[v] - engine.lower()[v] <= 2e-9);
+    }
+    BOOST_TEST(matrix.successor[engine.choices()[v0]] == v1);
+    BOOST_TEST(matrix.successor[engine.choices()[v1]] == v0);
+}
+
+BOOST_AUTO_TEST_CASE(ValueTypesAgree) {
+    // float iterates to the precision it can certify
+    const auto single = make_choice_matrix<float>(graph);
+    const float precision = std::max(1e-5f, attainable_precision(single));
+    BOOST_TEST(precision < 1e-3f);
+    BasicValueIteration<float> engine(single, SweepOrder::GaussSeidel);
+    std::vector<float> approximate(2, 0.0f);
+    engine.run(approximate, precision);
+    BOOST_TEST(std::abs(approximate[v0] - 2.0f / 3.0f) <= precision);
+    BOOST_TEST(std::abs(approximate[v1] + 2.0f / 3.0f) <= precision);
+    BOOST_TEST(attainable_precision(make_choice_matrix<double>(graph)) < 1e-12);
+
+    // Rational evaluates the optimal (cyclic) profile exactly by elimination
+    const auto exact = make_choice_matrix<Rational>(graph);
+    const std::vector<std::size_t> profile = {engine.choices()[v0], engine.choices()[v1]};
+    BasicPolicyEvaluation<Rational> evaluation(exact);
+    std::vector<Rational> values(2, Rational(0));
+    BOOST_CHECK(evaluation.evaluate(profile, values) == LinearSolver::Elimination);
+    BOOST_TEST(values[v0] == Rational(2, 3));
+    BOOST_TEST(values[v1] == Rational(-2, 3));
+    std::size_t choice;
+    BOOST_TEST(bellman_backup(exact, v0, values, choice) == values[v0]);
+    BOOST_TEST(bellman_backup(exact, v1, values, choice) == values[v1]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
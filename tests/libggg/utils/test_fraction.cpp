@@ -0,0 +1,57 @@
+#include "libggg/utils/fraction.hpp"
+#include <boost/test/unit_test.hpp>
+
+using ggg::utils::Fraction;
+using namespace ggg::utils;
+
+namespace {
+
+bool same(const Fraction &a, long long num, long long den) {
+    return a.num == num && a.den == den;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(FractionTests)
+
+BOOST_AUTO_TEST_CASE(TestComparison) {
+    BOOST_CHECK(Fraction({1, 3}) < Fraction({1, 2}));
+    BOOST_CHECK(Fraction({-1, 2}) < Fraction({-1, 3}));
+    BOOST_CHECK(Fraction({2, 4}) == Fraction({1, 2}));
+    BOOST_CHECK(Fraction({2, 4}) <= Fraction({1, 2}));
+    BOOST_CHECK(Fraction({3, 4}).to_rational() == boost::rational<long long>(3, 4));
+}
+
+BOOST_AUTO_TEST_CASE(TestSimplestBetween) {
+    BOOST_CHECK(same(simplest_between({1, 3}, {3, 4}), 1, 2));
+    BOOST_CHECK(same(simplest_between({5, 2}, {5, 2}), 5, 2));
+    BOOST_CHECK(same(simplest_between({-7, 3}, {-9, 5}), -2, 1));
+    BOOST_CHECK(same(simplest_between({-37, 50}, {-7, 10}), -5, 7));
+    BOOST_CHECK(same(simplest_between({30, 100}, {34, 100}), 1, 3));
+}
+
+BOOST_AUTO_TEST_CASE(TestFareyNeighbours) {
+    const auto [left, right] = farey_neighbours({1, 3}, 5);
+    BOOST_CHECK(same(left, 1, 4));
+    BOOST_CHECK(same(right, 2, 5));
+
+    const auto [below, above] = farey_neighbours({-2, 1}, 4);
+    BOOST_CHECK(same(below, -9, 4));
+    BOOST_CHECK(same(above, -7, 4));
+}
+
+BOOST_AUTO_TEST_CASE(TestUniqueOfOrder) {
+    Fraction result{0, 1};
+    BOOST_CHECK(unique_of_order({13, 40}, {14, 40}, 5, false, result));
+    BOOST_CHECK(same(result, 1, 3));
+
+    // [1/4, 1/3] holds both endpoints, [1/4, 1/3) only the lower one.
+    BOOST_CHECK(!unique_of_order({1, 4}, {1, 3}, 5, false, result));
+    BOOST_CHECK(unique_of_order({1, 4}, {1, 3}, 5, true, result));
+    BOOST_CHECK(same(result, 1, 4));
+
+    // The simplest fraction has a too large denominator.
+    BOOST_CHECK(!unique_of_order({1, 7}, {1, 6}, 5, false, result));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,73 @@
+#include "libggg/utils/profile.hpp"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <sstream>
+#include <thread>
+
+using namespace ggg::utils;
+
+BOOST_AUTO_TEST_SUITE(ProfileTests)
+
+BOOST_AUTO_TEST_CASE(TestPhasesAreConsecutive) {
+    PhaseProfiler profiler;
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    profiler.mark("first");
+    profiler.mark("second");
+
+    const auto &phases = profiler.phases();
+    BOOST_REQUIRE_EQUAL(phases.size(), 2u);
+    BOOST_CHECK_EQUAL(phases[0].name, "first");
+    BOOST_CHECK_GE(phases[0].wall, 0.005);
+    BOOST_CHECK_LT(phases[0].cpu, phases[0].wall);
+    BOOST_CHECK_EQUAL(phases[1].name, "second");
+    BOOST_CHECK_LT(phases[1].wall, phases[0].wall);
+    BOOST_CHECK_GT(peak_rss_kib(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestRecordJson) {
+    RunProfile profile;
+    profile.solver = "ggg_parity_solver_recursive";
+    profile.game = "test\"005";
+    profile.vertices = 10;
+    profile.edges = 20;
+    profile.phases = {{"parse", 0.5, 0.25}, {"solve", 0.125, 0.5}};
+    profile.peak_rss_kib = 4096;
+    profile.statistics = {{"iterations", "3"}};
+
+    std::ostringstream json;
+    {
+        OutputSink out(json);
+        profile.write_json(out);
+    }
+    BOOST_CHECK_EQUAL(json.str(), "{\"solver\": \"ggg_parity_solver_recursive\", \"game\": \"test\\\"005\", "
+                                  "\"status\": \"success\", \"time\": 0.125, \"vertices\": 10, \"edges\": 20, "
+                                  "\"peak_rss_kb\": 4096, \"phases\": {\"parse\": {\"wall\": 0.5, \"cpu\": 0.25}, "
+                                  "\"solve\": {\"wall\": 0.125, \"cpu\": 0.5}}, \"statistics\": {\"iterations\": \"3\"}}");
+    BOOST_CHECK_EQUAL(profile.wall("verify"), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestTimingSummary) {
+    const auto summary = TimingSummary::of({4, 1, 3, 2}, 2);
+    BOOST_CHECK_EQUAL(summary.runs, 4u);
+    BOOST_CHECK_EQUAL(summary.warmup, 2u);
+    BOOST_CHECK_EQUAL(summary.min, 1);
+    BOOST_CHECK_EQUAL(summary.median, 2.5);
+    BOOST_CHECK_EQUAL(summary.mean, 2.5);
+    BOOST_CHECK_CLOSE(summary.stddev, std::sqrt(5.0 / 3), 1e-9);
+    BOOST_CHECK_EQUAL(summary.p95, 4);
+
+    std::vector<double> times(100);
+    for (std::size_t i = 0; i < times.size(); ++i) {
+        times[i] = static_cast<double>(100 - i);
+    }
+    const auto large = TimingSummary::of(times);
+    BOOST_CHECK_EQUAL(large.median, 50.5);
+    BOOST_CHECK_EQUAL(large.p95, 95);
+
+    const auto single = TimingSummary::of({7});
+    BOOST_CHECK_EQUAL(single.median, 7);
+    BOOST_CHECK_EQUAL(single.stddev, 0);
+    BOOST_CHECK_EQUAL(single.p95, 7);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
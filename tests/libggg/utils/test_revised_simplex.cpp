@@ -0,0 +1,120 @@
+#include "libggg/utils/revised_simplex.hpp"
+#include "libggg/utils/simplex.hpp"
+#include <boost/test/unit_test.hpp>
+#include <vector>
+
+using namespace ggg::utils;
+
+namespace {
+
+constexpr double inf = RevisedSimplex::kInfinity;
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(RevisedSimplexTests)
+
+BOOST_AUTO_TEST_CASE(TestBoundedOptimum) {
+    // max 3x + 2y  s.t.  x + y <= 4, x + 3y <= 6, 0 <= x <= 3, y >= 0
+    RevisedSimplex lp(2);
+    lp.add_row({{0, 1.0}, {1, 1.0}}, -inf, 4.0);
+    lp.add_row({{0, 1.0}, {1, 3.0}}, -inf, 6.0);
+    lp.set_column_bounds(0, 0.0, 3.0);
+    lp.set_column_bounds(1, 0.0, inf);
+    lp.set_objective({3.0, 2.0});
+
+    BOOST_REQUIRE(lp.solve() == LPStatus::Optimal);
+    BOOST_TEST(lp.value(0) == 3.0, boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(lp.value(1) == 1.0, boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(lp.objective() == 11.0, boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(lp.row_activity(0) == 4.0, boost::test_tools::tolerance(1e-9));
+}
+
+BOOST_AUTO_TEST_CASE(TestInfeasibleAndUnbounded) {
+    RevisedSimplex infeasible(1);
+    infeasible.add_row({{0, 1.0}}, 2.0, inf);
+    infeasible.add_row({{0, 1.0}}, -inf, 1.0);
+    BOOST_CHECK(infeasible.solve() == LPStatus::Infeasible);
+
+    RevisedSimplex unbounded(2);
+    unbounded.add_row({{0, 1.0}, {1, -1.0}}, 0.0, 0.0);
+    unbounded.set_objective({1.0, 0.0});
+    BOOST_CHECK(unbounded.solve() == LPStatus::Unbounded);
+}
+
+BOOST_AUTO_TEST_CASE(TestWarmStartMatchesColdStart) {
+    // Discounted value equations: x0 = 1 + x1/2 (equation), x1 <= -1 + x0/2, x1 <= 2 + x1/2
+    const auto build = [](RevisedSimplex &lp) {
+        lp.add_row({{0, 1.0}, {1, -0.5}}, 1.0, 1.0);
+        lp.add_row({{0, -0.5}, {1, 1.0}}, -inf, -1.0);
+        lp.add_row({{1, 0.5}}, -inf, 2.0);
+        lp.set_objective({1.0, 1.0});
+    };
+    RevisedSimplex warm(2);
+    build(warm);
+    BOOST_REQUIRE(warm.solve() == LPStatus::Optimal);
+    BOOST_TEST(warm.value(0) == 2.0 / 3.0, boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(warm.value(1) == -2.0 / 3.0, boost::test_tools::tolerance(1e-9));
+
+    // Switch player 0 to its self loop: x0 = x0/2
+    warm.set_row(0, {{0, 0.5}}, 0.0, 0.0);
+    const std::size_t before = warm.iterations();
+    BOOST_REQUIRE(warm.solve() == LPStatus::Optimal);
+    const std::size_t warm_pivots = warm.iterations() - before;
+
+    RevisedSimplex cold(2);
+    build(cold);
+    cold.set_row(0, {{0, 0.5}}, 0.0, 0.0);
+    BOOST_REQUIRE(cold.solve() == LPStatus::Optimal);
+    BOOST_TEST(warm.value(0) == cold.value(0), boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(warm.value(1) == cold.value(1), boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(warm.value(0) == 0.0, boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(warm.value(1) == -1.0, boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(warm_pivots <= cold.iterations());
+}
+
+BOOST_AUTO_TEST_CASE(TestSingularBasisIsRepaired) {
+    // x + y = 2, x - y = 0 has both structurals basic; making the second row
+    // parallel to the first leaves that basis singular.
+    RevisedSimplex lp(2);
+    lp.add_row({{0, 1.0}, {1, 1.0}}, 2.0, 2.0);
+    lp.add_row({{0, 1.0}, {1, -1.0}}, 0.0, 0.0);
+    lp.set_column_bounds(0, 0.0, 5.0);
+    lp.set_column_bounds(1, 0.0, 5.0);
+    lp.set_objective({1.0, 0.0});
+    BOOST_REQUIRE(lp.solve() == LPStatus::Optimal);
+    BOOST_TEST(lp.value(0) == 1.0, boost::test_tools::tolerance(1e-9));
+
+    lp.set_row(1, {{0, 1.0}, {1, 1.0}}, -inf, 2.0);
+    BOOST_REQUIRE(lp.solve() == LPStatus::Optimal);
+    BOOST_TEST(lp.value(0) == 2.0, boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(lp.value(1) == 0.0, boost::test_tools::tolerance(1e-9));
+}
+
+BOOST_AUTO_TEST_CASE(TestSimplexInterface) {
+    // Same LP as TestBoundedOptimum through the dense-input interface
+    const std::vector<std::vector<double>> matrix = {{1.0, 1.0}, {1.0, 3.0}};
+    Simplex solver(matrix, {-inf, -inf}, {4.0, 6.0}, {0.0, 0.0}, {3.0, 1e100}, {3.0, 2.0});
+    while (solver.remove_artificial_variables()) {
+    }
+    while (solver.calculate_simplex()) {
+    }
+    std::vector<double> x;
+    double objective = 0.0;
+    solver.get_full_results(x, objective, true);
+    BOOST_REQUIRE(x.size() == 2);
+    BOOST_TEST(x[0] == 3.0, boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(x[1] == 1.0, boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(objective == 11.0, boost::test_tools::tolerance(1e-9));
+
+    // New objective, warm-started: max x + 4y -> (0, 2)
+    solver.update_objective_row({1.0, 4.0});
+    solver.normalize_objective_row();
+    while (solver.calculate_simplex()) {
+    }
+    solver.get_full_results(x, objective, true);
+    BOOST_TEST(x[0] == 0.0, boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(x[1] == 2.0, boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(objective == 8.0, boost::test_tools::tolerance(1e-9));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,25 @@
+# Sends one request line to ggg_server on stdin and checks the response.
+# Usage: cmake -DSERVER=<ggg_server> -DREQUEST=<line> -DEXPECT=<regex> -P server_request.cmake
+
+if(NOT SERVER OR NOT DEFINED REQUEST OR NOT EXPECT)
+    message(FATAL_ERROR "server_request.cmake needs SERVER, REQUEST and EXPECT")
+endif()
+
+string(MD5 request_hash "${REQUEST}")
+set(request_file "${CMAKE_CURRENT_BINARY_DIR}/server_request_${request_hash}.txt")
+file(WRITE "${request_file}" "${REQUEST}\n")
+execute_process(
+    COMMAND "${SERVER}" --workers 1
+    INPUT_FILE "${request_file}"
+    OUTPUT_VARIABLE response
+    RESULT_VARIABLE result
+    TIMEOUT 60
+)
+file(REMOVE "${request_file}")
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "ggg_server exited with ${result}; response: '${response}'")
+endif()
+if(NOT response MATCHES "${EXPECT}")
+    message(FATAL_ERROR "Response '${response}' does not match '${EXPECT}'")
+endif()
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "libggg/graphs/graph_utilities.hpp"
+#include "libggg/graphs/player_utilities.hpp"
+#include "libggg/graphs/priority_utilities.hpp"
+#include "libggg/graphs/validator.hpp"
+#include "libggg/parity/graph.hpp"
+
+// There is no special namespace for Buechi graphs so far: the Buechi tools
+// recycle parity graphs, with a specialised validator shared here.
+
+using BuechiGraphValidator = ggg::graphs::CompositeValidator<
+    ggg::parity::graph::Graph,
+    ggg::graphs::OutDegreeValidator<1>,
+    ggg::graphs::NoDuplicateEdgesValidator,
+    ggg::graphs::player_utilities::PlayerValidator<0, 1>,
+    ggg::graphs::priority_utilities::PriorityValidator<0, 1>> // priorities must be 0 or 1 only (Buechi condition)
+
+    ;
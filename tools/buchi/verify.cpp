@@ -0,0 +1,7 @@
+#include "libggg/buechi/verifier.hpp"
+#include "libggg/utils/verifier_wrapper.hpp"
+
+#include "validator.hpp"
+
+// Checks a binary solution file against its Buechi game (a parity graph with priorities 0 and 1)
+GGG_SOLUTION_VERIFIER_MAIN(ggg::parity::graph::Graph, ggg::parity::graph::parse, BuechiGraphValidator, ggg::buechi::verify)
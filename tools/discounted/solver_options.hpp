@@ -0,0 +1,43 @@
+#pragma once
+
+#include "libggg/discounted/solvers/strategy_improvement.hpp"
+#include "libggg/discounted/solvers/value.hpp"
+#include <boost/program_options.hpp>
+#include <cstddef>
+
+// Discounted-payoff solvers configured from the command line, shared by the
+// solver CLIs and ggg_server.
+
+namespace ggg {
+namespace discounted {
+
+// Value iteration solver configured from the command line
+class ValueSolverCli : public DiscountedValueSolver {
+  public:
+    ValueSolverCli() = default;
+
+    explicit ValueSolverCli(const boost::program_options::variables_map &vm)
+        : DiscountedValueSolver(vm["precision"].as<double>()) {}
+
+    static void add_options(boost::program_options::options_description &desc) {
+        desc.add_options()("precision", boost::program_options::value<double>()->default_value(1e-9),
+                           "Guaranteed maximal error of the values");
+    }
+};
+
+// Strategy improvement solver configured from the command line
+class StrategyImprovementSolverCli : public DiscountedStrategyImprovementSolver {
+  public:
+    StrategyImprovementSolverCli() = default;
+
+    explicit StrategyImprovementSolverCli(const boost::program_options::variables_map &vm)
+        : DiscountedStrategyImprovementSolver(vm["value-sweeps"].as<std::size_t>()) {}
+
+    static void add_options(boost::program_options::options_description &desc) {
+        desc.add_options()("value-sweeps", boost::program_options::value<std::size_t>()->default_value(64),
+                           "Maximal value iteration sweeps before strategy iteration (0 to disable)");
+    }
+};
+
+} // namespace discounted
+} // namespace ggg
@@ -0,0 +1,7 @@
+#include "libggg/utils/solver_wrapper.hpp"
+#include "../solver_options.hpp"
+
+using namespace ggg::discounted;
+
+// Use the unified macro to create a main function for the discounted strategy improvement solver
+GGG_GAME_SOLVER_MAIN(graph::Graph, graph::parse, graph::StandardValidator, StrategyImprovementSolverCli)
@@ -0,0 +1,183 @@
+#include "libggg/utils/output_sink.hpp"
+#include "socket.hpp"
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <spawn.h>
+#include <sstream>
+#include <string>
+#include <sys/wait.h>
+#include <thread>
+#include <vector>
+
+// ggg_server_benchmark: round-trip latency of one solver call through a
+// running ggg_server, optionally next to the latency of running the solver's
+// CLI as a new process for every call.
+
+using namespace ggg::tools;
+
+extern char **environ;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double milliseconds(Clock::duration duration) { return std::chrono::duration<double, std::milli>(duration).count(); }
+
+void report(const std::string &label, std::vector<double> latencies, double wall) {
+    std::sort(latencies.begin(), latencies.end());
+    const std::size_t n = latencies.size();
+    const double mean = std::accumulate(latencies.begin(), latencies.end(), 0.0) / n;
+    const auto quantile = [&](double q) { return latencies[std::min(n - 1, static_cast<std::size_t>(std::ceil(q * n)) - 1)]; };
+    std::cout << label << ": " << n << " calls in " << wall << " ms (" << n * 1000.0 / wall << " calls/s)\n";
+    std::cout << "  latency ms: min " << latencies.front() << ", median " << quantile(0.5) << ", mean " << mean << ", p95 "
+              << quantile(0.95) << ", max " << latencies.back() << std::endl;
+}
+
+// Send @p request and wait for its response on @p fd; the response line is returned
+std::string call(int fd, LineReader &reader, const std::string &request) {
+    std::string response;
+    if (!send_all(fd, request) || !reader.next(response)) {
+        throw std::runtime_error("the server closed the connection");
+    }
+    return response;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    namespace po = boost::program_options;
+    try {
+        po::options_description desc("Benchmark Options");
+        desc.add_options()("help,h", "Show help message");
+        desc.add_options()("socket", po::value<std::string>()->required(), "Unix domain socket of the server");
+        desc.add_options()("game", po::value<std::string>()->required(), "Game type (parity, buechi, mean_payoff, ...)");
+        desc.add_options()("solver", po::value<std::string>()->required(), "Solver name");
+        desc.add_options()("requests,n", po::value<std::size_t>()->default_value(1000), "Calls measured");
+        desc.add_options()("concurrency,c", po::value<unsigned>()->default_value(1), "Connections calling at once");
+        desc.add_options()("inline", "Send the game's text instead of its path");
+        desc.add_options()("cli", po::value<std::string>(), "Also time this solver CLI, started once per call");
+        desc.add_options()("cli-runs", po::value<std::size_t>()->default_value(20), "Calls of --cli measured");
+        po::options_description hidden;
+        hidden.add_options()("file", po::value<std::string>()->required());
+        po::options_description all;
+        all.add(desc).add(hidden);
+        po::positional_options_description positional;
+        positional.add("file", 1);
+
+        po::variables_map vm;
+        po::store(po::command_line_parser(argc, argv).options(all).positional(positional).run(), vm);
+        if (vm.count("help")) {
+            std::cout << "Usage: " << argv[0] << " --socket <path> --game <game> --solver <solver> [options] <file>\n\n";
+            std::cout << desc << std::endl;
+            return 0;
+        }
+        po::notify(vm);
+
+        const std::string file = vm["file"].as<std::string>();
+        std::ostringstream line;
+        {
+            ggg::utils::OutputSink out(line);
+            out.write("{\"game\": ").json_string(vm["game"].as<std::string>());
+            out.write(", \"solver\": ").json_string(vm["solver"].as<std::string>());
+            if (vm.count("inline")) {
+                std::ifstream in(file, std::ios::binary);
+                std::ostringstream text;
+                text << in.rdbuf();
+                out.write(", \"dot\": ").json_string(text.view());
+            } else {
+                out.write(", \"path\": ").json_string(std::filesystem::absolute(file).string());
+            }
+            out.write(", \"time_only\": true}\n");
+        }
+        const std::string request = std::move(line).str();
+
+        // The first call parses the game; the measured ones find it cached.
+        {
+            const int fd = connect_unix(vm["socket"].as<std::string>());
+            LineReader reader(fd);
+            const auto start = Clock::now();
+            const std::string response = call(fd, reader, request);
+            const double first = milliseconds(Clock::now() - start);
+            ::close(fd);
+            if (response.find("\"error\"") != std::string::npos) {
+                std::cerr << "Error: " << response << std::endl;
+                return 1;
+            }
+            std::cout << "first call (parses the game): " << first << " ms" << std::endl;
+        }
+
+        const std::size_t requests = vm["requests"].as<std::size_t>();
+        const unsigned concurrency = std::max(1u, vm["concurrency"].as<unsigned>());
+        std::vector<double> latencies;
+        std::mutex latencies_mutex;
+        std::atomic<std::size_t> next{0};
+        std::atomic<std::size_t> failures{0};
+        std::vector<std::thread> clients;
+        const auto start = Clock::now();
+        for (unsigned c = 0; c < concurrency; ++c) {
+            clients.emplace_back([&] {
+                const int fd = connect_unix(vm["socket"].as<std::string>());
+                LineReader reader(fd);
+                std::vector<double> local;
+                while (next++ < requests) {
+                    const auto sent = Clock::now();
+                    if (call(fd, reader, request).find("\"error\"") != std::string::npos) {
+                        ++failures;
+                    }
+                    local.push_back(milliseconds(Clock::now() - sent));
+                }
+                ::close(fd);
+                const std::lock_guard<std::mutex> lock(latencies_mutex);
+                latencies.insert(latencies.end(), local.begin(), local.end());
+            });
+        }
+        for (auto &client : clients) {
+            client.join();
+        }
+        if (!latencies.empty()) {
+            report("server (concurrency " + std::to_string(concurrency) + ")", latencies, milliseconds(Clock::now() - start));
+        }
+        if (failures > 0) {
+            std::cerr << failures << " calls failed" << std::endl;
+        }
+
+        if (vm.count("cli")) {
+            const std::string cli = vm["cli"].as<std::string>();
+            std::vector<char *> cli_argv{const_cast<char *>(cli.c_str()), const_cast<char *>("--time-only"),
+                                         const_cast<char *>(file.c_str()), nullptr};
+            posix_spawn_file_actions_t actions;
+            posix_spawn_file_actions_init(&actions);
+            posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0);
+            std::vector<double> cli_latencies;
+            const auto cli_start = Clock::now();
+            for (std::size_t i = 0; i < vm["cli-runs"].as<std::size_t>(); ++i) {
+                const auto started = Clock::now();
+                pid_t pid;
+                if (posix_spawn(&pid, cli.c_str(), &actions, nullptr, cli_argv.data(), environ) != 0) {
+                    throw std::runtime_error("cannot start " + cli);
+                }
+                int status;
+                ::waitpid(pid, &status, 0);
+                cli_latencies.push_back(milliseconds(Clock::now() - started));
+            }
+            posix_spawn_file_actions_destroy(&actions);
+            if (!cli_latencies.empty()) {
+                report("cli " + std::filesystem::path(cli).filename().string(), cli_latencies,
+                       milliseconds(Clock::now() - cli_start));
+            }
+        }
+        return failures > 0 ? 1 : 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,134 @@
+#include "libggg/utils/output_sink.hpp"
+#include "socket.hpp"
+#include <boost/program_options.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ggg_client: sends requests to a ggg_server socket and prints the
+// responses, one JSON line each, as they arrive.  Either forwards request
+// lines from stdin, or builds one request per game file from its options.
+
+using namespace ggg::tools;
+
+namespace {
+
+// The request line solving @p file (sent by path unless @p inline_game)
+std::string make_request(const boost::program_options::variables_map &vm, std::size_t id, const std::string &file) {
+    std::ostringstream line;
+    {
+        ggg::utils::OutputSink out(line);
+        out.write("{\"id\": ").integer(id);
+        out.write(", \"game\": ").json_string(vm["game"].as<std::string>());
+        out.write(", \"solver\": ").json_string(vm["solver"].as<std::string>());
+        if (vm.count("inline")) {
+            std::ifstream in(file, std::ios::binary);
+            if (!in) {
+                throw std::runtime_error("cannot read '" + file + "'");
+            }
+            std::ostringstream text;
+            text << in.rdbuf();
+            out.write(", \"dot\": ").json_string(text.view());
+        } else {
+            // The server resolves paths against its own working directory.
+            out.write(", \"path\": ").json_string(std::filesystem::absolute(file).string());
+        }
+        if (vm.count("option")) {
+            out.write(", \"options\": {");
+            const char *separator = "";
+            for (const auto &option : vm["option"].as<std::vector<std::string>>()) {
+                const auto equals = option.find('=');
+                out.write(separator).json_string(option.substr(0, equals)).write(": ");
+                out.json_string(equals == std::string::npos ? std::string() : option.substr(equals + 1));
+                separator = ", ";
+            }
+            out.put('}');
+        }
+        if (vm.count("time-only")) {
+            out.write(", \"time_only\": true");
+        }
+        if (vm["timeout"].as<double>() > 0) {
+            out.write(", \"timeout\": ").general(vm["timeout"].as<double>());
+        }
+        out.write("}\n");
+    }
+    return std::move(line).str();
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    namespace po = boost::program_options;
+    try {
+        po::options_description desc("Client Options");
+        desc.add_options()("help,h", "Show help message");
+        desc.add_options()("socket", po::value<std::string>()->required(), "Unix domain socket of the server");
+        desc.add_options()("game", po::value<std::string>(), "Game type of the files (parity, buechi, mean_payoff, ...)");
+        desc.add_options()("solver", po::value<std::string>(), "Solver for the files (without: forward request lines from stdin)");
+        desc.add_options()("inline", "Send the games' text instead of their paths");
+        desc.add_options()("option,o", po::value<std::vector<std::string>>(), "Solver option as name=value (repeatable)");
+        desc.add_options()("time-only,t", "Ask for times only");
+        desc.add_options()("timeout", po::value<double>()->default_value(0), "Time limit per request in milliseconds (0: none)");
+        po::options_description hidden;
+        hidden.add_options()("files", po::value<std::vector<std::string>>());
+        po::options_description all;
+        all.add(desc).add(hidden);
+        po::positional_options_description positional;
+        positional.add("files", -1);
+
+        po::variables_map vm;
+        po::store(po::command_line_parser(argc, argv).options(all).positional(positional).run(), vm);
+        if (vm.count("help")) {
+            std::cout << "Usage: " << argv[0] << " --socket <path> [--game <game> --solver <solver> [options] <files>...]\n\n";
+            std::cout << desc << std::endl;
+            return 0;
+        }
+        po::notify(vm);
+
+        std::vector<std::string> requests;
+        if (vm.count("solver")) {
+            if (!vm.count("game") || !vm.count("files")) {
+                std::cerr << "Error: --solver needs --game and at least one game file" << std::endl;
+                return 2;
+            }
+            const auto files = vm["files"].as<std::vector<std::string>>();
+            for (std::size_t i = 0; i < files.size(); ++i) {
+                requests.push_back(make_request(vm, i + 1, files[i]));
+            }
+        }
+
+        const int fd = connect_unix(vm["socket"].as<std::string>());
+        // Requests are sent from a second thread so that a long stream of
+        // them cannot block on responses nobody reads yet.
+        std::thread sender([&] {
+            if (vm.count("solver")) {
+                for (const auto &request : requests) {
+                    send_all(fd, request);
+                }
+            } else {
+                for (std::string line; std::getline(std::cin, line);) {
+                    line.push_back('\n');
+                    if (!send_all(fd, line)) {
+                        break;
+                    }
+                }
+            }
+            ::shutdown(fd, SHUT_WR);
+        });
+        LineReader reader(fd);
+        for (std::string line; reader.next(line);) {
+            std::cout << line << '\n';
+            std::cout.flush();
+        }
+        sender.join();
+        ::close(fd);
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
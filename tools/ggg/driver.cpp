@@ -0,0 +1,324 @@
+#include "libggg/solvers/cancellation.hpp"
+#include "libggg/utils/output_sink.hpp"
+#include "libggg/utils/parallel.hpp"
+#include "registry.hpp"
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// ggg: one executable for every shipped solver.  `ggg solve` parses each game
+// once and runs any number of solvers on the graph in memory, one after the
+// other or several at once, reporting each solver's time; `ggg list` names
+// the game types, solvers, aliases and solver options.
+
+using namespace ggg::tools;
+
+namespace {
+
+// What one solver did with one game
+struct Outcome {
+    std::string solver;
+    double time = 0;
+    std::string solution; // JSON, if asked for
+    std::string error;
+    bool timeout = false;
+};
+
+// A selected solver and the -o options meant for it, as command line tokens
+struct Selection {
+    std::string solver;
+    std::vector<std::string> options;
+};
+
+void print_usage(std::ostream &os) {
+    os << "Usage: ggg <command> [options]\n\n"
+          "Commands:\n"
+          "  list                                  List game types, solvers, their aliases and options\n"
+          "  solve --game <game> --solver <s,...>  Solve games with one or more solvers\n\n"
+          "Run 'ggg solve --help' for the options of solve.\n";
+}
+
+int list(const Registry &registry) {
+    for (const auto &[game, service] : registry) {
+        std::cout << game << ":\n";
+        for (const auto &solver : service->solver_names()) {
+            std::cout << "  " << solver;
+            if (const auto aliases = service->aliases_of(solver); !aliases.empty()) {
+                std::cout << " (";
+                for (std::size_t i = 0; i < aliases.size(); ++i) {
+                    std::cout << (i > 0 ? ", " : "") << aliases[i];
+                }
+                std::cout << ")";
+            }
+            for (const auto &option : service->option_names(solver)) {
+                std::cout << " --" << option;
+            }
+            std::cout << '\n';
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief The solvers named in @p list ("all" for every one), with the -o options each accepts
+ *
+ * @throws std::invalid_argument for an unknown solver or an option no selected solver accepts
+ */
+std::vector<Selection> select_solvers(const GameService &service, const std::string &list,
+                                      const std::vector<std::string> &options) {
+    std::vector<Selection> selection;
+    std::vector<std::string> names;
+    if (list == "all") {
+        names = service.solver_names();
+    } else {
+        std::istringstream in(list);
+        for (std::string name; std::getline(in, name, ',');) {
+            if (!name.empty()) {
+                names.push_back(service.resolve(name));
+            }
+        }
+    }
+    if (names.empty()) {
+        throw std::invalid_argument("no solver selected");
+    }
+    std::vector<bool> used(options.size(), false);
+    for (const auto &name : names) {
+        Selection entry{name, {}};
+        const auto accepted = service.option_names(name);
+        for (std::size_t i = 0; i < options.size(); ++i) {
+            const std::string option = options[i].substr(0, options[i].find('='));
+            if (std::find(accepted.begin(), accepted.end(), option) != accepted.end()) {
+                entry.options.push_back("--" + options[i]);
+                used[i] = true;
+            }
+        }
+        selection.push_back(std::move(entry));
+    }
+    for (std::size_t i = 0; i < options.size(); ++i) {
+        if (!used[i]) {
+            throw std::invalid_argument("no selected solver accepts the option '" + options[i] + "'");
+        }
+    }
+    return selection;
+}
+
+/**
+ * @brief Run every selected solver on @p game, @p jobs at once
+ *
+ * Each solver gets @p timeout (none if zero) from when it starts, enforced
+ * cooperatively as in the solver CLIs' --batch mode.
+ */
+std::vector<Outcome> run_solvers(const LoadedGame &game, const std::vector<Selection> &selection, unsigned jobs,
+                                 std::chrono::milliseconds timeout, bool with_solutions,
+                                 ggg::solvers::DeadlineWatchdog &watchdog) {
+    std::vector<Outcome> outcomes(selection.size());
+    std::atomic<std::size_t> next{0};
+    ggg::utils::parallel_for(
+        jobs,
+        [&](std::size_t, std::size_t) {
+            for (std::size_t i = next++; i < selection.size(); i = next++) {
+                Outcome &outcome = outcomes[i];
+                outcome.solver = selection[i].solver;
+                ggg::solvers::CancellationToken token;
+                const auto start = std::chrono::steady_clock::now();
+                if (timeout.count() > 0) {
+                    watchdog.watch(token, start + timeout);
+                }
+                try {
+                    const ggg::solvers::CancellationScope scope(token);
+                    std::ostringstream solution;
+                    {
+                        ggg::utils::OutputSink sink(solution);
+                        outcome.time = game.solve(selection[i].solver, selection[i].options, with_solutions ? &sink : nullptr);
+                    }
+                    outcome.solution = std::move(solution).str();
+                } catch (const ggg::solvers::Cancelled &) {
+                    outcome.timeout = true;
+                    outcome.time =
+                        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                } catch (const std::exception &e) {
+                    outcome.error = e.what();
+                }
+                watchdog.unwatch(token);
+            }
+        },
+        jobs);
+    return outcomes;
+}
+
+void write_json(ggg::utils::OutputSink &out, const std::string &file, const GameService::Loaded &loaded,
+                const std::vector<Outcome> &outcomes, bool with_solutions) {
+    out.write("{\"file\": ").json_string(file);
+    out.write(", \"parse_time\": ").general(loaded.parse_time);
+    out.write(", \"vertices\": ").integer(loaded.game->num_vertices());
+    out.write(", \"edges\": ").integer(loaded.game->num_edges());
+    out.write(", \"results\": [");
+    const char *separator = "";
+    for (const auto &outcome : outcomes) {
+        out.write(separator).write("{\"solver\": ").json_string(outcome.solver);
+        if (!outcome.error.empty()) {
+            out.write(", \"error\": ").json_string(outcome.error);
+        } else {
+            if (outcome.timeout) {
+                out.write(", \"timeout\": true");
+            }
+            out.write(", \"time\": ").general(outcome.time);
+            if (with_solutions && !outcome.timeout) {
+                out.write(", \"solution\": ").write(outcome.solution);
+            }
+        }
+        out.put('}');
+        separator = ", ";
+    }
+    out.write("]}\n");
+}
+
+void write_text(ggg::utils::OutputSink &out, const std::string &file, const GameService::Loaded &loaded,
+                const std::vector<Outcome> &outcomes) {
+    out.write(file).write(": ").integer(loaded.game->num_vertices()).write(" vertices, ");
+    out.integer(loaded.game->num_edges()).write(" edges, parsed in ").general(loaded.parse_time).write(" ms\n");
+    for (const auto &outcome : outcomes) {
+        out.write("  ").write(outcome.solver).write(": ");
+        if (!outcome.error.empty()) {
+            out.write("error: ").write(outcome.error);
+        } else if (outcome.timeout) {
+            out.write("timeout after ").general(outcome.time).write(" ms");
+        } else {
+            out.general(outcome.time).write(" ms");
+        }
+        out.put('\n');
+    }
+}
+
+int solve(Registry &registry, int argc, char *argv[]) {
+    namespace po = boost::program_options;
+    po::options_description desc("Solve Options");
+    desc.add_options()("help,h", "Show help message");
+    desc.add_options()("game", po::value<std::string>()->required(), "Game type (parity, buechi, mean_payoff, ...)");
+    desc.add_options()("solver", po::value<std::string>()->required(),
+                       "Comma-separated solver names or aliases, or 'all' (see 'ggg list')");
+    desc.add_options()("option,o", po::value<std::vector<std::string>>()->default_value({}, ""),
+                       "Solver option as name=value, given to every selected solver that accepts it (repeatable)");
+    desc.add_options()("format,f", po::value<std::string>()->default_value("plain"),
+                       "Output format: plain (times) | json (a line per game, with solutions)");
+    desc.add_options()("time-only,t", "Leave the solutions out of the JSON output");
+    desc.add_options()("jobs,j", po::value<unsigned>()->default_value(1),
+                       "Solvers run at once (0: GGG_THREADS or the hardware concurrency)");
+    desc.add_options()("timeout", po::value<std::size_t>()->default_value(0),
+                       "Time limit per solver and game in milliseconds (0: none)");
+    po::options_description hidden;
+    hidden.add_options()("files", po::value<std::vector<std::string>>());
+    po::options_description all;
+    all.add(desc).add(hidden);
+    po::positional_options_description positional;
+    positional.add("files", -1);
+
+    po::variables_map vm;
+    po::store(po::command_line_parser(argc, argv).options(all).positional(positional).run(), vm);
+    if (vm.count("help")) {
+        std::cout << "Usage: ggg solve --game <game> --solver <solver,...|all> [options] <files>...\n\n";
+        std::cout << desc << std::endl;
+        return 0;
+    }
+    po::notify(vm);
+    if (!vm.count("files")) {
+        std::cerr << "Error: no game files given (use - for stdin)" << std::endl;
+        return 2;
+    }
+    const std::string format = vm["format"].as<std::string>();
+    if (format != "plain" && format != "json") {
+        std::cerr << "Error: unknown format '" << format << "'" << std::endl;
+        return 2;
+    }
+
+    const std::string game = vm["game"].as<std::string>();
+    const auto service = registry.find(game);
+    if (service == registry.end()) {
+        std::cerr << "Error: unknown game '" << game << "' (see 'ggg list')" << std::endl;
+        return 2;
+    }
+    std::vector<Selection> selection;
+    try {
+        selection = select_solvers(*service->second, vm["solver"].as<std::string>(),
+                                   vm["option"].as<std::vector<std::string>>());
+    } catch (const std::invalid_argument &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 2;
+    }
+
+    const bool json = format == "json";
+    const bool with_solutions = json && !vm.count("time-only");
+    const unsigned jobs = static_cast<unsigned>(
+        std::min<std::size_t>(ggg::utils::thread_count(vm["jobs"].as<unsigned>()), selection.size()));
+    const auto timeout = std::chrono::milliseconds(vm["timeout"].as<std::size_t>());
+    ggg::solvers::DeadlineWatchdog watchdog;
+    bool all_solved = true;
+
+    for (const auto &file : vm["files"].as<std::vector<std::string>>()) {
+        ggg::utils::OutputSink out(std::cout);
+        GameService::Loaded loaded;
+        std::string error;
+        try {
+            loaded = service->second->load(read_game_text(file));
+        } catch (const ggg::graphs::ParseError &e) {
+            error = std::string("Parse error: ") + e.what();
+        } catch (const ggg::graphs::GraphValidationError &e) {
+            error = std::string("Validation Error: ") + e.what();
+        } catch (const std::exception &e) {
+            error = std::string("Error: ") + e.what();
+        }
+        if (!loaded.game) {
+            all_solved = false;
+            if (json) {
+                out.write("{\"file\": ").json_string(file).write(", \"error\": ").json_string(error).write("}\n");
+            } else {
+                out.write(file).write(": ").write(error).put('\n');
+            }
+            continue;
+        }
+
+        const auto outcomes = run_solvers(*loaded.game, selection, jobs, timeout, with_solutions, watchdog);
+        for (const auto &outcome : outcomes) {
+            if (outcome.timeout || !outcome.error.empty()) {
+                all_solved = false;
+            }
+        }
+        if (json) {
+            write_json(out, file, loaded, outcomes, with_solutions);
+        } else {
+            write_text(out, file, loaded, outcomes);
+        }
+        out.flush();
+    }
+    return all_solved ? 0 : 1;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    if (argc < 2 || std::string(argv[1]) == "-h" || std::string(argv[1]) == "--help" || std::string(argv[1]) == "help") {
+        print_usage(argc < 2 ? std::cerr : std::cout);
+        return argc < 2 ? 2 : 0;
+    }
+    try {
+        Registry registry = make_registry(0);
+        const std::string command = argv[1];
+        if (command == "list") {
+            return list(registry);
+        }
+        if (command == "solve") {
+            return solve(registry, argc - 1, argv + 1);
+        }
+        std::cerr << "Error: unknown command '" << command << "'\n\n";
+        print_usage(std::cerr);
+        return 2;
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
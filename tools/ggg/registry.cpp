@@ -0,0 +1,88 @@
+#include "libggg/buechi/solvers/attractor.hpp"
+#include "libggg/mean_payoff/solvers/energy.hpp"
+#include "libggg/mean_payoff/solvers/msca.hpp"
+#include "libggg/mean_payoff/solvers/mse.hpp"
+#include "libggg/mean_payoff/solvers/strategy_improvement.hpp"
+#include "libggg/mean_payoff/solvers/zwick_paterson.hpp"
+#include "libggg/parity/solvers/priority_promotion.hpp"
+#include "libggg/parity/solvers/progressive_small_progress_measures.hpp"
+#include "libggg/parity/solvers/recursive.hpp"
+#include "registry.hpp"
+#include "../buchi/validator.hpp"
+#include "../discounted/solver_options.hpp"
+#include "../parity/solver_options.hpp"
+#include "../stochastic_discounted/solver_options.hpp"
+
+namespace ggg {
+namespace tools {
+
+namespace {
+
+template <typename GraphType, typename ValidatorType>
+std::unique_ptr<BasicGameService<GraphType>> make_service(std::shared_ptr<GraphType> (*parse)(std::istream &),
+                                                          std::size_t cache_capacity) {
+    return std::make_unique<BasicGameService<GraphType>>(
+        parse, [](const GraphType &graph) { ValidatorType::validate(graph); }, cache_capacity);
+}
+
+} // namespace
+
+Registry make_registry(std::size_t cache_capacity) {
+    Registry registry;
+
+    {
+        using namespace ggg::parity;
+        auto game = make_service<graph::Graph, graph::StandardValidator>(graph::parse, cache_capacity);
+        game->add_solver<PriorityPromotionSolver>("priority_promotion");
+        game->add_solver<ProgressiveSmallProgressMeasuresSolver>("progressive_small_progress_measures");
+        game->add_solver<RecursiveParitySolver>("recursive");
+        game->add_solver<PortfolioSolverCli>("portfolio");
+        game->add_alias("pp", "priority_promotion");
+        game->add_alias("spm", "progressive_small_progress_measures");
+        registry["parity"] = std::move(game);
+    }
+    {
+        using namespace ggg::parity;
+        auto game = make_service<graph::Graph, BuechiGraphValidator>(graph::parse, cache_capacity);
+        game->add_solver<ggg::buechi::AttractorSolver>("attractor");
+        registry["buechi"] = std::move(game);
+    }
+    {
+        using namespace ggg::mean_payoff;
+        auto game = make_service<graph::Graph, graph::StandardValidator>(graph::parse, cache_capacity);
+        game->add_solver<EnergySolver>("energy");
+        game->add_solver<MSCASolver>("msca");
+        game->add_solver<MSCAValueSolver>("msca_values");
+        game->add_solver<MSESolver>("mse");
+        game->add_solver<StrategyImprovementSolver>("strategy_improvement");
+        game->add_solver<ZwickPatersonSolver>("zwick_paterson");
+        game->add_alias("si", "strategy_improvement");
+        game->add_alias("zp", "zwick_paterson");
+        registry["mean_payoff"] = std::move(game);
+    }
+    {
+        using namespace ggg::discounted;
+        auto game = make_service<graph::Graph, graph::StandardValidator>(graph::parse, cache_capacity);
+        game->add_solver<StrategyImprovementSolverCli>("strategy_improvement");
+        game->add_solver<ValueSolverCli>("value");
+        game->add_alias("si", "strategy_improvement");
+        registry["discounted"] = std::move(game);
+    }
+    {
+        using namespace ggg::stochastic_discounted;
+        auto game = make_service<graph::Graph, graph::StandardValidator>(graph::parse, cache_capacity);
+        game->add_solver<ObjectiveSolverCli>("objective");
+        game->add_solver<StrategySolverCli<double>>("strategy");
+        game->add_solver<StrategySolverCli<float>>("strategy_float");
+        game->add_solver<StrategySolverCli<long double>>("strategy_long_double");
+        game->add_solver<StrategySolverCli<Rational>>("strategy_rational");
+        game->add_solver<ValueSolverCli<double>>("value");
+        game->add_solver<ValueSolverCli<float>>("value_float");
+        game->add_solver<ValueSolverCli<long double>>("value_long_double");
+        registry["stochastic_discounted"] = std::move(game);
+    }
+    return registry;
+}
+
+} // namespace tools
+} // namespace ggg
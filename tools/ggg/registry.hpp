@@ -0,0 +1,398 @@
+#pragma once
+
+#include "libggg/utils/output_sink.hpp"
+#include "libggg/utils/solver_wrapper.hpp"
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// In-process registry of every game type and solver, used by the tools that
+// make many solver calls from one process (ggg_server and the ggg driver).
+// A game type holds its parser, validator, solvers and their aliases, and a
+// cache of the graphs it parsed.
+
+namespace ggg {
+namespace tools {
+
+/**
+ * @brief 64-bit FNV-1a hash of a game's source text
+ */
+inline std::uint64_t content_hash(std::string_view text) {
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+    for (const char c : text) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+/**
+ * @brief The source text of the game file @p path ("-" reads stdin)
+ */
+inline std::string read_game_text(const std::string &path) {
+    std::ostringstream text;
+    if (path == "-") {
+        text << std::cin.rdbuf();
+    } else {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            throw std::runtime_error("cannot read '" + path + "'");
+        }
+        text << in.rdbuf();
+    }
+    return std::move(text).str();
+}
+
+/**
+ * @brief Parsed graphs by source text, least recently used evicted first
+ *
+ * Entries keep their text and are found by content_hash() and a comparison
+ * of the texts, so two games never share an entry.  Graphs are loaded
+ * outside the lock; requests for a text that is being parsed wait for that
+ * parse instead of starting another.  A failed parse is not cached, and its
+ * error is reported to every request that waited.
+ */
+template <typename GraphType>
+class GraphCache {
+  public:
+    using Pointer = std::shared_ptr<const GraphType>;
+
+    /**
+     * @param capacity Graphs kept; 0 disables the cache
+     */
+    explicit GraphCache(std::size_t capacity) : capacity_(capacity) {}
+
+    /**
+     * @brief The graph of @p text, and whether it came from the cache
+     *
+     * @param load Called as `load()` to parse @p text on a miss
+     */
+    template <typename Load>
+    std::pair<Pointer, bool> get(std::string_view text, Load &&load) {
+        if (capacity_ == 0) {
+            return {load(), false};
+        }
+        std::promise<Pointer> promise;
+        std::shared_future<Pointer> graph;
+        bool loading = false;
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            if (const auto it = entries_.find(text); it != entries_.end()) {
+                order_.splice(order_.begin(), order_, it->second.position);
+                graph = it->second.graph;
+            } else {
+                graph = promise.get_future().share();
+                loading = true;
+                order_.emplace_front(text);
+                entries_.emplace(order_.front(), Entry{graph, order_.begin(), &promise});
+                while (entries_.size() > capacity_) {
+                    entries_.erase(order_.back());
+                    order_.pop_back();
+                }
+            }
+        }
+        if (!loading) {
+            return {graph.get(), true};
+        }
+        try {
+            promise.set_value(load());
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+            const std::lock_guard<std::mutex> lock(mutex_);
+            if (const auto it = entries_.find(text); it != entries_.end() && it->second.loader == &promise) {
+                order_.erase(it->second.position);
+                entries_.erase(it);
+            }
+        }
+        return {graph.get(), false};
+    }
+
+  private:
+    struct TextHash {
+        std::size_t operator()(std::string_view text) const { return static_cast<std::size_t>(content_hash(text)); }
+    };
+    struct Entry {
+        std::shared_future<Pointer> graph;
+        typename std::list<std::string>::iterator position;
+        const void *loader; // the promise of the request parsing the graph
+    };
+
+    std::size_t capacity_;
+    std::mutex mutex_;
+    std::list<std::string> order_; // texts, most recently used first
+    std::unordered_map<std::string_view, Entry, TextHash> entries_; // keys view the texts in order_
+};
+
+/**
+ * @brief One solver call: which solver, on which game text, with which options
+ */
+struct SolveRequest {
+    std::string solver;               ///< Solver name or alias
+    std::string game;                 ///< The game's source text
+    std::vector<std::string> options; ///< Solver options as command line tokens, e.g. "--precision=1e-6"
+    bool time_only = false;           ///< Leave the solution out of the response
+};
+
+/**
+ * @brief A parsed and validated game, ready for any solver of its type
+ */
+class LoadedGame {
+  public:
+    virtual ~LoadedGame() = default;
+
+    virtual std::size_t num_vertices() const = 0;
+    virtual std::size_t num_edges() const = 0;
+
+    /**
+     * @brief Solve the game with @p solver (a name, not an alias)
+     *
+     * @param options The solver's options as command line tokens
+     * @param solution Receives the solution's JSON, unless null
+     * @return The time to solve in milliseconds
+     */
+    virtual double solve(const std::string &solver, const std::vector<std::string> &options,
+                         utils::OutputSink *solution) const = 0;
+};
+
+/**
+ * @brief A game type as the registry sees it
+ */
+class GameService {
+  public:
+    struct Loaded {
+        std::shared_ptr<const LoadedGame> game;
+        bool cached = false;   ///< Taken from the cache rather than parsed
+        double parse_time = 0; ///< Milliseconds spent parsing and validating, if not cached
+    };
+
+    virtual ~GameService() = default;
+
+    virtual std::vector<std::string> solver_names() const = 0;
+
+    /**
+     * @brief The name of the solver called @p name or aliased @p name
+     *
+     * @throws std::invalid_argument if there is no such solver
+     */
+    virtual std::string resolve(const std::string &name) const = 0;
+
+    /**
+     * @brief The aliases of @p solver
+     */
+    virtual std::vector<std::string> aliases_of(const std::string &solver) const = 0;
+
+    /**
+     * @brief Long names of the options @p solver accepts
+     */
+    virtual std::vector<std::string> option_names(const std::string &solver) const = 0;
+
+    /**
+     * @brief Parse and validate the game @p text, or take it from the cache
+     */
+    virtual Loaded load(const std::string &text) = 0;
+
+    /**
+     * @brief Solve @p request, writing the members of its JSON response
+     *
+     * Writes `"cached"`, `"parse_time"` (if the graph was parsed), `"time"`
+     * and, unless time_only, `"solution"` as in the solver CLIs' JSON
+     * output.  Errors are thrown, with nothing written.
+     */
+    void solve(const SolveRequest &request, utils::OutputSink &out) {
+        const std::string solver = resolve(request.solver);
+        const Loaded loaded = load(request.game);
+        // Render the solution into a string first so that a failing solver writes nothing.
+        std::ostringstream solution;
+        double time;
+        {
+            utils::OutputSink sink(solution);
+            time = loaded.game->solve(solver, request.options, request.time_only ? nullptr : &sink);
+        }
+        out.write("\"cached\": ").write(loaded.cached ? "true" : "false");
+        if (!loaded.cached) {
+            out.write(", \"parse_time\": ").general(loaded.parse_time);
+        }
+        out.write(", \"time\": ").general(time);
+        if (!request.time_only) {
+            out.write(", \"solution\": ").write(solution.view());
+        }
+    }
+};
+
+/**
+ * @brief GameService of one graph type
+ */
+template <typename GraphType>
+class BasicGameService final : public GameService {
+  public:
+    using ParseFunc = std::function<std::shared_ptr<GraphType>(std::istream &)>;
+    using ValidateFunc = std::function<void(const GraphType &)>;
+
+    BasicGameService(ParseFunc parse, ValidateFunc validate, std::size_t cache_capacity)
+        : parse_(std::move(parse)), validate_(std::move(validate)), cache_(cache_capacity) {}
+
+    /**
+     * @brief Register @p SolverType as @p name; its options (see utils::HasSolverOptions) are taken from requests
+     */
+    template <typename SolverType>
+    void add_solver(const std::string &name) {
+        auto entry = std::make_unique<SolverEntry>();
+        if constexpr (utils::HasSolverOptions<SolverType>) {
+            SolverType::add_options(entry->options);
+        }
+        entry->run = [](const GraphType &graph, const boost::program_options::variables_map &vm,
+                        utils::OutputSink *out) {
+            SolverType solver = make_solver<SolverType>(vm);
+            const auto start = std::chrono::steady_clock::now();
+            auto solution = solver.solve(graph);
+            const auto end = std::chrono::steady_clock::now();
+            if (out) {
+                if constexpr (utils::HasSinkOutput<decltype(solution)>) {
+                    solution.write_json(*out);
+                } else {
+                    out->write(solution.to_json());
+                }
+            }
+            return std::chrono::duration<double, std::milli>(end - start).count();
+        };
+        solvers_[name] = std::move(entry);
+    }
+
+    /**
+     * @brief Let @p alias stand for the solver @p name, e.g. "pp" for "priority_promotion"
+     */
+    void add_alias(const std::string &alias, const std::string &name) { aliases_[alias] = name; }
+
+    std::vector<std::string> solver_names() const override {
+        std::vector<std::string> names;
+        for (const auto &[name, entry] : solvers_) {
+            names.push_back(name);
+        }
+        return names;
+    }
+
+    std::string resolve(const std::string &name) const override {
+        if (solvers_.count(name)) {
+            return name;
+        }
+        if (const auto alias = aliases_.find(name); alias != aliases_.end()) {
+            return alias->second;
+        }
+        throw std::invalid_argument("unknown solver '" + name + "'");
+    }
+
+    std::vector<std::string> aliases_of(const std::string &solver) const override {
+        std::vector<std::string> aliases;
+        for (const auto &[alias, name] : aliases_) {
+            if (name == solver) {
+                aliases.push_back(alias);
+            }
+        }
+        return aliases;
+    }
+
+    std::vector<std::string> option_names(const std::string &solver) const override {
+        std::vector<std::string> names;
+        for (const auto &option : entry(solver).options.options()) {
+            names.push_back(option->long_name());
+        }
+        return names;
+    }
+
+    Loaded load(const std::string &text) override {
+        double parse_time = 0;
+        auto [graph, cached] = cache_.get(text, [&] {
+            const auto start = std::chrono::steady_clock::now();
+            std::istringstream in(text);
+            std::shared_ptr<GraphType> parsed = parse_(in);
+            validate_(*parsed);
+            parse_time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            return std::shared_ptr<const GraphType>(std::move(parsed));
+        });
+        return {std::make_shared<Game>(*this, std::move(graph)), cached, parse_time};
+    }
+
+  private:
+    struct SolverEntry {
+        boost::program_options::options_description options;
+        std::function<double(const GraphType &, const boost::program_options::variables_map &, utils::OutputSink *)> run;
+    };
+
+    // A loaded graph; the service must outlive it
+    class Game final : public LoadedGame {
+      public:
+        Game(const BasicGameService &service, std::shared_ptr<const GraphType> graph)
+            : service_(service), graph_(std::move(graph)) {}
+
+        std::size_t num_vertices() const override { return boost::num_vertices(*graph_); }
+        std::size_t num_edges() const override { return boost::num_edges(*graph_); }
+
+        double solve(const std::string &solver, const std::vector<std::string> &options,
+                     utils::OutputSink *solution) const override {
+            const SolverEntry &entry = service_.entry(solver);
+            boost::program_options::variables_map vm;
+            boost::program_options::store(
+                boost::program_options::command_line_parser(options).options(entry.options).run(), vm);
+            boost::program_options::notify(vm);
+            return entry.run(*graph_, vm, solution);
+        }
+
+      private:
+        const BasicGameService &service_;
+        std::shared_ptr<const GraphType> graph_;
+    };
+
+    template <typename SolverType>
+    static SolverType make_solver(const boost::program_options::variables_map &vm) {
+        if constexpr (utils::HasSolverOptions<SolverType>) {
+            return SolverType(vm);
+        } else {
+            return SolverType();
+        }
+    }
+
+    const SolverEntry &entry(const std::string &solver) const {
+        const auto found = solvers_.find(solver);
+        if (found == solvers_.end()) {
+            throw std::invalid_argument("unknown solver '" + solver + "'");
+        }
+        return *found->second;
+    }
+
+    ParseFunc parse_;
+    ValidateFunc validate_;
+    GraphCache<GraphType> cache_;
+    std::map<std::string, std::unique_ptr<SolverEntry>> solvers_;
+    std::map<std::string, std::string> aliases_;
+};
+
+/**
+ * @brief Every game type by name ("parity", "mean_payoff", ...)
+ */
+using Registry = std::map<std::string, std::unique_ptr<GameService>>;
+
+/**
+ * @brief The registry of all shipped solvers, named as their CLIs
+ *        (ggg_<game>_solver_<name>), with short aliases for the long names
+ *
+ * @param cache_capacity Parsed graphs kept per game type
+ */
+Registry make_registry(std::size_t cache_capacity);
+
+} // namespace tools
+} // namespace ggg
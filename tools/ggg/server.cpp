@@ -0,0 +1,324 @@
+#include "libggg/solvers/cancellation.hpp"
+#include "libggg/utils/logging.hpp"
+#include "libggg/utils/output_sink.hpp"
+#include "libggg/utils/parallel.hpp"
+#include "registry.hpp"
+#include "socket.hpp"
+#include <boost/program_options.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <charconv>
+#include <cmath>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ggg_server: solves games for many requests in one process, so that a
+// caller pays neither process startup nor, for a game it sent before, the
+// parse.  Requests and responses are JSON lines, on stdin/stdout or on the
+// connections of a Unix domain socket; see docs/tools.md for the protocol.
+
+using namespace ggg::tools;
+
+namespace {
+
+// Where the responses of one connection go; kept alive by its pending requests
+class ResponseChannel {
+  public:
+    virtual ~ResponseChannel() = default;
+    virtual void send(std::string_view line) = 0;
+};
+
+class StdoutChannel : public ResponseChannel {
+  public:
+    void send(std::string_view line) override {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        std::cout << line;
+        std::cout.flush();
+    }
+
+  private:
+    std::mutex mutex_;
+};
+
+// Closes the connection once the last response is sent
+class SocketChannel : public ResponseChannel {
+  public:
+    explicit SocketChannel(int fd) : fd_(fd) {}
+    ~SocketChannel() override { ::close(fd_); }
+
+    void send(std::string_view line) override {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        send_all(fd_, line);
+    }
+
+  private:
+    int fd_;
+    std::mutex mutex_;
+};
+
+// Fixed set of threads running queued jobs; the destructor finishes the queue
+class WorkerPool {
+  public:
+    explicit WorkerPool(unsigned workers) {
+        for (unsigned i = 0; i < workers; ++i) {
+            threads_.emplace_back([this] { run(); });
+        }
+    }
+
+    ~WorkerPool() {
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto &thread : threads_) {
+            thread.join();
+        }
+    }
+
+    void submit(std::function<void()> job) {
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            jobs_.push_back(std::move(job));
+        }
+        wake_.notify_one();
+    }
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<std::function<void()>> jobs_;
+    std::vector<std::thread> threads_;
+    bool stop_ = false;
+
+    void run() {
+        while (true) {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+                if (jobs_.empty()) {
+                    return;
+                }
+                job = std::move(jobs_.front());
+                jobs_.pop_front();
+            }
+            job();
+        }
+    }
+};
+
+// A request id as written back: finite numbers as they are, anything else
+// (including the "nan" and "inf" from_chars accepts) as a string
+void write_id(ggg::utils::OutputSink &out, const std::string &id) {
+    double number;
+    const auto [end, error] = std::from_chars(id.data(), id.data() + id.size(), number);
+    if (!id.empty() && error == std::errc() && end == id.data() + id.size() && std::isfinite(number)) {
+        out.write(id);
+    } else {
+        out.json_string(id);
+    }
+}
+
+class Server {
+  public:
+    Server(Registry registry, unsigned workers) : registry_(std::move(registry)), pool_(workers) {}
+
+    /**
+     * @brief Queue the request @p line; its response is sent to @p channel when solved
+     */
+    void submit(const std::shared_ptr<ResponseChannel> &channel, std::string line) {
+        pool_.submit([this, channel, line = std::move(line)] { channel->send(respond(line)); });
+    }
+
+  private:
+    Registry registry_;
+    ggg::solvers::DeadlineWatchdog watchdog_;
+    WorkerPool pool_; // last, so that it finishes its jobs before the rest goes
+
+    std::string respond(const std::string &line) {
+        std::ostringstream response;
+        {
+            ggg::utils::OutputSink out(response);
+            write_response(line, out);
+        } // the sink hands its buffer to the stream here
+        return std::move(response).str();
+    }
+
+    void write_response(const std::string &line, ggg::utils::OutputSink &out) {
+        namespace pt = boost::property_tree;
+        pt::ptree request;
+        try {
+            std::istringstream in(line);
+            pt::read_json(in, request);
+        } catch (const pt::json_parser_error &e) {
+            out.write("{\"id\": null, \"error\": ").json_string(std::string("invalid request: ") + e.what()).write("}\n");
+            return;
+        }
+        out.write("{\"id\": ");
+        if (const auto id = request.get_optional<std::string>("id")) {
+            write_id(out, *id);
+        } else {
+            out.write("null");
+        }
+        out.write(", ");
+        try {
+            if (request.get("list", false)) {
+                write_solver_list(out);
+            } else {
+                solve(request, out);
+            }
+        } catch (const std::exception &e) {
+            out.write("\"error\": ").json_string(e.what());
+        }
+        out.write("}\n");
+    }
+
+    void write_solver_list(ggg::utils::OutputSink &out) const {
+        out.write("\"solvers\": {");
+        const char *separator = "";
+        for (const auto &[game, service] : registry_) {
+            out.write(separator).json_string(game).write(": [");
+            const char *item = "";
+            for (const auto &solver : service->solver_names()) {
+                out.write(item).json_string(solver);
+                item = ", ";
+            }
+            out.put(']');
+            separator = ", ";
+        }
+        out.put('}');
+    }
+
+    void solve(const boost::property_tree::ptree &request, ggg::utils::OutputSink &out) {
+        const std::string game = request.get<std::string>("game");
+        const auto service = registry_.find(game);
+        if (service == registry_.end()) {
+            throw std::invalid_argument("unknown game '" + game + "'");
+        }
+        SolveRequest solve;
+        solve.solver = request.get<std::string>("solver");
+        if (const auto path = request.get_optional<std::string>("path")) {
+            if (*path == "-") {
+                throw std::invalid_argument("\"path\" must name a file");
+            }
+            solve.game = read_game_text(*path);
+        } else if (const auto text = request.get_optional<std::string>("dot")) {
+            solve.game = *text;
+        } else {
+            throw std::invalid_argument("the request has neither \"path\" nor \"dot\"");
+        }
+        if (const auto options = request.get_child_optional("options")) {
+            for (const auto &[name, value] : *options) {
+                solve.options.push_back("--" + name + (value.data().empty() ? "" : "=" + value.data()));
+            }
+        }
+        solve.time_only = request.get("time_only", false);
+
+        const double timeout = request.get("timeout", 0.0);
+        ggg::solvers::CancellationToken token;
+        const auto start = std::chrono::steady_clock::now();
+        if (timeout > 0) {
+            watchdog_.watch(token, start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                               std::chrono::duration<double, std::milli>(timeout)));
+        }
+        try {
+            const ggg::solvers::CancellationScope scope(token);
+            service->second->solve(solve, out);
+        } catch (const ggg::solvers::Cancelled &) {
+            const double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            out.write("\"timeout\": true, \"time\": ").general(elapsed);
+        } catch (...) {
+            watchdog_.unwatch(token);
+            throw;
+        }
+        watchdog_.unwatch(token);
+    }
+};
+
+char socket_path[sizeof(sockaddr_un::sun_path)];
+
+extern "C" void remove_socket_and_exit(int) {
+    ::unlink(socket_path);
+    ::_exit(0);
+}
+
+void serve_socket(Server &server, const std::string &path) {
+    const int listener = listen_unix(path);
+    std::memcpy(socket_path, path.c_str(), path.size() + 1);
+    std::signal(SIGINT, remove_socket_and_exit);
+    std::signal(SIGTERM, remove_socket_and_exit);
+    LGG_INFO("Listening on ", path);
+    while (true) {
+        const int fd = ::accept(listener, nullptr, nullptr);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            throw socket_error("accept");
+        }
+        std::thread([&server, fd] {
+            const auto channel = std::make_shared<SocketChannel>(fd);
+            LineReader reader(fd);
+            for (std::string line; reader.next(line);) {
+                if (!line.empty()) {
+                    server.submit(channel, std::move(line));
+                }
+            }
+        }).detach();
+    }
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    namespace po = boost::program_options;
+    try {
+        po::options_description desc("Server Options");
+        desc.add_options()("help,h", "Show help message");
+        desc.add_options()("socket", po::value<std::string>(),
+                           "Serve connections on this Unix domain socket (default: one session on stdin/stdout)");
+        desc.add_options()("workers", po::value<unsigned>()->default_value(0),
+                           "Requests solved at once (0: GGG_THREADS or the hardware concurrency)");
+        desc.add_options()("cache", po::value<std::size_t>()->default_value(64),
+                           "Parsed games kept per game type (0: parse every request)");
+
+        po::variables_map vm;
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        po::notify(vm);
+        if (vm.count("help")) {
+            std::cout << "Usage: " << argv[0] << " [options]\n\n";
+            std::cout << desc << std::endl;
+            return 0;
+        }
+
+        std::signal(SIGPIPE, SIG_IGN);
+        const unsigned workers = ggg::utils::thread_count(vm["workers"].as<unsigned>());
+        Server server(make_registry(vm["cache"].as<std::size_t>()), workers);
+        LGG_INFO("Serving with ", workers, " workers");
+        if (vm.count("socket")) {
+            serve_socket(server, vm["socket"].as<std::string>());
+        } else {
+            const auto channel = std::make_shared<StdoutChannel>();
+            for (std::string line; std::getline(std::cin, line);) {
+                if (!line.empty()) {
+                    server.submit(channel, std::move(line));
+                }
+            }
+        }
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Unix domain socket helpers for ggg_server and its clients: connections
+// carry JSON lines in both directions.
+
+namespace ggg {
+namespace tools {
+
+inline std::runtime_error socket_error(const std::string &what) {
+    return std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+inline sockaddr_un socket_address(const std::string &path) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) {
+        throw std::invalid_argument("socket path too long: " + path);
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    return address;
+}
+
+/**
+ * @brief Listen on a Unix domain socket at @p path, replacing a stale one
+ */
+inline int listen_unix(const std::string &path, int backlog = 64) {
+    const sockaddr_un address = socket_address(path);
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        throw socket_error("socket");
+    }
+    ::unlink(path.c_str());
+    if (::bind(fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0 || ::listen(fd, backlog) != 0) {
+        const auto error = socket_error("cannot listen on " + path);
+        ::close(fd);
+        throw error;
+    }
+    return fd;
+}
+
+/**
+ * @brief Connect to the Unix domain socket at @p path
+ */
+inline int connect_unix(const std::string &path) {
+    const sockaddr_un address = socket_address(path);
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        throw socket_error("socket");
+    }
+    if (::connect(fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0) {
+        const auto error = socket_error("cannot connect to " + path);
+        ::close(fd);
+        throw error;
+    }
+    return fd;
+}
+
+/**
+ * @brief Write all of @p data to @p fd; false if the peer went away
+ */
+inline bool send_all(int fd, std::string_view data) {
+    while (!data.empty()) {
+        const ssize_t n = ::send(fd, data.data(), data.size(), MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data.remove_prefix(static_cast<std::size_t>(n));
+    }
+    return true;
+}
+
+/**
+ * @brief Newline-separated lines read from a file descriptor
+ */
+class LineReader {
+  public:
+    explicit LineReader(int fd) : fd_(fd) {}
+
+    /**
+     * @brief The next line, without its newline; false at end of input
+     *
+     * A last line without a newline is returned as well.
+     */
+    bool next(std::string &line) {
+        while (true) {
+            if (const auto end = buffer_.find('\n', scanned_); end != std::string::npos) {
+                line.assign(buffer_, 0, end);
+                buffer_.erase(0, end + 1);
+                scanned_ = 0;
+                return true;
+            }
+            scanned_ = buffer_.size();
+            char chunk[65536];
+            const ssize_t n = ::read(fd_, chunk, sizeof(chunk));
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                if (buffer_.empty()) {
+                    return false;
+                }
+                line = std::move(buffer_);
+                buffer_.clear();
+                scanned_ = 0;
+                return true;
+            }
+            buffer_.append(chunk, static_cast<std::size_t>(n));
+        }
+    }
+
+  private:
+    int fd_;
+    std::string buffer_;
+    std::size_t scanned_ = 0; // prefix of buffer_ known to hold no newline
+};
+
+} // namespace tools
+} // namespace ggg
@@ -0,0 +1,7 @@
+#include "libggg/mean_payoff/solvers/msca.hpp"
+#include "libggg/utils/solver_wrapper.hpp"
+
+using namespace ggg::mean_payoff;
+
+// Use the unified macro to create a main function for the mean-payoff MSCA value solver
+GGG_GAME_SOLVER_MAIN(graph::Graph, graph::parse, graph::StandardValidator, MSCAValueSolver)
@@ -0,0 +1,8 @@
+#include "libggg/mean_payoff/solvers/zwick_paterson.hpp"
+#include "libggg/mean_payoff/verifier.hpp"
+#include "libggg/utils/solver_wrapper.hpp"
+
+using namespace ggg::mean_payoff;
+
+// Use the unified macro to create a main function for the mean-payoff Zwick-Paterson solver
+GGG_GAME_SOLVER_MAIN_VERIFIED(graph::Graph, graph::parse, graph::StandardValidator, ZwickPatersonSolver, verify_positive)
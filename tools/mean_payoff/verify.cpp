@@ -0,0 +1,32 @@
+#include "libggg/mean_payoff/verifier.hpp"
+#include "libggg/utils/verifier_wrapper.hpp"
+
+using namespace ggg::mean_payoff;
+
+// Mean-payoff check with an option for the solvers' convention on plays of mean payoff 0
+class MeanPayoffVerifierCli {
+  public:
+    static void add_options(boost::program_options::options_description &desc) {
+        desc.add_options()("non-negative", "Give plays of mean payoff 0 to player 0 (default: to player 1, as all "
+                                           "mean-payoff solvers do)");
+    }
+
+    explicit MeanPayoffVerifierCli(const boost::program_options::variables_map &vm)
+        : threshold_(vm.count("non-negative") ? Threshold::NonNegative : Threshold::Positive) {}
+
+    template <typename SolutionType>
+    ggg::solutions::Verification operator()(const graph::Graph &graph, const SolutionType &solution, unsigned threads) const {
+        return verify(graph, solution, threshold_, threads);
+    }
+
+  private:
+    Threshold threshold_;
+};
+
+// Checks a binary solution file against its mean-payoff game
+int main(int argc, char *argv[]) {
+    auto parser_func = [](auto &&input) { return graph::parse(input); };
+    auto validator_func = [](const graph::Graph &graph) { graph::StandardValidator::validate(graph); };
+    return ggg::utils::SolutionVerifierWrapper<graph::Graph, decltype(parser_func), decltype(validator_func),
+                                               MeanPayoffVerifierCli>::run(argc, argv, parser_func, validator_func);
+}
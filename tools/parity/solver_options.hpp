@@ -0,0 +1,43 @@
+#pragma once
+
+#include "libggg/parity/solvers/portfolio.hpp"
+#include <boost/program_options.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Parity solvers configured from the command line, shared by the solver CLIs
+// and ggg_server.
+
+namespace ggg {
+namespace parity {
+
+// Portfolio solver racing the solvers named by --solvers
+class PortfolioSolverCli : public ParityPortfolioSolver {
+  public:
+    PortfolioSolverCli() = default;
+
+    explicit PortfolioSolverCli(const boost::program_options::variables_map &vm)
+        : ParityPortfolioSolver(split(vm["solvers"].as<std::string>())) {}
+
+    static void add_options(boost::program_options::options_description &desc) {
+        desc.add_options()("solvers", boost::program_options::value<std::string>()->default_value("pp,spm,recursive"),
+                           "Comma-separated solvers raced: priority_promotion (pp), "
+                           "progressive_small_progress_measures (spm), recursive");
+    }
+
+  private:
+    static std::vector<std::string> split(const std::string &list) {
+        std::vector<std::string> names;
+        std::istringstream in(list);
+        for (std::string name; std::getline(in, name, ',');) {
+            if (!name.empty()) {
+                names.push_back(name);
+            }
+        }
+        return names;
+    }
+};
+
+} // namespace parity
+} // namespace ggg
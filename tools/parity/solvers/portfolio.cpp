@@ -0,0 +1,8 @@
+#include "libggg/parity/verifier.hpp"
+#include "libggg/utils/solver_wrapper.hpp"
+#include "../solver_options.hpp"
+
+using namespace ggg::parity;
+
+// Unified macro to create a main function for the parity portfolio solver
+GGG_GAME_SOLVER_MAIN_VERIFIED(graph::Graph, graph::parse, graph::StandardValidator, PortfolioSolverCli, ggg::parity::verify)
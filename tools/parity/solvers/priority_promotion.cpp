@@ -1,7 +1,8 @@
 #include "libggg/parity/solvers/priority_promotion.hpp"
+#include "libggg/parity/verifier.hpp"
 #include "libggg/utils/solver_wrapper.hpp"
 
 using namespace ggg::parity;
 
 // Unified macro to create a main function for the priority promotion parity solver
-GGG_GAME_SOLVER_MAIN(graph::Graph, graph::parse, graph::StandardValidator, PriorityPromotionSolver)
+GGG_GAME_SOLVER_MAIN_VERIFIED(graph::Graph, graph::parse, graph::StandardValidator, PriorityPromotionSolver, ggg::parity::verify)
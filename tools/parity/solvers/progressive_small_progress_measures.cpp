@@ -1,7 +1,8 @@
 #include "libggg/parity/solvers/progressive_small_progress_measures.hpp"
+#include "libggg/parity/verifier.hpp"
 #include "libggg/utils/solver_wrapper.hpp"
 
 using namespace ggg::parity;
 
 // Unified macro to create a main function for the Progressive Small Progress Measures parity solver
-GGG_GAME_SOLVER_MAIN(graph::Graph, graph::parse, graph::StandardValidator, ProgressiveSmallProgressMeasuresSolver)
+GGG_GAME_SOLVER_MAIN_VERIFIED(graph::Graph, graph::parse, graph::StandardValidator, ProgressiveSmallProgressMeasuresSolver, ggg::parity::verify)
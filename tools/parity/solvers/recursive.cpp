@@ -1,7 +1,8 @@
 #include "libggg/parity/solvers/recursive.hpp"
+#include "libggg/parity/verifier.hpp"
 #include "libggg/utils/solver_wrapper.hpp"
 
 using namespace ggg::parity;
 
 // Unified macro to create a main function for the recursive parity solver
-GGG_GAME_SOLVER_MAIN(graph::Graph, graph::parse, graph::StandardValidator, RecursiveParitySolver)
\ No newline at end of file
+GGG_GAME_SOLVER_MAIN_VERIFIED(graph::Graph, graph::parse, graph::StandardValidator, RecursiveParitySolver, ggg::parity::verify)
\ No newline at end of file
@@ -0,0 +1,7 @@
+#include "libggg/parity/verifier.hpp"
+#include "libggg/utils/verifier_wrapper.hpp"
+
+using namespace ggg::parity;
+
+// Checks a binary solution file against its parity game
+GGG_SOLUTION_VERIFIER_MAIN(graph::Graph, graph::parse, graph::StandardValidator, ggg::parity::verify)
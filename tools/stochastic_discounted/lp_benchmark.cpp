@@ -0,0 +1,317 @@
+#include "libggg/stochastic_discounted/choice_matrix.hpp"
+#include "libggg/stochastic_discounted/graph.hpp"
+#include "libggg/stochastic_discounted/numeric.hpp"
+#include "libggg/utils/revised_simplex.hpp"
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Benchmark of the LP engine behind the stochastic discounted strategy and
+// objective improvement solvers.  For every game it replays a sequence of
+// LPs once with a fresh RevisedSimplex per round (cold) and once with a
+// single instance that is updated in place (warm):
+// - strategy: the strategy evaluation LPs of strategy improvement (player 0
+//   rows are equations for its current choice, player 1 rows bound the value
+//   by every choice); switched rows are replaced.
+// - objective: the LPs of objective improvement, whose rows bound the value
+//   by every choice of both players and whose objective follows the current
+//   strategies; only the objective is replaced.  The replay stops at the
+//   first stall instead of breaking it.
+
+namespace po = boost::program_options;
+namespace sd = ggg::stochastic_discounted;
+using ggg::utils::RevisedSimplex;
+using Policy = sd::NumericPolicy<double>;
+
+namespace {
+
+struct Run {
+    double milliseconds = 0.0;
+    std::size_t pivots = 0;
+    std::size_t rounds = 0;
+    std::vector<double> values;
+};
+
+std::vector<RevisedSimplex::Entry> matrix_row(const sd::ChoiceMatrix &matrix, std::size_t vertex, std::size_t choice,
+                                              const std::vector<std::size_t> &column) {
+    std::vector<RevisedSimplex::Entry> row;
+    double diagonal = 1.0;
+    const auto columns = matrix.row_columns(choice);
+    const auto coefficients = matrix.row_coefficients(choice);
+    for (std::size_t k = 0; k < columns.size(); ++k) {
+        if (columns[k] == vertex) {
+            diagonal -= coefficients[k];
+        } else {
+            row.push_back({column[columns[k]], -coefficients[k]});
+        }
+    }
+    row.push_back({column[vertex], diagonal});
+    return row;
+}
+
+Run replay_strategy(const sd::ChoiceMatrix &matrix, bool warm) {
+    const std::size_t n = matrix.num_vertices();
+    std::vector<std::size_t> column(n, 0);
+    std::vector<std::size_t> players;
+    for (std::size_t v = 0; v < n; ++v) {
+        if (matrix.player[v] != -1) {
+            column[v] = players.size();
+            players.push_back(v);
+        }
+    }
+    std::vector<std::size_t> strategy(n, 0);
+    for (const std::size_t v : players) {
+        strategy[v] = matrix.first_choice(v);
+    }
+
+    std::vector<std::size_t> row_of(n, 0);
+    const auto build = [&]() {
+        RevisedSimplex lp(players.size());
+        lp.set_objective(std::vector<double>(players.size(), 1.0));
+        for (const std::size_t v : players) {
+            if (matrix.player[v] == 0) {
+                const double reward = matrix.reward[strategy[v]];
+                row_of[v] = lp.add_row(matrix_row(matrix, v, strategy[v], column), reward, reward);
+            } else {
+                for (std::size_t c = matrix.first_choice(v); c < matrix.end_choice(v); ++c) {
+                    lp.add_row(matrix_row(matrix, v, c, column), -RevisedSimplex::kInfinity, matrix.reward[c]);
+                }
+            }
+        }
+        return lp;
+    };
+
+    Run run;
+    std::vector<double> values(n, 0.0);
+    const auto start = std::chrono::steady_clock::now();
+    RevisedSimplex lp = build();
+    for (;;) {
+        const std::size_t before = lp.iterations();
+        if (lp.solve() != ggg::utils::LPStatus::Optimal) {
+            throw std::runtime_error("strategy evaluation LP has no optimal solution");
+        }
+        run.pivots += lp.iterations() - before;
+        ++run.rounds;
+        for (const std::size_t v : players) {
+            values[v] = lp.value(column[v]);
+        }
+
+        std::vector<std::size_t> switched;
+        for (const std::size_t v : players) {
+            if (matrix.player[v] != 0) {
+                continue;
+            }
+            std::size_t best = strategy[v];
+            double best_value = matrix.value(best, values);
+            for (std::size_t c = matrix.first_choice(v); c < matrix.end_choice(v); ++c) {
+                const double value = matrix.value(c, values);
+                if (value > best_value + Policy::improvement_tolerance()) {
+                    best = c;
+                    best_value = value;
+                }
+            }
+            if (best != strategy[v]) {
+                strategy[v] = best;
+                switched.push_back(v);
+            }
+        }
+        if (switched.empty()) {
+            break;
+        }
+        if (warm) {
+            for (const std::size_t v : switched) {
+                const double reward = matrix.reward[strategy[v]];
+                lp.set_row(row_of[v], matrix_row(matrix, v, strategy[v], column), reward, reward);
+            }
+        } else {
+            lp = build();
+        }
+    }
+    run.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    run.values = std::move(values);
+    return run;
+}
+
+Run replay_objective(const sd::ChoiceMatrix &matrix, bool warm) {
+    const std::size_t n = matrix.num_vertices();
+    std::vector<std::size_t> column(n, 0);
+    std::vector<std::size_t> players;
+    for (std::size_t v = 0; v < n; ++v) {
+        if (matrix.player[v] != -1) {
+            column[v] = players.size();
+            players.push_back(v);
+        }
+    }
+    std::vector<std::size_t> strategy(n, 0);
+    for (const std::size_t v : players) {
+        strategy[v] = matrix.first_choice(v);
+    }
+
+    const auto build = [&]() {
+        RevisedSimplex lp(players.size());
+        for (const std::size_t v : players) {
+            for (std::size_t c = matrix.first_choice(v); c < matrix.end_choice(v); ++c) {
+                if (matrix.player[v] == 0) {
+                    lp.add_row(matrix_row(matrix, v, c, column), matrix.reward[c], RevisedSimplex::kInfinity);
+                } else {
+                    lp.add_row(matrix_row(matrix, v, c, column), -RevisedSimplex::kInfinity, matrix.reward[c]);
+                }
+            }
+        }
+        return lp;
+    };
+
+    // Minimise the total slack of the strategy rows: their sum, negated for
+    // player 1, is coefficients · x - constant.
+    std::vector<double> objective(players.size());
+    double constant = 0.0;
+    const auto update_objective = [&]() {
+        std::fill(objective.begin(), objective.end(), 0.0);
+        constant = 0.0;
+        for (const std::size_t v : players) {
+            const double sign = matrix.player[v] == 0 ? 1.0 : -1.0;
+            const std::size_t c = strategy[v];
+            objective[column[v]] -= sign;
+            const auto columns = matrix.row_columns(c);
+            const auto coefficients = matrix.row_coefficients(c);
+            for (std::size_t k = 0; k < columns.size(); ++k) {
+                objective[column[columns[k]]] += sign * coefficients[k];
+            }
+            constant += sign * matrix.reward[c];
+        }
+    };
+
+    Run run;
+    std::vector<double> values(n, 0.0);
+    const auto start = std::chrono::steady_clock::now();
+    RevisedSimplex lp = build();
+    for (;;) {
+        update_objective();
+        if (!warm && run.rounds > 0) {
+            lp = build();
+        }
+        lp.set_objective(objective);
+        const std::size_t before = lp.iterations();
+        if (lp.solve() != ggg::utils::LPStatus::Optimal) {
+            throw std::runtime_error("objective improvement LP has no optimal solution");
+        }
+        run.pivots += lp.iterations() - before;
+        ++run.rounds;
+        for (const std::size_t v : players) {
+            values[v] = lp.value(column[v]);
+        }
+        if (constant - lp.objective() <= Policy::objective_tolerance()) {
+            break;
+        }
+
+        bool switched = false;
+        for (const std::size_t v : players) {
+            const bool maximise = matrix.player[v] == 0;
+            const double current = matrix.value(strategy[v], values);
+            for (std::size_t c = matrix.first_choice(v); c < matrix.end_choice(v); ++c) {
+                const double value = matrix.value(c, values);
+                if (maximise ? current + Policy::improvement_tolerance() < value : current > value + Policy::improvement_tolerance()) {
+                    strategy[v] = c;
+                    switched = true;
+                }
+            }
+        }
+        if (!switched) {
+            break;
+        }
+    }
+    run.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    run.values = std::move(values);
+    return run;
+}
+
+std::vector<std::string> collect_inputs(const std::vector<std::string> &paths) {
+    std::vector<std::string> files;
+    for (const auto &path : paths) {
+        if (boost::filesystem::is_directory(path)) {
+            std::vector<std::string> found;
+            for (const auto &entry : boost::filesystem::directory_iterator(path)) {
+                if (entry.path().extension() == ".dot") {
+                    found.push_back(entry.path().string());
+                }
+            }
+            std::sort(found.begin(), found.end());
+            files.insert(files.end(), found.begin(), found.end());
+        } else {
+            files.push_back(path);
+        }
+    }
+    return files;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    po::options_description desc("Stochastic Discounted LP Benchmark Options");
+    desc.add_options()("help,h", "Show help message");
+    desc.add_options()("input", po::value<std::vector<std::string>>()->multitoken(), "Game files or directories of .dot games");
+    desc.add_options()("mode", po::value<std::string>()->default_value("strategy"), "LP sequence to replay: strategy | objective");
+    po::positional_options_description positional;
+    positional.add("input", -1);
+
+    po::variables_map vm;
+    try {
+        po::store(po::command_line_parser(argc, argv).options(desc).positional(positional).run(), vm);
+        po::notify(vm);
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 2;
+    }
+    if (vm.count("help") || !vm.count("input")) {
+        std::cout << "Usage: " << argv[0] << " <game.dot | directory>...\n\n"
+                  << desc << std::endl;
+        return vm.count("help") ? 0 : 2;
+    }
+
+    const std::string mode = vm["mode"].as<std::string>();
+    if (mode != "strategy" && mode != "objective") {
+        std::cerr << "Error: unknown mode '" << mode << "' (expected strategy | objective)" << std::endl;
+        return 2;
+    }
+    const auto replay = mode == "strategy" ? replay_strategy : replay_objective;
+
+    std::cout << std::left << std::setw(40) << "game" << std::right
+              << std::setw(9) << "vertices" << std::setw(9) << "choices" << std::setw(8) << "rounds"
+              << std::setw(12) << "cold_ms" << std::setw(12) << "cold_piv"
+              << std::setw(12) << "warm_ms" << std::setw(12) << "warm_piv" << std::setw(12) << "max_diff" << std::endl;
+    double cold_total = 0.0;
+    double warm_total = 0.0;
+    try {
+        for (const auto &file : collect_inputs(vm["input"].as<std::vector<std::string>>())) {
+            const auto graph = sd::graph::parse(file);
+            sd::graph::StandardValidator::validate(*graph);
+            const auto matrix = sd::make_choice_matrix(*graph);
+            const Run cold = replay(matrix, false);
+            const Run warm = replay(matrix, true);
+            double diff = 0.0;
+            for (std::size_t v = 0; v < cold.values.size(); ++v) {
+                diff = std::max(diff, std::abs(cold.values[v] - warm.values[v]));
+            }
+            cold_total += cold.milliseconds;
+            warm_total += warm.milliseconds;
+            std::cout << std::left << std::setw(40) << boost::filesystem::path(file).filename().string() << std::right
+                      << std::setw(9) << matrix.num_vertices() << std::setw(9) << matrix.num_choices()
+                      << std::setw(8) << cold.rounds << std::fixed << std::setprecision(3)
+                      << std::setw(12) << cold.milliseconds << std::setw(12) << cold.pivots
+                      << std::setw(12) << warm.milliseconds << std::setw(12) << warm.pivots
+                      << std::scientific << std::setprecision(1) << std::setw(12) << diff << std::endl;
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    std::cout << std::fixed << std::setprecision(3) << "total cold " << cold_total << " ms, warm " << warm_total << " ms" << std::endl;
+    return 0;
+}
@@ -0,0 +1,146 @@
+#include "libggg/stochastic_discounted/choice_matrix.hpp"
+#include "libggg/stochastic_discounted/graph.hpp"
+#include "libggg/stochastic_discounted/numeric.hpp"
+#include "libggg/stochastic_discounted/value_iteration.hpp"
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Benchmark of the value types of the stochastic discounted value iteration
+// solver.  For every game it compiles the ChoiceMatrix in float, double and
+// long double and times the same number of Gauss-Seidel sweeps in each,
+// reporting the bytes a sweep streams (rewards, coefficients, columns and
+// offsets), the time per sweep, and the largest difference between the
+// float and the double values.  On games too large for the caches a sweep
+// is bound by memory bandwidth, so the time follows the bytes.
+
+namespace po = boost::program_options;
+namespace sd = ggg::stochastic_discounted;
+
+namespace {
+
+template <typename T>
+struct Run {
+    std::size_t choices = 0;
+    double megabytes = 0.0;
+    double milliseconds = 0.0; ///< Per sweep
+    std::vector<T> values;
+};
+
+template <typename T>
+Run<T> sweep(const sd::graph::Graph &graph, std::size_t sweeps) {
+    const auto matrix = sd::make_choice_matrix<T>(graph);
+    Run<T> run;
+    run.choices = matrix.num_choices();
+    run.megabytes = (matrix.reward.size() * sizeof(T) + matrix.coefficients.size() * sizeof(T) +
+                     matrix.columns.size() * sizeof(std::size_t) + matrix.row_offsets.size() * sizeof(std::size_t) +
+                     matrix.num_vertices() * sizeof(T)) /
+                    1e6;
+    run.values.assign(matrix.num_vertices(), T(0));
+    std::vector<std::size_t> vertices;
+    for (std::size_t v = 0; v < matrix.num_vertices(); ++v) {
+        if (matrix.player[v] != -1) {
+            vertices.push_back(v);
+        }
+    }
+    std::size_t choice;
+    const auto gauss_seidel = [&] {
+        for (const std::size_t v : vertices) {
+            run.values[v] = sd::bellman_backup(matrix, v, run.values, choice);
+        }
+    };
+    // One untimed sweep brings the matrix into memory and the clock up to speed.
+    gauss_seidel();
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t s = 0; s < sweeps; ++s) {
+        gauss_seidel();
+    }
+    run.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / sweeps;
+    return run;
+}
+
+std::vector<std::string> collect_inputs(const std::vector<std::string> &paths) {
+    std::vector<std::string> files;
+    for (const auto &path : paths) {
+        if (boost::filesystem::is_directory(path)) {
+            std::vector<std::string> found;
+            for (const auto &entry : boost::filesystem::directory_iterator(path)) {
+                if (entry.path().extension() == ".dot") {
+                    found.push_back(entry.path().string());
+                }
+            }
+            std::sort(found.begin(), found.end());
+            files.insert(files.end(), found.begin(), found.end());
+        } else {
+            files.push_back(path);
+        }
+    }
+    return files;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    po::options_description desc("Stochastic Discounted Numeric Benchmark Options");
+    desc.add_options()("help,h", "Show help message");
+    desc.add_options()("input", po::value<std::vector<std::string>>()->multitoken(), "Game files or directories of .dot games");
+    desc.add_options()("sweeps", po::value<std::size_t>()->default_value(50), "Gauss-Seidel sweeps per value type");
+    po::positional_options_description positional;
+    positional.add("input", -1);
+
+    po::variables_map vm;
+    try {
+        po::store(po::command_line_parser(argc, argv).options(desc).positional(positional).run(), vm);
+        po::notify(vm);
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 2;
+    }
+    if (vm.count("help") || !vm.count("input")) {
+        std::cout << "Usage: " << argv[0] << " <game.dot | directory>...\n\n"
+                  << desc << std::endl;
+        return vm.count("help") ? 0 : 2;
+    }
+    const std::size_t sweeps = std::max<std::size_t>(1, vm["sweeps"].as<std::size_t>());
+
+    std::cout << std::left << std::setw(40) << "game" << std::right
+              << std::setw(9) << "vertices" << std::setw(9) << "choices"
+              << std::setw(10) << "float_MB" << std::setw(10) << "float_ms"
+              << std::setw(10) << "double_MB" << std::setw(10) << "double_ms"
+              << std::setw(10) << "ldbl_MB" << std::setw(10) << "ldbl_ms" << std::setw(12) << "float_diff" << std::endl;
+    double totals[3] = {0.0, 0.0, 0.0};
+    try {
+        for (const auto &file : collect_inputs(vm["input"].as<std::vector<std::string>>())) {
+            const auto graph = sd::graph::parse(file);
+            sd::graph::StandardValidator::validate(*graph);
+            const auto single = sweep<float>(*graph, sweeps);
+            const auto dbl = sweep<double>(*graph, sweeps);
+            const auto extended = sweep<long double>(*graph, sweeps);
+            double diff = 0.0;
+            for (std::size_t v = 0; v < dbl.values.size(); ++v) {
+                diff = std::max(diff, std::abs(static_cast<double>(single.values[v]) - dbl.values[v]));
+            }
+            totals[0] += single.milliseconds;
+            totals[1] += dbl.milliseconds;
+            totals[2] += extended.milliseconds;
+            std::cout << std::left << std::setw(40) << boost::filesystem::path(file).filename().string() << std::right
+                      << std::setw(9) << boost::num_vertices(*graph) << std::setw(9) << dbl.choices << std::fixed << std::setprecision(3)
+                      << std::setw(10) << single.megabytes << std::setw(10) << single.milliseconds
+                      << std::setw(10) << dbl.megabytes << std::setw(10) << dbl.milliseconds
+                      << std::setw(10) << extended.megabytes << std::setw(10) << extended.milliseconds
+                      << std::scientific << std::setprecision(1) << std::setw(12) << diff << std::endl;
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    std::cout << std::fixed << std::setprecision(3) << "total ms per sweep: float " << totals[0] << ", double " << totals[1]
+              << ", long double " << totals[2] << std::endl;
+    return 0;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "libggg/stochastic_discounted/solvers/objective.hpp"
+#include "libggg/stochastic_discounted/solvers/strategy.hpp"
+#include "libggg/stochastic_discounted/solvers/value.hpp"
+#include <boost/program_options.hpp>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+// Stochastic discounted solvers configured from the command line, shared by
+// the solver CLIs and ggg_server.  The strategy and value solvers take the
+// value type they compute in, as their library classes do.
+
+namespace ggg {
+namespace stochastic_discounted {
+
+inline StrategyEvaluation parse_evaluation(const std::string &name) {
+    if (name == "lp") {
+        return StrategyEvaluation::LinearProgram;
+    }
+    if (name == "gauss-seidel") {
+        return StrategyEvaluation::GaussSeidel;
+    }
+    if (name == "bicgstab") {
+        return StrategyEvaluation::BiCGSTAB;
+    }
+    throw std::invalid_argument("unknown strategy evaluation '" + name + "' (expected lp | gauss-seidel | bicgstab)");
+}
+
+inline ValueIterationMethod parse_method(const std::string &name) {
+    if (name == "worklist") {
+        return ValueIterationMethod::Worklist;
+    }
+    if (name == "jacobi") {
+        return ValueIterationMethod::Jacobi;
+    }
+    if (name == "gauss-seidel") {
+        return ValueIterationMethod::GaussSeidel;
+    }
+    if (name == "red-black") {
+        return ValueIterationMethod::RedBlack;
+    }
+    if (name == "topological") {
+        return ValueIterationMethod::Topological;
+    }
+    if (name == "interval") {
+        return ValueIterationMethod::Interval;
+    }
+    throw std::invalid_argument("unknown value iteration method '" + name + "' (expected worklist | jacobi | gauss-seidel | red-black | topological | interval)");
+}
+
+// Objective improvement solver configured from the command line
+class ObjectiveSolverCli : public StochasticDiscountedObjectiveSolver {
+  public:
+    ObjectiveSolverCli() = default;
+
+    explicit ObjectiveSolverCli(const boost::program_options::variables_map &vm)
+        : StochasticDiscountedObjectiveSolver(vm["seed"].as<std::uint64_t>()) {}
+
+    static void add_options(boost::program_options::options_description &desc) {
+        desc.add_options()("seed", boost::program_options::value<std::uint64_t>()->default_value(0),
+                           "Seed of the generator that breaks stalls");
+    }
+};
+
+// Strategy improvement solver configured from the command line
+template <typename Value>
+class StrategySolverCli : public BasicStochasticDiscountedStrategySolver<Value> {
+  public:
+    StrategySolverCli() = default;
+
+    explicit StrategySolverCli(const boost::program_options::variables_map &vm)
+        : BasicStochasticDiscountedStrategySolver<Value>(parse_evaluation(vm["evaluation"].as<std::string>())) {}
+
+    static void add_options(boost::program_options::options_description &desc) {
+        desc.add_options()("evaluation", boost::program_options::value<std::string>()->default_value("bicgstab"),
+                           "Strategy evaluation: lp | gauss-seidel | bicgstab");
+    }
+};
+
+// Value iteration solver configured from the command line
+template <typename Value>
+class ValueSolverCli : public BasicStochasticDiscountedValueSolver<Value> {
+  public:
+    ValueSolverCli() = default;
+
+    explicit ValueSolverCli(const boost::program_options::variables_map &vm)
+        : BasicStochasticDiscountedValueSolver<Value>(parse_method(vm["method"].as<std::string>()),
+                                                      vm["precision"].as<double>()) {}
+
+    static void add_options(boost::program_options::options_description &desc) {
+        desc.add_options()("method", boost::program_options::value<std::string>()->default_value("worklist"),
+                           "Value iteration scheme: worklist | jacobi | gauss-seidel | red-black | topological | interval");
+        desc.add_options()("precision", boost::program_options::value<double>()->default_value(1e-9),
+                           "Guaranteed maximal error of the values (all methods but worklist)");
+    }
+};
+
+} // namespace stochastic_discounted
+} // namespace ggg
@@ -1,7 +1,14 @@
-#include "libggg/stochastic_discounted/solvers/strategy.hpp"
 #include "libggg/utils/solver_wrapper.hpp"
+#include "../solver_options.hpp"
 
 using namespace ggg::stochastic_discounted;
 
+// Value type of the solver; the build defines it for the float, long double
+// and rational variants of this CLI.
+#ifndef GGG_STOCHASTIC_DISCOUNTED_VALUE_TYPE
+#define GGG_STOCHASTIC_DISCOUNTED_VALUE_TYPE double
+#endif
+using Value = GGG_STOCHASTIC_DISCOUNTED_VALUE_TYPE;
+
 // Use the unified macro to create a main function for the discounted strategy improvement solver
-GGG_GAME_SOLVER_MAIN(graph::Graph, graph::parse, graph::StandardValidator, StochasticDiscountedStrategySolver)
+GGG_GAME_SOLVER_MAIN(graph::Graph, graph::parse, graph::StandardValidator, StrategySolverCli<Value>)
@@ -1,7 +1,14 @@
-#include "libggg/stochastic_discounted/solvers/value.hpp"
 #include "libggg/utils/solver_wrapper.hpp"
+#include "../solver_options.hpp"
 
 using namespace ggg::stochastic_discounted;
 
+// Value type of the solver; the build defines it for the float and long
+// double variants of this CLI.
+#ifndef GGG_STOCHASTIC_DISCOUNTED_VALUE_TYPE
+#define GGG_STOCHASTIC_DISCOUNTED_VALUE_TYPE double
+#endif
+using Value = GGG_STOCHASTIC_DISCOUNTED_VALUE_TYPE;
+
 // Use the unified macro to create a main function for the discounted value iteration solver
-GGG_GAME_SOLVER_MAIN(graph::Graph, graph::parse, graph::StandardValidator, StochasticDiscountedValueSolver)
+GGG_GAME_SOLVER_MAIN(graph::Graph, graph::parse, graph::StandardValidator, ValueSolverCli<Value>)